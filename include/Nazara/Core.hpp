@@ -40,6 +40,8 @@
 #include <Nazara/Core/ApplicationBase.hpp>
 #include <Nazara/Core/ApplicationComponent.hpp>
 #include <Nazara/Core/ApplicationUpdater.hpp>
+#include <Nazara/Core/AssetPack.hpp>
+#include <Nazara/Core/AssetPackBuilder.hpp>
 #include <Nazara/Core/Buffer.hpp>
 #include <Nazara/Core/BufferMapper.hpp>
 #include <Nazara/Core/ByteArray.hpp>
@@ -91,6 +93,7 @@
 #include <Nazara/Core/ObjectLibrary.hpp>
 #include <Nazara/Core/ObjectRef.hpp>
 #include <Nazara/Core/OwnedMemoryStream.hpp>
+#include <Nazara/Core/ParallelAlgorithm.hpp>
 #include <Nazara/Core/ParameterFile.hpp>
 #include <Nazara/Core/ParameterList.hpp>
 #include <Nazara/Core/PixelFormat.hpp>
@@ -140,6 +143,7 @@
 #include <Nazara/Core/VertexMapper.hpp>
 #include <Nazara/Core/VertexStruct.hpp>
 #include <Nazara/Core/VirtualDirectory.hpp>
+#include <Nazara/Core/VirtualDirectoryAssetPackResolver.hpp>
 #include <Nazara/Core/VirtualDirectoryFilesystemResolver.hpp>
 
 #ifdef NAZARA_ENTT
@@ -31,6 +31,7 @@
 namespace Nz
 {
 	class ByteArray;
+	class TaskScheduler;
 
 	// Hash
 	template<typename T> ByteArray ComputeHash(HashType hash, T&& v);
@@ -49,9 +50,17 @@ namespace Nz
 	using MeshVertex = VertexStruct_XYZ_Normal_UV_Tangent;
 	using SkeletalMeshVertex = VertexStruct_XYZ_Normal_UV_Tangent_Skinning;
 
+	struct SkinningDualQuaternion
+	{
+		Quaternionf real; //< rotation
+		Quaternionf dual; //< translation, encoded as 0.5 * translation * real
+	};
+
 	struct SkinningData
 	{
 		const Joint* joints;
+		const Matrix4f* skinningMatrices = nullptr; //< optional, one per joint (see ComputeSkinningMatrices), computed from joints if null
+		const SkinningDualQuaternion* skinningDualQuaternions = nullptr; //< optional, one per joint (see ComputeSkinningDualQuaternions), computed from joints if null
 		SparsePtr<const Vector3f> inputPositions;
 		SparsePtr<const Vector3f> inputNormals;
 		SparsePtr<const Vector3f> inputTangents;
@@ -73,12 +82,15 @@ namespace Nz
 	};
 
 	NAZARA_CORE_API Boxf ComputeAABB(SparsePtr<const Vector3f> positionPtr, UInt32 vertexCount);
+	NAZARA_CORE_API Boxf ComputeAABB(TaskScheduler& taskScheduler, SparsePtr<const Vector3f> positionPtr, UInt32 vertexCount);
 	NAZARA_CORE_API void ComputeBoxIndexVertexCount(const Vector3ui& subdivision, UInt32* indexCount, UInt32* vertexCount);
 	NAZARA_CORE_API UInt32 ComputeCacheMissCount(IndexIterator indices, UInt32 indexCount);
 	NAZARA_CORE_API void ComputeConeIndexVertexCount(unsigned int subdivision, UInt32* indexCount, UInt32* vertexCount);
 	NAZARA_CORE_API void ComputeCubicSphereIndexVertexCount(unsigned int subdivision, UInt32* indexCount, UInt32* vertexCount);
 	NAZARA_CORE_API void ComputeIcoSphereIndexVertexCount(unsigned int recursionLevel, UInt32* indexCount, UInt32* vertexCount);
 	NAZARA_CORE_API void ComputePlaneIndexVertexCount(const Vector2ui& subdivision, UInt32* indexCount, UInt32* vertexCount);
+	NAZARA_CORE_API void ComputeSkinningDualQuaternions(const Joint* joints, std::size_t jointCount, SkinningDualQuaternion* skinningDualQuaternions);
+	NAZARA_CORE_API void ComputeSkinningMatrices(const Joint* joints, std::size_t jointCount, Matrix4f* skinningMatrices);
 	NAZARA_CORE_API void ComputeUvSphereIndexVertexCount(unsigned int sliceCount, unsigned int stackCount, UInt32* indexCount, UInt32* vertexCount);
 
 	NAZARA_CORE_API void GenerateBox(const Vector3f& lengths, const Vector3ui& subdivision, const Matrix4f& matrix, const Rectf& textureCoords, VertexPointers vertexPointers, IndexIterator indices, Boxf* aabb = nullptr, UInt32 indexOffset = 0);
@@ -90,7 +102,12 @@ namespace Nz
 
 	NAZARA_CORE_API void OptimizeIndices(IndexIterator indices, UInt32 indexCount);
 
+	NAZARA_CORE_API void Skin(SkinningMode skinningMode, const SkinningData& data, UInt32 startVertex, UInt32 vertexCount);
+	NAZARA_CORE_API void Skin(TaskScheduler& taskScheduler, SkinningMode skinningMode, const SkinningData& data, UInt32 startVertex, UInt32 vertexCount);
+	NAZARA_CORE_API void SkinDualQuaternion(const SkinningData& data, UInt32 startVertex, UInt32 vertexCount);
+	NAZARA_CORE_API void SkinDualQuaternion(TaskScheduler& taskScheduler, const SkinningData& data, UInt32 startVertex, UInt32 vertexCount);
 	NAZARA_CORE_API void SkinLinearBlend(const SkinningData& data, UInt32 startVertex, UInt32 vertexCount);
+	NAZARA_CORE_API void SkinLinearBlend(TaskScheduler& taskScheduler, const SkinningData& data, UInt32 startVertex, UInt32 vertexCount);
 
 	inline Vector3f TransformDirectionSRT(const Quaternionf& transformRotation, const Vector3f& transformScale, const Vector3f& direction);
 	inline Vector3f TransformPositionSRT(const Vector3f& transformTranslation, const Quaternionf& transformRotation, const Vector3f& transformScale, const Vector3f& position);
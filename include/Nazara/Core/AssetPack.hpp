@@ -0,0 +1,78 @@
+// Copyright (C) 2026 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#pragma once
+
+#ifndef NAZARA_CORE_ASSETPACK_HPP
+#define NAZARA_CORE_ASSETPACK_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <Nazara/Core/Enums.hpp>
+#include <Nazara/Core/Export.hpp>
+#include <Nazara/Core/File.hpp>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+namespace Nz
+{
+	class Stream;
+
+	class NAZARA_CORE_API AssetPack : public std::enable_shared_from_this<AssetPack>
+	{
+		public:
+			struct Entry;
+
+			AssetPack();
+			AssetPack(const AssetPack&) = delete;
+			AssetPack(AssetPack&&) = delete;
+			~AssetPack() = default;
+
+			bool Decompress(std::size_t entryIndex, void* buffer) const;
+
+			std::optional<std::size_t> FindEntry(std::string_view path) const;
+			std::size_t FindFirstEntry(std::string_view pathPrefix) const;
+
+			inline const Entry& GetEntry(std::size_t entryIndex) const;
+			inline std::size_t GetEntryCount() const;
+			inline const std::filesystem::path& GetFilePath() const;
+
+			std::shared_ptr<Stream> OpenEntry(std::size_t entryIndex) const;
+
+			AssetPack& operator=(const AssetPack&) = delete;
+			AssetPack& operator=(AssetPack&&) = delete;
+
+			struct Entry
+			{
+				std::string_view path; //< points into the mapped pack
+				const UInt8* data;
+				UInt64 size;
+				UInt64 storedSize;
+				AssetPackCompression compression;
+			};
+
+			static std::shared_ptr<AssetPack> OpenFromFile(const std::filesystem::path& filePath);
+
+			static constexpr UInt32 DataAlignment = 16;
+			static constexpr UInt32 HeaderSize = 32;
+			static constexpr UInt32 IndexEntrySize = 40;
+			static constexpr UInt32 Magic = 0x6B507A4E; //< "NzPk"
+			static constexpr UInt32 Version = 1;
+
+		private:
+			bool ParseIndex();
+
+			std::filesystem::path m_filePath;
+			std::vector<Entry> m_entries;
+			File m_file;
+			const UInt8* m_data;
+			UInt64 m_size;
+	};
+}
+
+#include <Nazara/Core/AssetPack.inl>
+
+#endif // NAZARA_CORE_ASSETPACK_HPP
@@ -0,0 +1,22 @@
+// Copyright (C) 2026 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+namespace Nz
+{
+	inline auto AssetPack::GetEntry(std::size_t entryIndex) const -> const Entry&
+	{
+		NazaraAssertMsg(entryIndex < m_entries.size(), "entry index out of range");
+		return m_entries[entryIndex];
+	}
+
+	inline std::size_t AssetPack::GetEntryCount() const
+	{
+		return m_entries.size();
+	}
+
+	inline const std::filesystem::path& AssetPack::GetFilePath() const
+	{
+		return m_filePath;
+	}
+}
@@ -0,0 +1,66 @@
+// Copyright (C) 2026 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#pragma once
+
+#ifndef NAZARA_CORE_ASSETPACKBUILDER_HPP
+#define NAZARA_CORE_ASSETPACKBUILDER_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <Nazara/Core/ByteArray.hpp>
+#include <Nazara/Core/Enums.hpp>
+#include <Nazara/Core/Export.hpp>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <variant>
+#include <vector>
+
+namespace Nz
+{
+	class NAZARA_CORE_API AssetPackBuilder
+	{
+		public:
+			AssetPackBuilder() = default;
+			AssetPackBuilder(const AssetPackBuilder&) = delete;
+			AssetPackBuilder(AssetPackBuilder&&) noexcept = default;
+			~AssetPackBuilder() = default;
+
+			void AddDirectory(const std::filesystem::path& directoryPath, AssetPackCompression compression = AssetPackCompression::None, std::string_view pathPrefix = {});
+			void AddEntry(std::string_view path, ByteArray content, AssetPackCompression compression = AssetPackCompression::None);
+			void AddFile(std::string_view path, std::filesystem::path filePath, AssetPackCompression compression = AssetPackCompression::None);
+
+			bool Build(const std::filesystem::path& outputPath) const;
+
+			void Clear();
+
+			inline std::size_t GetEntryCount() const;
+
+			inline void SetLZ4CompressionLevel(int compressionLevel);
+			inline void SetZstdCompressionLevel(int compressionLevel);
+
+			AssetPackBuilder& operator=(const AssetPackBuilder&) = delete;
+			AssetPackBuilder& operator=(AssetPackBuilder&&) noexcept = default;
+
+			static std::string NormalizePath(std::string_view path);
+
+		private:
+			bool Compress(const ByteArray& content, AssetPackCompression compression, ByteArray& output) const;
+
+			struct PendingEntry
+			{
+				std::string path;
+				std::variant<ByteArray, std::filesystem::path> source;
+				AssetPackCompression compression;
+			};
+
+			std::vector<PendingEntry> m_entries;
+			int m_lz4CompressionLevel = 9;
+			int m_zstdCompressionLevel = 19;
+	};
+}
+
+#include <Nazara/Core/AssetPackBuilder.inl>
+
+#endif // NAZARA_CORE_ASSETPACKBUILDER_HPP
@@ -0,0 +1,21 @@
+// Copyright (C) 2026 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+namespace Nz
+{
+	inline std::size_t AssetPackBuilder::GetEntryCount() const
+	{
+		return m_entries.size();
+	}
+
+	inline void AssetPackBuilder::SetLZ4CompressionLevel(int compressionLevel)
+	{
+		m_lz4CompressionLevel = compressionLevel;
+	}
+
+	inline void AssetPackBuilder::SetZstdCompressionLevel(int compressionLevel)
+	{
+		m_zstdCompressionLevel = compressionLevel;
+	}
+}
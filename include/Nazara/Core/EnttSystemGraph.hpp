@@ -11,13 +11,18 @@
 #include <Nazara/Core/Clock.hpp>
 #include <Nazara/Core/Export.hpp>
 #include <NazaraUtils/MovablePtr.hpp>
+#include <NazaraUtils/TypeList.hpp>
 #include <entt/entt.hpp>
+#include <atomic>
 #include <functional>
+#include <memory>
 #include <unordered_map>
 #include <vector>
 
 namespace Nz
 {
+	class TaskScheduler;
+
 	class NAZARA_CORE_API EnttSystemGraph
 	{
 		public:
@@ -31,9 +36,12 @@ namespace Nz
 			inline void Clear();
 
 			template<typename T> T& GetSystem() const;
+			inline TaskScheduler* GetTaskScheduler() const;
 
 			template<typename T> void RemoveSystem();
 
+			inline void SetTaskScheduler(TaskScheduler* taskScheduler);
+
 			template<typename T> T* TryGetSystem() const;
 
 			void Update();
@@ -50,7 +58,10 @@ namespace Nz
 				virtual bool HasUpdate() const = 0;
 				virtual void Update(Time elapsedTime) = 0;
 
+				std::vector<entt::id_type> readComponents;
+				std::vector<entt::id_type> writeComponents;
 				Int64 executionOrder;
+				bool allowConcurrent;
 			};
 
 			template<typename T, bool CanUpdate>
@@ -64,11 +75,34 @@ namespace Nz
 				T system;
 			};
 
+			struct NodeGroup
+			{
+				std::size_t firstNode;
+				std::size_t nodeCount;
+			};
+
+			struct OrderedNode
+			{
+				NodeBase* node;
+				std::vector<std::size_t> dependents;
+				unsigned int dependencyCount;
+			};
+
+			void BuildExecutionGraph();
+			void DispatchNode(std::size_t nodeIndex, Time elapsedTime);
+			void UpdateConcurrentGroup(const NodeGroup& group, Time elapsedTime);
+
+			static bool HasAccessConflict(const NodeBase& first, const NodeBase& second);
+
+			std::atomic_uint m_remainingNodes;
+			std::unique_ptr<std::atomic_uint[]> m_remainingDependencies;
 			std::unordered_map<entt::id_type, std::size_t /*nodeIndex*/> m_systemToNodes;
-			std::vector<NodeBase*> m_orderedNodes;
+			std::vector<NodeGroup> m_nodeGroups;
+			std::vector<OrderedNode> m_orderedNodes;
 			std::vector<std::unique_ptr<NodeBase>> m_nodes;
 			entt::registry& m_registry;
 			Nz::HighPrecisionClock m_clock;
+			TaskScheduler* m_taskScheduler;
 			bool m_systemOrderUpdated;
 	};
 }
@@ -24,6 +24,50 @@ namespace Nz
 		template<typename, typename = void>
 		struct EnttSystemGraphHasUpdate : std::false_type {};
 
+		template<typename>
+		struct EnttSystemGraphComponentIds;
+
+		template<typename... Components>
+		struct EnttSystemGraphComponentIds<TypeList<Components...>>
+		{
+			static std::vector<entt::id_type> Get()
+			{
+				return { entt::type_hash<Components>::value()... };
+			}
+		};
+
+		// Components read by a system (ReadComponents), empty if not specified
+		template<typename, typename = void>
+		struct EnttSystemGraphReadComponents
+		{
+			using Type = TypeList<>;
+		};
+
+		template<typename T>
+		struct EnttSystemGraphReadComponents<T, std::void_t<typename T::ReadComponents>>
+		{
+			using Type = typename T::ReadComponents;
+		};
+
+		// Components written by a system (WriteComponents), systems only declaring Components are assumed to write all of them
+		template<typename, typename = void, typename = void>
+		struct EnttSystemGraphWriteComponents
+		{
+			using Type = TypeList<>;
+		};
+
+		template<typename T, typename U>
+		struct EnttSystemGraphWriteComponents<T, U, std::void_t<typename T::Components>>
+		{
+			using Type = typename T::Components;
+		};
+
+		template<typename T>
+		struct EnttSystemGraphWriteComponents<T, std::void_t<typename T::WriteComponents>, void>
+		{
+			using Type = typename T::WriteComponents;
+		};
+
 		template<typename T>
 		struct EnttSystemGraphHasUpdate<T, std::void_t<decltype(std::declval<T>().Update(std::declval<Time>()))>> : std::true_type {};
 	}
@@ -50,6 +94,7 @@ namespace Nz
 
 	inline EnttSystemGraph::EnttSystemGraph(entt::registry& registry) :
 	m_registry(registry),
+	m_taskScheduler(nullptr),
 	m_systemOrderUpdated(true)
 	{
 	}
@@ -67,7 +112,10 @@ namespace Nz
 		constexpr bool CanUpdate = Detail::EnttSystemGraphHasUpdate<T>();
 
 		auto nodePtr = std::make_unique<Node<T, CanUpdate>>(m_registry, std::forward<Args>(args)...);
+		nodePtr->allowConcurrent = Detail::EnttSystemGraphAllowConcurrent<T>();
 		nodePtr->executionOrder = Detail::EnttSystemGraphExecutionOrder<T>();
+		nodePtr->readComponents = Detail::EnttSystemGraphComponentIds<typename Detail::EnttSystemGraphReadComponents<T>::Type>::Get();
+		nodePtr->writeComponents = Detail::EnttSystemGraphComponentIds<typename Detail::EnttSystemGraphWriteComponents<T>::Type>::Get();
 
 		T& system = nodePtr->system;
 
@@ -87,6 +135,7 @@ namespace Nz
 			rit->reset();
 
 		m_nodes.clear();
+		m_nodeGroups.clear();
 		m_orderedNodes.clear();
 		m_systemToNodes.clear();
 		m_systemOrderUpdated = true;
@@ -102,6 +151,11 @@ namespace Nz
 		return *system;
 	}
 
+	inline TaskScheduler* EnttSystemGraph::GetTaskScheduler() const
+	{
+		return m_taskScheduler;
+	}
+
 	template<typename T>
 	void EnttSystemGraph::RemoveSystem()
 	{
@@ -114,6 +168,23 @@ namespace Nz
 		m_systemOrderUpdated = false;
 	}
 
+	/*!
+	* \brief Sets the task scheduler used to run systems concurrently
+	*
+	* Systems sharing the same execution order and allowing concurrency (AllowConcurrent, true by default) are run in parallel on the task scheduler,
+	* as long as their declared component accesses (ReadComponents/WriteComponents, or Components which are all considered as written) don't conflict.
+	* Systems declaring no component are assumed to access anything and are never run concurrently with other systems,
+	* systems disallowing concurrency are always run on the calling thread.
+	*
+	* Systems run concurrently must not change the registry structure (creating/destroying entities or adding/removing components).
+	*
+	* \param taskScheduler Task scheduler to use, or nullptr to run every system sequentially on the calling thread
+	*/
+	inline void EnttSystemGraph::SetTaskScheduler(TaskScheduler* taskScheduler)
+	{
+		m_taskScheduler = taskScheduler;
+	}
+
 	template<typename T>
 	T* Nz::EnttSystemGraph::TryGetSystem() const
 	{
@@ -53,6 +53,11 @@ namespace Nz
 		return m_systemGraph.RemoveSystem<T>();
 	}
 
+	inline void EnttWorld::SetTaskScheduler(TaskScheduler* taskScheduler)
+	{
+		m_systemGraph.SetTaskScheduler(taskScheduler);
+	}
+
 	template<typename T>
 	T* EnttWorld::TryGetSystem() const
 	{
@@ -27,6 +27,15 @@ namespace Nz
 		Max = Static
 	};
 
+	enum class AssetPackCompression
+	{
+		None,
+		LZ4,
+		Zstd,
+
+		Max = Zstd
+	};
+
 	enum class BlendEquation
 	{
 		Add,
@@ -227,6 +236,15 @@ namespace Nz
 		Max = CounterClockwise
 	};
 
+	enum class ImageCompressionQuality
+	{
+		Fast,   //< Bounding-box endpoints, suitable for runtime compression
+		Normal, //< Principal axis endpoints
+		High,   //< Principal axis endpoints with refinement, slowest
+
+		Max = High
+	};
+
 	enum class ImageType
 	{
 		E1D,
@@ -270,17 +288,18 @@ namespace Nz
 
 	enum class OpenMode
 	{
-		NotOpen,    //< File is not open
+		NotOpen,      //< File is not open
 
-		Append,     //< Disables writing to existing content, all write operations are performed at the end
-		Defer,      //< Defers file opening until a read/write operation is performed on it
-		Lock,       //< Prevents file modification by other handles while it's open
-		MustExist,  //< Fails if the file doesn't exists, even if opened in write mode
-		Read,       //< Allows read operations
-		Text,       //< Opens in text mode (converts system line endings from/to \n)
-		Truncate,   //< Creates the file if it doesn't exist and empties it otherwise
-		Unbuffered, //< Each read/write operations are performed directly using system calls (very slow)
-		Write,      //< Allows write operations, creates the file if it doesn't exist
+		Append,       //< Disables writing to existing content, all write operations are performed at the end
+		Defer,        //< Defers file opening until a read/write operation is performed on it
+		Lock,         //< Prevents file modification by other handles while it's open
+		MemoryMapped, //< Maps the whole file in memory and reads from it, without any copy for memory-mapped aware loaders (read-only)
+		MustExist,    //< Fails if the file doesn't exists, even if opened in write mode
+		Read,         //< Allows read operations
+		Text,         //< Opens in text mode (converts system line endings from/to \n)
+		Truncate,     //< Creates the file if it doesn't exist and empties it otherwise
+		Unbuffered,   //< Each read/write operations are performed directly using system calls (very slow)
+		Write,        //< Allows write operations, creates the file if it doesn't exist
 
 		Max = Write
 	};
@@ -548,6 +567,14 @@ namespace Nz
 		Max = Repeat
 	};
 
+	enum class SkinningMode
+	{
+		DualQuaternion,
+		LinearBlend,
+
+		Max = LinearBlend
+	};
+
 	enum class SphereType
 	{
 		Cubic,
@@ -66,6 +66,7 @@ namespace Nz
 			Color ComputeAverageColor(UInt8 level = 0) const;
 
 			bool ConvertTo(PixelFormat format);
+			bool ConvertTo(TaskScheduler& taskScheduler, PixelFormat format);
 
 			void Copy(const Image& source, const Boxui32& srcBox, const Vector3ui32& dstPos);
 
@@ -173,6 +174,7 @@ namespace Nz
 			static SharedImage emptyImage;
 
 		private:
+			bool ConvertToFormat(PixelFormat newFormat, TaskScheduler* taskScheduler);
 			void EnsureOwnership();
 			void ReleaseImage();
 
@@ -8,28 +8,39 @@
 #define NAZARA_CORE_IMAGECOMPRESSOR_HPP
 
 #include <NazaraUtils/Prerequisites.hpp>
+#include <Nazara/Core/Enums.hpp>
 #include <Nazara/Core/Export.hpp>
 #include <span>
 
 namespace Nz
 {
 	class Image;
+	class TaskScheduler;
 }
 
 namespace Nz::ImageCompressor
 {
+	struct Settings
+	{
+		ImageCompressionQuality quality = ImageCompressionQuality::High;
+		TaskScheduler* taskScheduler = nullptr; //< if set, block rows are compressed in parallel
+	};
+
 	// Blocks to BC
-	NAZARA_CORE_API void RGBA8BlockToBC1(std::span<const UInt8, 16 * 4> input, std::span<UInt8, 8> output);
-	NAZARA_CORE_API void RGBA8BlockToBC3(std::span<const UInt8, 16 * 4> input, std::span<UInt8, 16> output);
-	NAZARA_CORE_API void R8BlockToBC4(std::span<const UInt8, 16 * 1> input, std::span<UInt8, 8> output);
-	NAZARA_CORE_API void RG8BlockToBC5(std::span<const UInt8, 16 * 2> input, std::span<UInt8, 16> output);
+	NAZARA_CORE_API void RGBA8BlockToBC1(std::span<const UInt8, 16 * 4> input, std::span<UInt8, 8> output, ImageCompressionQuality quality = ImageCompressionQuality::High);
+	NAZARA_CORE_API void RGBA8BlockToBC3(std::span<const UInt8, 16 * 4> input, std::span<UInt8, 16> output, ImageCompressionQuality quality = ImageCompressionQuality::High);
+	NAZARA_CORE_API void R8BlockToBC4(std::span<const UInt8, 16 * 1> input, std::span<UInt8, 8> output, ImageCompressionQuality quality = ImageCompressionQuality::High);
+	NAZARA_CORE_API void RG8BlockToBC5(std::span<const UInt8, 16 * 2> input, std::span<UInt8, 16> output, ImageCompressionQuality quality = ImageCompressionQuality::High);
+	NAZARA_CORE_API void RGBA8BlockToBC7(std::span<const UInt8, 16 * 4> input, std::span<UInt8, 16> output, ImageCompressionQuality quality = ImageCompressionQuality::High);
 
 	// Image to BC
-	NAZARA_CORE_API Image RGB8ToBC1(const Image& sourceImage);
-	NAZARA_CORE_API Image RGBA8ToBC1(const Image& sourceImage);
-	NAZARA_CORE_API Image RGBA8ToBC3(const Image& sourceImage);
-	NAZARA_CORE_API Image R8ToBC4(const Image& sourceImage);
-	NAZARA_CORE_API Image RG8ToBC5(const Image& sourceImage);
+	NAZARA_CORE_API Image RGB8ToBC1(const Image& sourceImage, const Settings& settings = {});
+	NAZARA_CORE_API Image RGBA8ToBC1(const Image& sourceImage, const Settings& settings = {});
+	NAZARA_CORE_API Image RGBA8ToBC3(const Image& sourceImage, const Settings& settings = {});
+	NAZARA_CORE_API Image R8ToBC4(const Image& sourceImage, const Settings& settings = {});
+	NAZARA_CORE_API Image RG8ToBC5(const Image& sourceImage, const Settings& settings = {});
+	NAZARA_CORE_API Image RGB8ToBC7(const Image& sourceImage, const Settings& settings = {});
+	NAZARA_CORE_API Image RGBA8ToBC7(const Image& sourceImage, const Settings& settings = {});
 }
 
 #include <Nazara/Core/ImageCompressor.inl>
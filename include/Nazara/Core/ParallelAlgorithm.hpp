@@ -0,0 +1,22 @@
+// Copyright (C) 2026 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#pragma once
+
+#ifndef NAZARA_CORE_PARALLELALGORITHM_HPP
+#define NAZARA_CORE_PARALLELALGORITHM_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <cstddef>
+
+namespace Nz
+{
+	template<typename F> void ParallelFor(TaskScheduler& scheduler, std::size_t begin, std::size_t end, std::size_t grainSize, F&& func);
+	template<typename T, typename Map, typename Reduce> T ParallelReduce(TaskScheduler& scheduler, std::size_t begin, std::size_t end, std::size_t grainSize, T identity, Map&& map, Reduce&& reduce);
+}
+
+#include <Nazara/Core/ParallelAlgorithm.inl>
+
+#endif // NAZARA_CORE_PARALLELALGORITHM_HPP
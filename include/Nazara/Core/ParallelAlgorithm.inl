@@ -0,0 +1,170 @@
+// Copyright (C) 2026 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace Nz
+{
+	namespace Detail
+	{
+		template<typename F>
+		struct ParallelRangeState
+		{
+			ParallelRangeState(F& chunkFunc, std::size_t rangeBegin, std::size_t rangeEnd, std::size_t rangeChunkSize, std::size_t rangeChunkCount) :
+			func(&chunkFunc),
+			begin(rangeBegin),
+			end(rangeEnd),
+			chunkSize(rangeChunkSize),
+			chunkCount(rangeChunkCount),
+			nextChunk(0),
+			remainingChunks(rangeChunkCount)
+			{
+			}
+
+			// Returns false once every chunk has been claimed, func must not be accessed after that as it may have been destroyed
+			bool ProcessChunk()
+			{
+				std::size_t chunkIndex = nextChunk.fetch_add(1, std::memory_order_relaxed);
+				if (chunkIndex >= chunkCount)
+					return false;
+
+				std::size_t chunkBegin = begin + chunkIndex * chunkSize;
+				std::size_t chunkEnd = std::min(chunkBegin + chunkSize, end);
+				(*func)(chunkIndex, chunkBegin, chunkEnd);
+
+				if (remainingChunks.fetch_sub(1, std::memory_order_acq_rel) == 1)
+					remainingChunks.notify_all();
+
+				return true;
+			}
+
+			F* func;
+			std::size_t begin;
+			std::size_t end;
+			std::size_t chunkSize;
+			std::size_t chunkCount;
+			std::atomic_size_t nextChunk;
+			std::atomic_size_t remainingChunks;
+		};
+
+		inline std::size_t ComputeParallelChunkSize(const TaskScheduler& scheduler, std::size_t count, std::size_t grainSize)
+		{
+			// Aim for a few chunks per thread (workers + calling thread) to balance uneven workloads, without going under the grain size
+			constexpr std::size_t ChunkPerThread = 4;
+
+			std::size_t threadCount = scheduler.GetWorkerCount() + 1;
+			return std::max(std::max<std::size_t>(grainSize, 1), count / (threadCount * ChunkPerThread));
+		}
+
+		template<typename F>
+		void ParallelDispatch(TaskScheduler& scheduler, std::size_t begin, std::size_t end, std::size_t chunkSize, F& chunkFunc)
+		{
+			std::size_t chunkCount = (end - begin + chunkSize - 1) / chunkSize;
+			if (chunkCount <= 1)
+			{
+				chunkFunc(std::size_t(0), begin, end);
+				return;
+			}
+
+			// State is shared with helper tasks as they can start after this function returned (if all chunks were processed before they started)
+			auto state = std::make_shared<ParallelRangeState<F>>(chunkFunc, begin, end, chunkSize, chunkCount);
+
+			std::size_t helperCount = std::min<std::size_t>(scheduler.GetWorkerCount(), chunkCount - 1);
+			for (std::size_t i = 0; i < helperCount; ++i)
+			{
+				scheduler.AddTask([state]
+				{
+					while (state->ProcessChunk());
+				});
+			}
+
+			// Calling thread helps processing chunks instead of sleeping
+			while (state->ProcessChunk());
+
+			// Wait for chunks still being processed by workers
+			for (;;)
+			{
+				std::size_t remainingChunks = state->remainingChunks.load(std::memory_order_acquire);
+				if (remainingChunks == 0)
+					break;
+
+				state->remainingChunks.wait(remainingChunks, std::memory_order_acquire);
+			}
+		}
+	}
+
+	/*!
+	* \ingroup core
+	* \brief Calls a function over a range split in chunks processed in parallel
+	*
+	* The range is split in chunks of at least grainSize elements which are claimed dynamically by the task scheduler workers and the calling thread,
+	* which processes chunks as well instead of waiting. This function returns once the whole range has been processed.
+	*
+	* \param scheduler Task scheduler used to process chunks
+	* \param begin First index of the range
+	* \param end Index past the last index of the range
+	* \param grainSize Minimal number of elements per chunk, should be big enough to make the cost of a chunk higher than the cost of scheduling it
+	* \param func Function called as func(std::size_t chunkBegin, std::size_t chunkEnd) for each chunk, possibly from multiple threads at once
+	*/
+	template<typename F>
+	void ParallelFor(TaskScheduler& scheduler, std::size_t begin, std::size_t end, std::size_t grainSize, F&& func)
+	{
+		if (begin >= end)
+			return;
+
+		std::size_t chunkSize = Detail::ComputeParallelChunkSize(scheduler, end - begin, grainSize);
+
+		auto chunkFunc = [&](std::size_t /*chunkIndex*/, std::size_t chunkBegin, std::size_t chunkEnd)
+		{
+			func(chunkBegin, chunkEnd);
+		};
+
+		Detail::ParallelDispatch(scheduler, begin, end, chunkSize, chunkFunc);
+	}
+
+	/*!
+	* \ingroup core
+	* \brief Computes a value over a range split in chunks processed in parallel
+	*
+	* Each chunk is mapped to a value which are then reduced in order of the chunks on the calling thread, making the result deterministic for a given worker count.
+	*
+	* \param scheduler Task scheduler used to process chunks
+	* \param begin First index of the range
+	* \param end Index past the last index of the range
+	* \param grainSize Minimal number of elements per chunk
+	* \param identity Value returned for an empty range, also used as the initial value of the reduction
+	* \param map Function called as map(std::size_t chunkBegin, std::size_t chunkEnd) for each chunk and returning a T, possibly from multiple threads at once
+	* \param reduce Function called as reduce(T accumulated, T chunkValue) returning the combined value
+	*
+	* \see ParallelFor
+	*/
+	template<typename T, typename Map, typename Reduce>
+	T ParallelReduce(TaskScheduler& scheduler, std::size_t begin, std::size_t end, std::size_t grainSize, T identity, Map&& map, Reduce&& reduce)
+	{
+		if (begin >= end)
+			return identity;
+
+		std::size_t chunkSize = Detail::ComputeParallelChunkSize(scheduler, end - begin, grainSize);
+		std::size_t chunkCount = (end - begin + chunkSize - 1) / chunkSize;
+
+		std::vector<T> chunkResults(chunkCount, identity);
+
+		auto chunkFunc = [&](std::size_t chunkIndex, std::size_t chunkBegin, std::size_t chunkEnd)
+		{
+			chunkResults[chunkIndex] = map(chunkBegin, chunkEnd);
+		};
+
+		Detail::ParallelDispatch(scheduler, begin, end, chunkSize, chunkFunc);
+
+		T result = std::move(identity);
+		for (T& chunkResult : chunkResults)
+			result = reduce(std::move(result), std::move(chunkResult));
+
+		return result;
+	}
+}
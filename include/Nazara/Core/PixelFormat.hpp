@@ -23,6 +23,8 @@
 
 namespace Nz
 {
+	class TaskScheduler;
+
 	struct PixelFormatDescription
 	{
 		static constexpr std::size_t MaxBpp = 128;
@@ -69,6 +71,7 @@ namespace Nz
 
 			static inline bool Convert(PixelFormat srcFormat, PixelFormat dstFormat, const void* src, void* dst);
 			static inline bool Convert(PixelFormat srcFormat, PixelFormat dstFormat, const void* start, const void* end, void* dst);
+			static bool Convert(TaskScheduler& taskScheduler, PixelFormat srcFormat, PixelFormat dstFormat, const void* start, const void* end, void* dst);
 
 			static bool Flip(PixelFlipping flipping, PixelFormat format, UInt32 width, UInt32 height, UInt32 depth, const void* src, void* dst);
 
@@ -8,36 +8,54 @@
 #define NAZARA_CORE_RESOURCEMANAGER_HPP
 
 #include <Nazara/Core/ResourceLoader.hpp>
+#include <atomic>
 #include <filesystem>
 #include <memory>
+#include <mutex>
+#include <queue>
 #include <unordered_map>
+#include <vector>
 
 namespace Nz
 {
+	class TaskScheduler;
+
 	template<typename Type, typename Parameters>
 	class ResourceManager
 	{
 		public:
+			class AsyncHandle;
 			using Loader = ResourceLoader<Type, Parameters>;
 
-			ResourceManager(Loader& loader);
-			explicit ResourceManager(const ResourceManager&) = default;
+			ResourceManager(Loader& loader, TaskScheduler* taskScheduler = nullptr);
+			explicit ResourceManager(const ResourceManager& resourceManager);
 			ResourceManager(ResourceManager&&) noexcept = default;
-			~ResourceManager() = default;
+			~ResourceManager();
 
 			void Clear();
 
 			std::shared_ptr<Type> Get(const std::filesystem::path& filePath);
+			AsyncHandle GetAsync(const std::filesystem::path& filePath, int priority = 0);
 			const Parameters& GetDefaultParameters();
+			TaskScheduler* GetTaskScheduler() const;
 
 			void Register(const std::filesystem::path& filePath, std::shared_ptr<Type> resource);
 			void SetDefaultParameters(Parameters params);
+			void SetTaskScheduler(TaskScheduler* taskScheduler);
 			void Unregister(const std::filesystem::path& filePath);
 
 			ResourceManager& operator=(const ResourceManager&) = delete;
 			ResourceManager& operator=(ResourceManager&&) = delete;
 
 		private:
+			struct AsyncData;
+			struct LoadRequest;
+			struct LoadState;
+
+			void FlushCompletedLoads();
+
+			static void ProcessNextLoad(const std::shared_ptr<AsyncData>& asyncData, std::shared_ptr<LoadState> state = nullptr);
+
 			// https://stackoverflow.com/questions/51065244/is-there-no-standard-hash-for-stdfilesystempath
 			struct PathHash
 			{
@@ -47,9 +65,100 @@ namespace Nz
 				}
 			};
 
+			enum class LoadStatus
+			{
+				Pending,
+				Loading,
+				Loaded,
+				Failed,
+				Cancelled
+			};
+
+			struct LoadState
+			{
+				std::atomic<LoadStatus> status = LoadStatus::Pending;
+				std::filesystem::path filePath;
+				std::shared_ptr<Type> resource;
+				Parameters parameters;
+				unsigned int requestCount = 0; //< protected by AsyncData::mutex
+			};
+
+			struct LoadRequest
+			{
+				std::shared_ptr<AsyncData> asyncData;
+				std::shared_ptr<LoadState> state;
+				bool isCancelled = false; //< protected by AsyncData::mutex
+			};
+
+			struct QueuedLoad
+			{
+				int priority;
+				UInt64 sequence;
+				std::shared_ptr<LoadState> state;
+
+				bool operator<(const QueuedLoad& other) const
+				{
+					// Highest priority first, then first-in first-out
+					if (priority != other.priority)
+						return priority < other.priority;
+
+					return sequence > other.sequence;
+				}
+			};
+
+			struct AsyncData
+			{
+				AsyncData(Loader& resourceLoader) :
+				loader(resourceLoader)
+				{
+				}
+
+				std::mutex mutex;
+				std::priority_queue<QueuedLoad> queue;
+				std::unordered_map<std::filesystem::path, std::shared_ptr<LoadState>, PathHash> pendingLoads;
+				std::vector<std::shared_ptr<LoadState>> completedLoads;
+				Loader& loader;
+				UInt64 nextSequence = 0;
+			};
+
+			std::shared_ptr<AsyncData> m_asyncData;
 			std::unordered_map<std::filesystem::path, std::shared_ptr<Type>, PathHash> m_resources;
 			Loader& m_loader;
 			Parameters m_defaultParameters;
+			TaskScheduler* m_taskScheduler;
+	};
+
+	template<typename Type, typename Parameters>
+	class ResourceManager<Type, Parameters>::AsyncHandle
+	{
+		friend ResourceManager;
+
+		public:
+			AsyncHandle() = default;
+			AsyncHandle(const AsyncHandle&) = default;
+			AsyncHandle(AsyncHandle&&) noexcept = default;
+			~AsyncHandle() = default;
+
+			bool Cancel();
+
+			std::shared_ptr<Type> GetResource() const;
+
+			bool IsCancelled() const;
+			bool IsFinished() const;
+			bool IsValid() const;
+
+			std::shared_ptr<Type> Wait() const;
+
+			explicit operator bool() const;
+
+			AsyncHandle& operator=(const AsyncHandle&) = default;
+			AsyncHandle& operator=(AsyncHandle&&) noexcept = default;
+
+		private:
+			AsyncHandle(std::shared_ptr<LoadRequest> request, TaskScheduler* taskScheduler);
+
+			std::shared_ptr<LoadRequest> m_request;
+			TaskScheduler* m_taskScheduler = nullptr;
 	};
 }
 
@@ -5,6 +5,7 @@
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/File.hpp>
 #include <Nazara/Core/Log.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
 
 namespace Nz
 {
@@ -12,24 +13,72 @@ namespace Nz
 	* \ingroup core
 	* \class Nz::ResourceManager
 	* \brief Core class that represents a resource manager
+	*
+	* Resources can be loaded synchronously (using Get) or asynchronously on a task scheduler (using GetAsync).
+	* Concurrent requests for the same file are merged into a single load.
+	*
+	* \remark The loader (and the task scheduler, if any) must outlive every asynchronous load started by the manager
 	*/
 
 
 	/*!
-	* \brief Clears the content of the manager
+	* \brief Constructs a resource manager
+	*
+	* \param loader Loader used to load resources from files
+	* \param taskScheduler Task scheduler used to run asynchronous loads, if null asynchronous loads are performed synchronously
+	*/
+	template<typename Type, typename Parameters>
+	ResourceManager<Type, Parameters>::ResourceManager(Loader& loader, TaskScheduler* taskScheduler) :
+	m_asyncData(std::make_shared<AsyncData>(loader)),
+	m_loader(loader),
+	m_taskScheduler(taskScheduler)
+	{
+	}
+
+	/*!
+	* \brief Constructs a resource manager sharing the loaded resources of another one
+	*
+	* \param resourceManager Resource manager to copy
+	*
+	* \remark Asynchronous loads in progress in resourceManager are not shared with the new manager
 	*/
 	template<typename Type, typename Parameters>
-	ResourceManager<Type, Parameters>::ResourceManager(Loader& loader) :
-	m_loader(loader)
+	ResourceManager<Type, Parameters>::ResourceManager(const ResourceManager& resourceManager) :
+	m_asyncData(std::make_shared<AsyncData>(resourceManager.m_loader)),
+	m_resources(resourceManager.m_resources),
+	m_loader(resourceManager.m_loader),
+	m_defaultParameters(resourceManager.m_defaultParameters),
+	m_taskScheduler(resourceManager.m_taskScheduler)
 	{
 	}
 
+	/*!
+	* \brief Destructs the resource manager, cancelling asynchronous loads which didn't start yet
+	*/
+	template<typename Type, typename Parameters>
+	ResourceManager<Type, Parameters>::~ResourceManager()
+	{
+		if (!m_asyncData)
+			return; //< moved-from
+
+		std::lock_guard lock(m_asyncData->mutex);
+		for (auto&& [filePath, state] : m_asyncData->pendingLoads)
+		{
+			LoadStatus expectedStatus = LoadStatus::Pending;
+			if (state->status.compare_exchange_strong(expectedStatus, LoadStatus::Cancelled))
+				state->status.notify_all();
+		}
+		m_asyncData->pendingLoads.clear();
+	}
+
 	/*!
 	* \brief Clears the content of the manager
 	*/
 	template<typename Type, typename Parameters>
 	void ResourceManager<Type, Parameters>::Clear()
 	{
+		FlushCompletedLoads();
+
 		m_resources.clear();
 	}
 
@@ -38,14 +87,33 @@ namespace Nz
 	* \return Reference to the object
 	*
 	* \param filePath Path to the asset that will be loaded
+	*
+	* \remark If an asynchronous load of this file is in progress, this waits for it instead of loading the file again
 	*/
 	template<typename Type, typename Parameters>
 	std::shared_ptr<Type> ResourceManager<Type, Parameters>::Get(const std::filesystem::path& filePath)
 	{
+		FlushCompletedLoads();
+
 		std::filesystem::path absolutePath = std::filesystem::canonical(filePath);
 		auto it = m_resources.find(absolutePath);
 		if (it == m_resources.end())
 		{
+			bool isLoading;
+			{
+				std::lock_guard lock(m_asyncData->mutex);
+				isLoading = m_asyncData->pendingLoads.contains(absolutePath);
+			}
+
+			if (isLoading)
+			{
+				// Join the asynchronous load instead of decoding the file twice
+				std::shared_ptr<Type> resource = GetAsync(absolutePath).Wait();
+				FlushCompletedLoads();
+
+				return resource;
+			}
+
 			std::shared_ptr<Type> resource = m_loader.LoadFromFile(absolutePath, GetDefaultParameters());
 			if (!resource)
 			{
@@ -61,6 +129,73 @@ namespace Nz
 		return it->second;
 	}
 
+	/*!
+	* \brief Starts loading a resource from a file on the task scheduler
+	* \return Handle to the load, which can be used to wait for the resource or cancel the load
+	*
+	* \param filePath Path to the asset that will be loaded
+	* \param priority Loads with a higher priority are started first
+	*
+	* If the resource is already loaded, the returned handle is already finished.
+	* If a load of the same file is already pending, the request is merged into it (raising its priority if required).
+	*
+	* \remark If no task scheduler was set, the resource is loaded synchronously
+	*/
+	template<typename Type, typename Parameters>
+	auto ResourceManager<Type, Parameters>::GetAsync(const std::filesystem::path& filePath, int priority) -> AsyncHandle
+	{
+		FlushCompletedLoads();
+
+		std::filesystem::path absolutePath = std::filesystem::canonical(filePath);
+
+		auto request = std::make_shared<LoadRequest>();
+		request->asyncData = m_asyncData;
+
+		if (auto it = m_resources.find(absolutePath); it != m_resources.end())
+		{
+			request->state = std::make_shared<LoadState>();
+			request->state->status = LoadStatus::Loaded;
+			request->state->filePath = std::move(absolutePath);
+			request->state->resource = it->second;
+			request->state->requestCount = 1;
+
+			return AsyncHandle(std::move(request), m_taskScheduler);
+		}
+
+		bool scheduleLoad = false;
+		{
+			std::lock_guard lock(m_asyncData->mutex);
+
+			std::shared_ptr<LoadState>& state = m_asyncData->pendingLoads[absolutePath];
+			if (!state || state->status.load() == LoadStatus::Cancelled)
+			{
+				state = std::make_shared<LoadState>();
+				state->filePath = absolutePath;
+				state->parameters = GetDefaultParameters();
+			}
+
+			state->requestCount++;
+			request->state = state;
+
+			if (m_taskScheduler && state->status.load() == LoadStatus::Pending)
+			{
+				// Merged requests are queued again with their own priority, the highest one will start the load and the others will be skipped
+				m_asyncData->queue.push(QueuedLoad{ priority, m_asyncData->nextSequence++, state });
+				scheduleLoad = true;
+			}
+		}
+
+		if (!m_taskScheduler)
+		{
+			ProcessNextLoad(m_asyncData, request->state);
+			FlushCompletedLoads();
+		}
+		else if (scheduleLoad)
+			m_taskScheduler->AddTask([asyncData = m_asyncData] { ProcessNextLoad(asyncData); });
+
+		return AsyncHandle(std::move(request), m_taskScheduler);
+	}
+
 	/*!
 	* \brief Gets the defaults parameters for the load
 	* \return Default parameters for loading from file
@@ -71,6 +206,16 @@ namespace Nz
 		return m_defaultParameters;
 	}
 
+	/*!
+	* \brief Gets the task scheduler used for asynchronous loads
+	* \return Task scheduler or null if asynchronous loads are performed synchronously
+	*/
+	template<typename Type, typename Parameters>
+	TaskScheduler* ResourceManager<Type, Parameters>::GetTaskScheduler() const
+	{
+		return m_taskScheduler;
+	}
+
 	/*!
 	* \brief Registers the resource under the filePath
 	*
@@ -80,6 +225,8 @@ namespace Nz
 	template<typename Type, typename Parameters>
 	void ResourceManager<Type, Parameters>::Register(const std::filesystem::path& filePath, std::shared_ptr<Type> resource)
 	{
+		FlushCompletedLoads();
+
 		std::filesystem::path absolutePath = std::filesystem::canonical(filePath);
 
 		m_resources[absolutePath] = resource;
@@ -89,6 +236,8 @@ namespace Nz
 	* \brief Sets the defaults parameters for the load
 	*
 	* \param params Default parameters for loading from file
+	*
+	* \remark Pending asynchronous loads keep the parameters they were started with
 	*/
 	template<typename Type, typename Parameters>
 	void ResourceManager<Type, Parameters>::SetDefaultParameters(Parameters params)
@@ -96,6 +245,17 @@ namespace Nz
 		m_defaultParameters = std::move(params);
 	}
 
+	/*!
+	* \brief Sets the task scheduler used for asynchronous loads
+	*
+	* \param taskScheduler Task scheduler used to run asynchronous loads, if null asynchronous loads are performed synchronously
+	*/
+	template<typename Type, typename Parameters>
+	void ResourceManager<Type, Parameters>::SetTaskScheduler(TaskScheduler* taskScheduler)
+	{
+		m_taskScheduler = taskScheduler;
+	}
+
 	/*!
 	* \brief Unregisters the resource under the filePath
 	*
@@ -104,8 +264,205 @@ namespace Nz
 	template<typename Type, typename Parameters>
 	void ResourceManager<Type, Parameters>::Unregister(const std::filesystem::path& filePath)
 	{
+		FlushCompletedLoads();
+
 		std::filesystem::path absolutePath = std::filesystem::canonical(filePath);
 
 		m_resources.erase(absolutePath);
 	}
+
+	template<typename Type, typename Parameters>
+	void ResourceManager<Type, Parameters>::FlushCompletedLoads()
+	{
+		if (!m_asyncData)
+			return;
+
+		std::vector<std::shared_ptr<LoadState>> completedLoads;
+		{
+			std::lock_guard lock(m_asyncData->mutex);
+			if (m_asyncData->completedLoads.empty())
+				return;
+
+			std::swap(completedLoads, m_asyncData->completedLoads);
+		}
+
+		// Resources registered in the meantime take precedence
+		for (const std::shared_ptr<LoadState>& state : completedLoads)
+			m_resources.try_emplace(state->filePath, state->resource);
+	}
+
+	template<typename Type, typename Parameters>
+	void ResourceManager<Type, Parameters>::ProcessNextLoad(const std::shared_ptr<AsyncData>& asyncData, std::shared_ptr<LoadState> state)
+	{
+		{
+			std::lock_guard lock(asyncData->mutex);
+
+			if (!state)
+			{
+				// Pick the highest priority load which wasn't started (or cancelled) yet
+				while (!asyncData->queue.empty())
+				{
+					std::shared_ptr<LoadState> queuedState = asyncData->queue.top().state;
+					asyncData->queue.pop();
+
+					if (queuedState->status.load() == LoadStatus::Pending)
+					{
+						state = std::move(queuedState);
+						break;
+					}
+				}
+
+				if (!state)
+					return;
+			}
+
+			LoadStatus expectedStatus = LoadStatus::Pending;
+			if (!state->status.compare_exchange_strong(expectedStatus, LoadStatus::Loading))
+				return;
+		}
+
+		std::shared_ptr<Type> resource = asyncData->loader.LoadFromFile(state->filePath, state->parameters);
+		if (resource)
+			NazaraDebug("loaded resource from file {0}", state->filePath);
+		else
+			NazaraError("failed to load resource from file: {0}", state->filePath);
+
+		{
+			std::lock_guard lock(asyncData->mutex);
+
+			if (auto it = asyncData->pendingLoads.find(state->filePath); it != asyncData->pendingLoads.end() && it->second == state)
+				asyncData->pendingLoads.erase(it);
+
+			if (resource)
+			{
+				state->resource = std::move(resource);
+				asyncData->completedLoads.push_back(state);
+			}
+
+			state->status = (state->resource) ? LoadStatus::Loaded : LoadStatus::Failed;
+		}
+
+		state->status.notify_all();
+	}
+
+	/*!
+	* \class Nz::ResourceManager::AsyncHandle
+	* \brief Handle to an asynchronous resource load, returned by ResourceManager::GetAsync
+	*/
+
+	template<typename Type, typename Parameters>
+	ResourceManager<Type, Parameters>::AsyncHandle::AsyncHandle(std::shared_ptr<LoadRequest> request, TaskScheduler* taskScheduler) :
+	m_request(std::move(request)),
+	m_taskScheduler(taskScheduler)
+	{
+	}
+
+	/*!
+	* \brief Cancels this request
+	* \return True if the load was cancelled
+	*
+	* The load is only cancelled if it didn't start yet and no other request is waiting for the same resource.
+	*/
+	template<typename Type, typename Parameters>
+	bool ResourceManager<Type, Parameters>::AsyncHandle::Cancel()
+	{
+		NazaraAssertMsg(IsValid(), "invalid handle");
+
+		LoadState& state = *m_request->state;
+		{
+			std::lock_guard lock(m_request->asyncData->mutex);
+			if (m_request->isCancelled)
+				return state.status.load() == LoadStatus::Cancelled;
+
+			m_request->isCancelled = true;
+			if (--state.requestCount > 0)
+				return false;
+
+			LoadStatus expectedStatus = LoadStatus::Pending;
+			if (!state.status.compare_exchange_strong(expectedStatus, LoadStatus::Cancelled))
+				return false;
+
+			auto& pendingLoads = m_request->asyncData->pendingLoads;
+			if (auto it = pendingLoads.find(state.filePath); it != pendingLoads.end() && it->second.get() == &state)
+				pendingLoads.erase(it);
+		}
+
+		state.status.notify_all();
+		return true;
+	}
+
+	/*!
+	* \brief Gets the loaded resource
+	* \return Loaded resource, or null if the load didn't finish, failed or was cancelled
+	*/
+	template<typename Type, typename Parameters>
+	std::shared_ptr<Type> ResourceManager<Type, Parameters>::AsyncHandle::GetResource() const
+	{
+		NazaraAssertMsg(IsValid(), "invalid handle");
+
+		if (m_request->state->status.load() != LoadStatus::Loaded)
+			return nullptr;
+
+		return m_request->state->resource;
+	}
+
+	template<typename Type, typename Parameters>
+	bool ResourceManager<Type, Parameters>::AsyncHandle::IsCancelled() const
+	{
+		NazaraAssertMsg(IsValid(), "invalid handle");
+
+		return m_request->state->status.load() == LoadStatus::Cancelled;
+	}
+
+	/*!
+	* \brief Checks if the load is over
+	* \return True if the resource was loaded, failed to load or if the load was cancelled
+	*/
+	template<typename Type, typename Parameters>
+	bool ResourceManager<Type, Parameters>::AsyncHandle::IsFinished() const
+	{
+		NazaraAssertMsg(IsValid(), "invalid handle");
+
+		LoadStatus status = m_request->state->status.load();
+		return status != LoadStatus::Pending && status != LoadStatus::Loading;
+	}
+
+	template<typename Type, typename Parameters>
+	bool ResourceManager<Type, Parameters>::AsyncHandle::IsValid() const
+	{
+		return m_request != nullptr;
+	}
+
+	/*!
+	* \brief Waits until the load is over
+	* \return Loaded resource, or null if the load failed or was cancelled
+	*
+	* \remark The waiting thread runs queued tasks of the task scheduler while waiting, so this can be called from a task
+	*/
+	template<typename Type, typename Parameters>
+	std::shared_ptr<Type> ResourceManager<Type, Parameters>::AsyncHandle::Wait() const
+	{
+		NazaraAssertMsg(IsValid(), "invalid handle");
+
+		LoadState& state = *m_request->state;
+		for (;;)
+		{
+			LoadStatus status = state.status.load();
+			if (status != LoadStatus::Pending && status != LoadStatus::Loading)
+				break;
+
+			if (m_taskScheduler && m_taskScheduler->TryRunTask())
+				continue;
+
+			state.status.wait(status);
+		}
+
+		return GetResource();
+	}
+
+	template<typename Type, typename Parameters>
+	ResourceManager<Type, Parameters>::AsyncHandle::operator bool() const
+	{
+		return IsValid();
+	}
 }
@@ -19,6 +19,8 @@ namespace Nz
 	{
 		public:
 			using Components = TypeList<class NodeComponent, class VelocityComponent>;
+			using ReadComponents = TypeList<class VelocityComponent>;
+			using WriteComponents = TypeList<class NodeComponent>;
 
 			inline VelocitySystem(entt::registry& registry);
 			VelocitySystem(const VelocitySystem&) = delete;
@@ -9,35 +9,165 @@
 
 #include <NazaraUtils/Prerequisites.hpp>
 #include <Nazara/Core/Export.hpp>
-#include <functional>
+#include <NazaraUtils/FunctionRef.hpp>
+#include <cstddef>
 #include <memory>
+#include <new>
+#include <span>
+#include <type_traits>
 
 namespace Nz
 {
 	class NAZARA_CORE_API TaskScheduler
 	{
 		public:
-			using Task = std::function<void()>;
+			class Task;
+			class TaskGroup;
+			class TaskHandle;
+			enum class WaitMode;
+			struct WorkerBackoff;
 
 			TaskScheduler(unsigned int workerCount = 0);
+			TaskScheduler(unsigned int workerCount, const WorkerBackoff& workerBackoff);
 			TaskScheduler(const TaskScheduler&) = delete;
 			TaskScheduler(TaskScheduler&&) = delete;
 			~TaskScheduler();
 
+			TaskHandle AddContinuation(const TaskHandle& dependency, Task&& continuation);
+			TaskHandle AddContinuation(TaskGroup& group, const TaskHandle& dependency, Task&& continuation);
 			void AddTask(Task&& task);
+			TaskHandle AddTask(Task&& task, std::span<const TaskHandle> dependencies);
+			TaskHandle AddTask(TaskGroup& group, Task&& task, std::span<const TaskHandle> dependencies = {});
 
+			WorkerBackoff GetWorkerBackoff() const;
 			unsigned int GetWorkerCount() const;
 
-			void WaitForTasks();
+			void SetWorkerBackoff(const WorkerBackoff& workerBackoff);
+
+			bool TryRunTask();
+
+			void WaitForTask(const TaskHandle& task, WaitMode waitMode = WaitMode::Block);
+			void WaitForTasks(WaitMode waitMode = WaitMode::Block);
+			void WaitForTasks(const TaskGroup& group, WaitMode waitMode = WaitMode::Block);
 
 			TaskScheduler& operator=(const TaskScheduler&) = delete;
 			TaskScheduler& operator=(TaskScheduler&&) = delete;
 
+			enum class WaitMode
+			{
+				Block,      //< the waiting thread sleeps until tasks are done
+				Participate //< the waiting thread runs queued tasks itself until tasks are done, sleeping only if there's no task left to run
+			};
+
+			// Idle workers (and participating waits) retry stealing tasks spinCount times, then yield their timeslice yieldCount times before sleeping
+			struct WorkerBackoff
+			{
+				unsigned int spinCount = 0;
+				unsigned int yieldCount = 0;
+			};
+
 		private:
 			struct Data;
+			struct TaskGroupState;
+			struct TaskState;
 			class Worker;
+
+			TaskHandle CreateTask(TaskGroup* group, Task&& task, std::span<const TaskHandle> dependencies);
+			void RunTask(TaskState& taskState);
+			void ScheduleTask(std::shared_ptr<TaskState> taskState);
+			void WaitParticipating(FunctionRef<bool()> isFinished, FunctionRef<void()> block);
+
 			std::unique_ptr<Data> m_data;
 	};
+
+	class TaskScheduler::Task
+	{
+		public:
+			// Task objects fit in a cache line, functors up to this size are stored inline without any allocation
+			static constexpr std::size_t InlineStorageSize = 64 - sizeof(void*);
+
+			template<typename F> static constexpr bool FitsInline = sizeof(F) <= InlineStorageSize && alignof(F) <= alignof(std::max_align_t) && std::is_nothrow_move_constructible_v<F>;
+
+			Task() = default;
+			inline Task(std::nullptr_t);
+			template<typename F, typename = std::enable_if_t<!std::is_same_v<std::decay_t<F>, Task> && std::is_invocable_v<std::decay_t<F>&>>> Task(F&& functor);
+			Task(const Task&) = delete;
+			inline Task(Task&& task) noexcept;
+			inline ~Task();
+
+			inline void Reset();
+
+			inline void operator()();
+
+			inline explicit operator bool() const;
+
+			Task& operator=(const Task&) = delete;
+			inline Task& operator=(Task&& task) noexcept;
+			inline Task& operator=(std::nullptr_t);
+
+		private:
+			struct Operations
+			{
+				void (*invoke)(void* storage);
+				void (*move)(void* destination, void* source) noexcept;
+				void (*destroy)(void* storage) noexcept;
+			};
+
+			template<typename F> static const Operations s_heapOperations;
+			template<typename F> static const Operations s_inlineOperations;
+
+			alignas(std::max_align_t) std::byte m_storage[InlineStorageSize];
+			const Operations* m_operations = nullptr;
+	};
+
+	class NAZARA_CORE_API TaskScheduler::TaskGroup
+	{
+		friend TaskScheduler;
+
+		public:
+			TaskGroup();
+			TaskGroup(const TaskGroup&) = default;
+			TaskGroup(TaskGroup&&) noexcept = default;
+			~TaskGroup() = default;
+
+			unsigned int GetRemainingTaskCount() const;
+
+			bool IsFinished() const;
+
+			void Wait() const;
+
+			TaskGroup& operator=(const TaskGroup&) = default;
+			TaskGroup& operator=(TaskGroup&&) noexcept = default;
+
+		private:
+			std::shared_ptr<TaskGroupState> m_state;
+	};
+
+	class NAZARA_CORE_API TaskScheduler::TaskHandle
+	{
+		friend TaskScheduler;
+
+		public:
+			TaskHandle() = default;
+			TaskHandle(const TaskHandle&) = default;
+			TaskHandle(TaskHandle&&) noexcept = default;
+			~TaskHandle() = default;
+
+			bool IsFinished() const;
+			inline bool IsValid() const;
+
+			void Wait() const;
+
+			inline explicit operator bool() const;
+
+			TaskHandle& operator=(const TaskHandle&) = default;
+			TaskHandle& operator=(TaskHandle&&) noexcept = default;
+
+		private:
+			inline TaskHandle(std::shared_ptr<TaskState> state);
+
+			std::shared_ptr<TaskState> m_state;
+	};
 }
 
 #include <Nazara/Core/TaskScheduler.inl>
@@ -2,7 +2,136 @@
 // This file is part of the "Nazara Engine - Core module"
 // For conditions of distribution and use, see copyright notice in Export.hpp
 
+#include <Nazara/Core/Error.hpp>
 
 namespace Nz
 {
+	inline TaskScheduler::Task::Task(std::nullptr_t)
+	{
+	}
+
+	template<typename F, typename>
+	TaskScheduler::Task::Task(F&& functor)
+	{
+		using Functor = std::decay_t<F>;
+
+		if constexpr (FitsInline<Functor>)
+		{
+			new (m_storage) Functor(std::forward<F>(functor));
+			m_operations = &s_inlineOperations<Functor>;
+		}
+		else
+		{
+			// Functor is too big to be stored inline, fallback to heap allocation
+			*reinterpret_cast<Functor**>(m_storage) = new Functor(std::forward<F>(functor));
+			m_operations = &s_heapOperations<Functor>;
+		}
+	}
+
+	inline TaskScheduler::Task::Task(Task&& task) noexcept :
+	m_operations(task.m_operations)
+	{
+		if (m_operations)
+		{
+			m_operations->move(m_storage, task.m_storage);
+			task.m_operations = nullptr;
+		}
+	}
+
+	inline TaskScheduler::Task::~Task()
+	{
+		Reset();
+	}
+
+	inline void TaskScheduler::Task::Reset()
+	{
+		if (m_operations)
+		{
+			m_operations->destroy(m_storage);
+			m_operations = nullptr;
+		}
+	}
+
+	inline void TaskScheduler::Task::operator()()
+	{
+		NazaraAssertMsg(m_operations, "invalid task");
+		m_operations->invoke(m_storage);
+	}
+
+	inline TaskScheduler::Task::operator bool() const
+	{
+		return m_operations != nullptr;
+	}
+
+	inline auto TaskScheduler::Task::operator=(Task&& task) noexcept -> Task&
+	{
+		if (this != &task)
+		{
+			Reset();
+
+			m_operations = task.m_operations;
+			if (m_operations)
+			{
+				m_operations->move(m_storage, task.m_storage);
+				task.m_operations = nullptr;
+			}
+		}
+
+		return *this;
+	}
+
+	inline auto TaskScheduler::Task::operator=(std::nullptr_t) -> Task&
+	{
+		Reset();
+		return *this;
+	}
+
+	template<typename F>
+	const TaskScheduler::Task::Operations TaskScheduler::Task::s_heapOperations = {
+		[](void* storage)
+		{
+			(**static_cast<F**>(storage))();
+		},
+		[](void* destination, void* source) noexcept
+		{
+			*static_cast<F**>(destination) = *static_cast<F**>(source);
+		},
+		[](void* storage) noexcept
+		{
+			delete *static_cast<F**>(storage);
+		}
+	};
+
+	template<typename F>
+	const TaskScheduler::Task::Operations TaskScheduler::Task::s_inlineOperations = {
+		[](void* storage)
+		{
+			(*static_cast<F*>(storage))();
+		},
+		[](void* destination, void* source) noexcept
+		{
+			F& sourceFunctor = *static_cast<F*>(source);
+			new (destination) F(std::move(sourceFunctor));
+			sourceFunctor.~F();
+		},
+		[](void* storage) noexcept
+		{
+			static_cast<F*>(storage)->~F();
+		}
+	};
+
+	inline TaskScheduler::TaskHandle::TaskHandle(std::shared_ptr<TaskState> state) :
+	m_state(std::move(state))
+	{
+	}
+
+	inline bool TaskScheduler::TaskHandle::IsValid() const
+	{
+		return m_state != nullptr;
+	}
+
+	inline TaskScheduler::TaskHandle::operator bool() const
+	{
+		return IsValid();
+	}
 }
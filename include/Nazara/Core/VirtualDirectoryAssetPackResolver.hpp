@@ -0,0 +1,44 @@
+// Copyright (C) 2026 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#pragma once
+
+#ifndef NAZARA_CORE_VIRTUALDIRECTORYASSETPACKRESOLVER_HPP
+#define NAZARA_CORE_VIRTUALDIRECTORYASSETPACKRESOLVER_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <Nazara/Core/AssetPack.hpp>
+#include <Nazara/Core/Export.hpp>
+#include <Nazara/Core/VirtualDirectory.hpp>
+#include <memory>
+#include <string>
+
+namespace Nz
+{
+	class NAZARA_CORE_API VirtualDirectoryAssetPackResolver : public VirtualDirectoryResolver
+	{
+		public:
+			inline VirtualDirectoryAssetPackResolver(std::shared_ptr<AssetPack> assetPack, std::string pathPrefix = {});
+			VirtualDirectoryAssetPackResolver(const VirtualDirectoryAssetPackResolver&) = delete;
+			VirtualDirectoryAssetPackResolver(VirtualDirectoryAssetPackResolver&&) = delete;
+			~VirtualDirectoryAssetPackResolver() = default;
+
+			void ForEach(std::weak_ptr<VirtualDirectory> parent, FunctionRef<bool(std::string_view name, VirtualDirectory::Entry&& entry)> callback) const override;
+
+			inline const std::shared_ptr<AssetPack>& GetAssetPack() const;
+
+			std::optional<VirtualDirectory::Entry> Resolve(std::weak_ptr<VirtualDirectory> parent, const std::string_view* parts, std::size_t partCount) const override;
+
+			VirtualDirectoryAssetPackResolver& operator=(const VirtualDirectoryAssetPackResolver&) = delete;
+			VirtualDirectoryAssetPackResolver& operator=(VirtualDirectoryAssetPackResolver&&) = delete;
+
+		private:
+			std::shared_ptr<AssetPack> m_assetPack;
+			std::string m_pathPrefix; //< empty or ending with '/'
+	};
+}
+
+#include <Nazara/Core/VirtualDirectoryAssetPackResolver.inl>
+
+#endif // NAZARA_CORE_VIRTUALDIRECTORYASSETPACKRESOLVER_HPP
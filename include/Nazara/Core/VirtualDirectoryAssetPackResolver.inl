@@ -0,0 +1,20 @@
+// Copyright (C) 2026 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+
+namespace Nz
+{
+	inline VirtualDirectoryAssetPackResolver::VirtualDirectoryAssetPackResolver(std::shared_ptr<AssetPack> assetPack, std::string pathPrefix) :
+	m_assetPack(std::move(assetPack)),
+	m_pathPrefix(std::move(pathPrefix))
+	{
+		if (!m_pathPrefix.empty() && m_pathPrefix.back() != '/')
+			m_pathPrefix += '/';
+	}
+
+	inline const std::shared_ptr<AssetPack>& VirtualDirectoryAssetPackResolver::GetAssetPack() const
+	{
+		return m_assetPack;
+	}
+}
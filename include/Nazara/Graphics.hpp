@@ -58,6 +58,7 @@
 #include <Nazara/Graphics/ImGuiPipelinePass.hpp>
 #include <Nazara/Graphics/InstancedRenderable.hpp>
 #include <Nazara/Graphics/Light.hpp>
+#include <Nazara/Graphics/LightClusterGrid.hpp>
 #include <Nazara/Graphics/LightingPipelinePass.hpp>
 #include <Nazara/Graphics/LightShadowData.hpp>
 #include <Nazara/Graphics/LinearSlicedSprite.hpp>
@@ -16,8 +16,10 @@
 #include <Nazara/Graphics/GpuDynamicArray.hpp>
 #include <Nazara/Graphics/InstancedRenderable.hpp>
 #include <Nazara/Graphics/Light.hpp>
+#include <Nazara/Graphics/LightClusterGrid.hpp>
 #include <Nazara/Graphics/MaterialInstance.hpp>
 #include <Nazara/Graphics/MaterialPass.hpp>
+#include <Nazara/Graphics/RenderQueue.hpp>
 #include <Nazara/Graphics/RenderQueueRegistry.hpp>
 #include <Nazara/Graphics/ShaderBindingCache.hpp>
 #include <Nazara/Graphics/ShadowAtlasPipelinePass.hpp>
@@ -34,8 +36,8 @@ namespace Nz
 {
 	class LightShadowData;
 	class RenderFrame;
-	class RenderQueue;
 	class RenderTarget;
+	class TaskScheduler;
 	class Texture;
 
 	class NAZARA_GRAPHICS_API DefaultFramePipeline : public FramePipeline
@@ -48,6 +50,8 @@ namespace Nz
 
 			void DequeueTransfer(TransferInterface* transfer) override;
 
+			inline void EnableParallelViewerPreparation(bool enable = true);
+
 			void ForEachRegisteredMaterialInstance(FunctionRef<void(const MaterialInstance& materialInstance)> callback) override;
 			void ForEachShadowCastingLight(FunctionRef<void(std::size_t lightIndex, const Light* light, LightShadowData* lightShadowData)> callback) override;
 
@@ -61,6 +65,9 @@ namespace Nz
 			const std::shared_ptr<Texture>& GetShadowAtlasTexture() const override;
 			const std::shared_ptr<GpuBuffer>& GetSpotLightBuffer() const override;
 			const std::shared_ptr<GpuBuffer>& GetSpotShadowMappingBuffer() const override;
+			inline TaskScheduler* GetTaskScheduler() const;
+
+			inline bool IsParallelViewerPreparationEnabled() const;
 
 			void QueueTransfer(TransferInterface* transfer) override;
 
@@ -75,6 +82,8 @@ namespace Nz
 
 			void Render(GpuResources& renderResources) override;
 
+			inline void SetTaskScheduler(TaskScheduler* taskScheduler);
+
 			void UnregisterInstance(UInt32 instanceIndex) override;
 			void UnregisterLight(std::size_t lightIndex) override;
 			void UnregisterRenderable(std::size_t renderableIndex) override;
@@ -108,6 +117,8 @@ namespace Nz
 
 			std::size_t InsertTransferPass(FrameGraph& frameGraph, std::function<void()> callback);
 
+			void PrepareViewer(ViewerData& viewerData);
+
 			void ProcesRemovedData(GpuResources& renderResources);
 
 			void RegisterMaterialInstance(MaterialInstance* materialPass, std::size_t renderableIndex);
@@ -176,8 +187,13 @@ namespace Nz
 			{
 				struct FrameData
 				{
+					std::vector<std::vector<const RenderElement*>> sortedRenderQueues;
+					std::vector<RenderQueue::SortEntry> sortBuffer;
+					std::vector<RenderQueue::SortEntry> sortEntries;
+					std::vector<LightClusterGrid::LightSphere> clusteredLights;
 					Bitset<UInt64> visibleLights;
 					Frustumf frustum;
+					LightClusterGrid lightClusters;
 				};
 
 				std::size_t finalColorAttachment;
@@ -188,6 +204,7 @@ namespace Nz
 				ShaderBindingPtr blitShaderBinding;
 				UInt32 renderMask;
 				bool pendingDestruction = false;
+				bool requiresLightClusters = false;
 
 				NazaraSlot(AbstractViewer, OnRenderMaskUpdated, onRenderMaskUpdated);
 				NazaraSlot(TransferInterface, OnTransferRequired, onTransferRequired);
@@ -230,8 +247,10 @@ namespace Nz
 			MemoryPool<SkeletonInstanceData> m_skeletonInstancePool;
 			MemoryPool<ViewerData> m_viewerPool;
 			mutable ShaderBindingCache m_shaderBindingCache;
+			TaskScheduler* m_taskScheduler;
 			UInt8 m_generationCounter;
 			bool m_invalidateSceneBindings;
+			bool m_parallelViewerPreparation;
 			bool m_rebuildFrameGraph;
 	};
 }
@@ -4,4 +4,37 @@
 
 namespace Nz
 {
+	/*!
+	* \brief Enables or disables parallel preparation of viewers (light culling, clustering and render queue sorting)
+	*
+	* \param enable Whether viewers should be prepared in parallel
+	*
+	* \remark This has no effect until a task scheduler is set using SetTaskScheduler
+	*/
+	inline void DefaultFramePipeline::EnableParallelViewerPreparation(bool enable)
+	{
+		m_parallelViewerPreparation = enable;
+	}
+
+	inline TaskScheduler* DefaultFramePipeline::GetTaskScheduler() const
+	{
+		return m_taskScheduler;
+	}
+
+	inline bool DefaultFramePipeline::IsParallelViewerPreparationEnabled() const
+	{
+		return m_parallelViewerPreparation;
+	}
+
+	/*!
+	* \brief Sets the task scheduler used to parallelize frame preparation (such as light clustering)
+	*
+	* \param taskScheduler Task scheduler to use, or nullptr to prepare frames on the calling thread
+	*
+	* \remark The task scheduler must outlive the pipeline or be reset before being destroyed
+	*/
+	inline void DefaultFramePipeline::SetTaskScheduler(TaskScheduler* taskScheduler)
+	{
+		m_taskScheduler = taskScheduler;
+	}
 }
@@ -141,8 +141,9 @@ namespace Nz
 	enum class RenderQueueFlag
 	{
 		SortByDistance,
+		SortFrontToBack,
 
-		Max = SortByDistance
+		Max = SortFrontToBack
 	};
 
 	template<>
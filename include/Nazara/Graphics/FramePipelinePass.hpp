@@ -24,6 +24,7 @@ namespace Nz
 	class FramePass;
 	class FramePipeline;
 	class GpuResources;
+	class LightClusterGrid;
 
 	class NAZARA_GRAPHICS_API FramePipelinePass
 	{
@@ -43,6 +44,8 @@ namespace Nz
 
 			virtual FramePass& RegisterToFrameGraph(FrameGraph& frameGraph, const PassInputOuputs& inputOuputs) = 0;
 
+			virtual bool RequiresLightClusters() const;
+
 			FramePipelinePass& operator=(const FramePipelinePass&) = delete;
 			FramePipelinePass& operator=(FramePipelinePass&&) = delete;
 
@@ -54,6 +57,7 @@ namespace Nz
 				const Bitset<UInt64>* visibleLights;
 				const Frustumf& frustum;
 				GpuResources& renderResources;
+				const LightClusterGrid* lightClusters = nullptr; //< clustered list of visible lights (only built if a pass of the viewer requires it)
 			};
 
 			struct PassData
@@ -0,0 +1,117 @@
+// Copyright (C) 2026 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Graphics module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#pragma once
+
+#ifndef NAZARA_GRAPHICS_LIGHTCLUSTERGRID_HPP
+#define NAZARA_GRAPHICS_LIGHTCLUSTERGRID_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <Nazara/Graphics/Export.hpp>
+#include <Nazara/Math/Box.hpp>
+#include <Nazara/Math/Matrix4.hpp>
+#include <Nazara/Math/Sphere.hpp>
+#include <Nazara/Math/Vector3.hpp>
+#include <span>
+#include <vector>
+
+namespace Nz
+{
+	class TaskScheduler;
+
+	class NAZARA_GRAPHICS_API LightClusterGrid
+	{
+		public:
+			struct Cluster;
+			struct LightSphere;
+
+			inline LightClusterGrid(const Vector3ui& clusterCount = DefaultClusterCount, float maxDepth = DefaultMaxDepth);
+			LightClusterGrid(const LightClusterGrid&) = default;
+			LightClusterGrid(LightClusterGrid&&) noexcept = default;
+			~LightClusterGrid() = default;
+
+			void Build(const Matrix4f& viewMatrix, const Matrix4f& projectionMatrix, float zNear, float zFar, std::span<const LightSphere> lights, TaskScheduler* taskScheduler = nullptr);
+
+			inline std::size_t ComputeClusterIndex(UInt32 x, UInt32 y, UInt32 z) const;
+			UInt32 ComputeDepthSlice(float viewDepth) const;
+
+			inline void Clear();
+
+			inline const Cluster& GetCluster(UInt32 x, UInt32 y, UInt32 z) const;
+			inline const Boxf& GetClusterBounds(UInt32 x, UInt32 y, UInt32 z) const;
+			inline const Vector3ui& GetClusterCount() const;
+			inline std::span<const UInt32> GetClusterLights(UInt32 x, UInt32 y, UInt32 z) const;
+			inline std::span<const Cluster> GetClusters() const;
+			inline std::span<const UInt32> GetLightIndices() const;
+			inline float GetMaxDepth() const;
+
+			inline void UpdateClusterCount(const Vector3ui& clusterCount);
+			inline void UpdateMaxDepth(float maxDepth);
+
+			LightClusterGrid& operator=(const LightClusterGrid&) = default;
+			LightClusterGrid& operator=(LightClusterGrid&&) noexcept = default;
+
+			struct Cluster
+			{
+				UInt32 firstLightIndex; //< offset in GetLightIndices()
+				UInt32 lightCount;
+			};
+
+			struct LightSphere
+			{
+				Spheref sphere; //< world space
+				UInt32 lightIndex;
+			};
+
+			static constexpr Vector3ui DefaultClusterCount = Vector3ui(16, 9, 24);
+			static constexpr float DefaultMaxDepth = 1000.f;
+
+		private:
+			void AssignSlice(UInt32 z);
+			void ComputeSliceBounds(UInt32 z);
+			float GetSliceDepth(UInt32 z) const;
+
+			struct LightAssignment
+			{
+				UInt32 tileIndex;
+				UInt32 lightIndex;
+			};
+
+			struct ViewLight
+			{
+				Vector3f center;
+				float radius;
+				UInt32 lightIndex;
+				UInt32 firstSlice;
+				UInt32 lastSlice;
+				Vector2ui firstTile;
+				Vector2ui lastTile;
+			};
+
+			struct TileRay
+			{
+				Vector3f origin;
+				Vector3f direction;
+			};
+
+			std::vector<Boxf> m_clusterBounds;
+			std::vector<Cluster> m_clusters;
+			std::vector<std::vector<LightAssignment>> m_sliceAssignments;
+			std::vector<TileRay> m_tileRays;
+			std::vector<UInt32> m_lightIndices;
+			std::vector<ViewLight> m_viewLights;
+			Matrix4f m_projectionMatrix;
+			Vector3ui m_clusterCount;
+			float m_depthNear;
+			float m_depthFar;
+			float m_invDepthRange; //< inverse of the log depth ratio with exponential slices
+			float m_lastSliceFar;
+			float m_maxDepth;
+			bool m_linearDepthSlices;
+	};
+}
+
+#include <Nazara/Graphics/LightClusterGrid.inl>
+
+#endif // NAZARA_GRAPHICS_LIGHTCLUSTERGRID_HPP
@@ -0,0 +1,93 @@
+// Copyright (C) 2026 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Graphics module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#include <Nazara/Core/Error.hpp>
+
+namespace Nz
+{
+	inline LightClusterGrid::LightClusterGrid(const Vector3ui& clusterCount, float maxDepth) :
+	m_projectionMatrix(Matrix4f::Identity()),
+	m_depthNear(0.f),
+	m_depthFar(0.f),
+	m_invDepthRange(0.f),
+	m_lastSliceFar(0.f),
+	m_maxDepth(maxDepth),
+	m_linearDepthSlices(false)
+	{
+		UpdateClusterCount(clusterCount);
+	}
+
+	inline std::size_t LightClusterGrid::ComputeClusterIndex(UInt32 x, UInt32 y, UInt32 z) const
+	{
+		NazaraAssertMsg(x < m_clusterCount.x && y < m_clusterCount.y && z < m_clusterCount.z, "cluster out of range");
+		return (std::size_t(z) * m_clusterCount.y + y) * m_clusterCount.x + x;
+	}
+
+	inline void LightClusterGrid::Clear()
+	{
+		for (Cluster& cluster : m_clusters)
+		{
+			cluster.firstLightIndex = 0;
+			cluster.lightCount = 0;
+		}
+
+		m_lightIndices.clear();
+	}
+
+	inline auto LightClusterGrid::GetCluster(UInt32 x, UInt32 y, UInt32 z) const -> const Cluster&
+	{
+		return m_clusters[ComputeClusterIndex(x, y, z)];
+	}
+
+	inline const Boxf& LightClusterGrid::GetClusterBounds(UInt32 x, UInt32 y, UInt32 z) const
+	{
+		return m_clusterBounds[ComputeClusterIndex(x, y, z)];
+	}
+
+	inline const Vector3ui& LightClusterGrid::GetClusterCount() const
+	{
+		return m_clusterCount;
+	}
+
+	inline std::span<const UInt32> LightClusterGrid::GetClusterLights(UInt32 x, UInt32 y, UInt32 z) const
+	{
+		const Cluster& cluster = GetCluster(x, y, z);
+		return std::span<const UInt32>(m_lightIndices.data() + cluster.firstLightIndex, cluster.lightCount);
+	}
+
+	inline auto LightClusterGrid::GetClusters() const -> std::span<const Cluster>
+	{
+		return m_clusters;
+	}
+
+	inline std::span<const UInt32> LightClusterGrid::GetLightIndices() const
+	{
+		return m_lightIndices;
+	}
+
+	inline float LightClusterGrid::GetMaxDepth() const
+	{
+		return m_maxDepth;
+	}
+
+	inline void LightClusterGrid::UpdateClusterCount(const Vector3ui& clusterCount)
+	{
+		NazaraAssertMsg(clusterCount.x > 0 && clusterCount.y > 0 && clusterCount.z > 0, "cluster count must be non-zero");
+
+		m_clusterCount = clusterCount;
+
+		std::size_t clusterCountTotal = std::size_t(clusterCount.x) * clusterCount.y * clusterCount.z;
+		m_clusterBounds.resize(clusterCountTotal, Boxf::Zero());
+		m_clusters.resize(clusterCountTotal);
+		m_sliceAssignments.resize(clusterCount.z);
+		m_tileRays.resize(std::size_t(clusterCount.x + 1) * (clusterCount.y + 1));
+
+		Clear();
+	}
+
+	inline void LightClusterGrid::UpdateMaxDepth(float maxDepth)
+	{
+		m_maxDepth = maxDepth;
+	}
+}
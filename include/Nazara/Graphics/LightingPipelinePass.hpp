@@ -14,6 +14,7 @@
 #include <Nazara/Math/Frustum.hpp>
 #include <Nazara/Renderer/GpuUploadPool.hpp>
 #include <Nazara/Renderer/ShaderBinding.hpp>
+#include <NazaraUtils/Bitset.hpp>
 #include <NazaraUtils/FixedVector.hpp>
 #include <memory>
 
@@ -47,6 +48,8 @@ namespace Nz
 
 			FramePass& RegisterToFrameGraph(FrameGraph& frameGraph, const PassInputOuputs& inputOuputs) override;
 
+			bool RequiresLightClusters() const override;
+
 			LightingPipelinePass& operator=(const LightingPipelinePass&) = delete;
 			LightingPipelinePass& operator=(LightingPipelinePass&&) = delete;
 
@@ -122,6 +125,7 @@ namespace Nz
 			std::vector<LightBlockShadow> m_shadowDirectionalLights;
 			std::vector<LightBlockShadow> m_shadowPointLights;
 			std::vector<LightBlockShadow> m_shadowSpotLights;
+			Bitset<UInt64> m_clusteredLights;
 			EnumArray<BasicLightType, LightPipeline> m_pipelines;
 			FixedVector<UInt32, 8> m_gbufferBindingIndices;
 			UInt32 m_depthMapBindingIndex;
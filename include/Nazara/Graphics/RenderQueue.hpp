@@ -8,6 +8,7 @@
 #define NAZARA_GRAPHICS_RENDERQUEUE_HPP
 
 #include <NazaraUtils/Prerequisites.hpp>
+#include <Nazara/Graphics/Export.hpp>
 #include <Nazara/Graphics/RenderElement.hpp>
 #include <Nazara/Graphics/RenderElementOwner.hpp>
 #include <Nazara/Graphics/RenderQueueRegistry.hpp>
@@ -21,9 +22,11 @@ namespace Nz
 	class GpuResources;
 	class SkeletonInstance;
 
-	class RenderQueue
+	class NAZARA_GRAPHICS_API RenderQueue
 	{
 		public:
+			struct SortEntry;
+
 			inline explicit RenderQueue(std::size_t passIndex, RenderQueueFlags flags = {});
 			RenderQueue(const RenderQueue&) = delete;
 			RenderQueue(RenderQueue&&) = delete;
@@ -37,8 +40,11 @@ namespace Nz
 
 			inline std::size_t GetContentHash() const;
 			inline RenderQueueFlags GetFlags() const;
+			inline const std::vector<const RenderElement*>& GetOrderedRenderElements() const;
 			inline std::size_t GetPassIndex() const;
 
+			inline bool IsSortedPerViewer() const;
+
 			void Update(GpuResources& renderResources);
 
 			template<typename F> void Process(UInt32 renderMask, F&& callback) const;
@@ -54,6 +60,17 @@ namespace Nz
 			RenderQueue& operator=(const RenderQueue&) = delete;
 			RenderQueue& operator=(RenderQueue&&) = delete;
 
+			static UInt64 ComputeBackToFrontSortKey(const RenderElement& element, float squaredDistance);
+			static UInt64 ComputeFrontToBackSortKey(const RenderElement& element, float squaredDistance);
+			static void RadixSort(std::vector<SortEntry>& entries, std::vector<SortEntry>& buffer);
+			static void SortEntries(std::vector<SortEntry>& entries, std::vector<SortEntry>& buffer);
+
+			struct SortEntry
+			{
+				UInt64 key;
+				const RenderElement* element;
+			};
+
 		private:
 			void RecomputeContentHash();
 
@@ -70,6 +87,8 @@ namespace Nz
 			std::vector<RenderElementOwner> m_deletedRenderElements;
 			std::vector<RenderElementOwner> m_renderElements;
 			std::vector<const RenderElement*> m_orderedRenderElements;
+			std::vector<SortEntry> m_sortBuffer;
+			std::vector<SortEntry> m_sortEntries;
 			RenderQueueFlags m_flags;
 			RenderQueueRegistry m_renderQueueRegistry;
 			bool m_shouldRebuildRenderQueue;
@@ -27,11 +27,21 @@ namespace Nz
 		return m_flags;
 	}
 
+	inline const std::vector<const RenderElement*>& RenderQueue::GetOrderedRenderElements() const
+	{
+		return m_orderedRenderElements;
+	}
+
 	inline std::size_t RenderQueue::GetPassIndex() const
 	{
 		return m_passIndex;
 	}
 
+	inline bool RenderQueue::IsSortedPerViewer() const
+	{
+		return m_flags.Test(RenderQueueFlag::SortByDistance) || m_flags.Test(RenderQueueFlag::SortFrontToBack);
+	}
+
 	template<typename F>
 	void RenderQueue::Process(UInt32 renderMask, F&& callback) const
 	{
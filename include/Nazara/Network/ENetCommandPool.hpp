@@ -0,0 +1,87 @@
+// Copyright (C) 2026 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#pragma once
+
+#ifndef NAZARA_NETWORK_ENETCOMMANDPOOL_HPP
+#define NAZARA_NETWORK_ENETCOMMANDPOOL_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <Nazara/Network/Export.hpp>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace Nz
+{
+	// Fixed-size node allocator shared by all peers of a host, used to back their command queues
+	class NAZARA_NETWORK_API ENetCommandPool
+	{
+		public:
+			inline ENetCommandPool(std::size_t nodesPerBlock = 256);
+			ENetCommandPool(const ENetCommandPool&) = delete;
+			ENetCommandPool(ENetCommandPool&&) noexcept = default;
+			~ENetCommandPool() = default;
+
+			void* Allocate(std::size_t size);
+			void Free(void* ptr, std::size_t size);
+
+			inline std::size_t GetBlockCount() const;
+
+			ENetCommandPool& operator=(const ENetCommandPool&) = delete;
+			ENetCommandPool& operator=(ENetCommandPool&&) noexcept = default;
+
+		private:
+			struct FreeNode;
+			struct SizeClass;
+
+			SizeClass& GetSizeClass(std::size_t size);
+
+			static constexpr std::size_t NodeAlignment = alignof(std::max_align_t);
+
+			struct FreeNode
+			{
+				FreeNode* next;
+			};
+
+			struct SizeClass
+			{
+				std::size_t nodeSize;
+				FreeNode* freeList = nullptr;
+			};
+
+			std::size_t m_nodesPerBlock;
+			std::vector<std::unique_ptr<std::byte[]>> m_blocks;
+			std::vector<SizeClass> m_sizeClasses;
+	};
+
+	template<typename T>
+	class ENetCommandAllocator
+	{
+		template<typename U> friend class ENetCommandAllocator;
+
+		public:
+			using value_type = T;
+			using propagate_on_container_copy_assignment = std::true_type;
+			using propagate_on_container_move_assignment = std::true_type;
+			using propagate_on_container_swap = std::true_type;
+
+			inline ENetCommandAllocator(ENetCommandPool* pool) noexcept;
+			template<typename U> ENetCommandAllocator(const ENetCommandAllocator<U>& allocator) noexcept;
+
+			inline T* allocate(std::size_t n);
+			inline void deallocate(T* ptr, std::size_t n) noexcept;
+
+			template<typename U> bool operator==(const ENetCommandAllocator<U>& allocator) const noexcept;
+			template<typename U> bool operator!=(const ENetCommandAllocator<U>& allocator) const noexcept;
+
+		private:
+			ENetCommandPool* m_pool;
+	};
+}
+
+#include <Nazara/Network/ENetCommandPool.inl>
+
+#endif // NAZARA_NETWORK_ENETCOMMANDPOOL_HPP
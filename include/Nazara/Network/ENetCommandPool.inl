@@ -0,0 +1,68 @@
+// Copyright (C) 2026 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#include <NazaraUtils/Assert.hpp>
+#include <new>
+
+namespace Nz
+{
+	inline ENetCommandPool::ENetCommandPool(std::size_t nodesPerBlock) :
+	m_nodesPerBlock(nodesPerBlock)
+	{
+		NazaraAssertMsg(nodesPerBlock > 0, "block must hold at least one node");
+	}
+
+	inline std::size_t ENetCommandPool::GetBlockCount() const
+	{
+		return m_blocks.size();
+	}
+
+
+	template<typename T>
+	ENetCommandAllocator<T>::ENetCommandAllocator(ENetCommandPool* pool) noexcept :
+	m_pool(pool)
+	{
+	}
+
+	template<typename T>
+	template<typename U>
+	ENetCommandAllocator<T>::ENetCommandAllocator(const ENetCommandAllocator<U>& allocator) noexcept :
+	m_pool(allocator.m_pool)
+	{
+	}
+
+	template<typename T>
+	T* ENetCommandAllocator<T>::allocate(std::size_t n)
+	{
+		// lists only ever allocate their nodes one by one, anything else goes through the global allocator
+		if (n != 1 || alignof(T) > alignof(std::max_align_t))
+			return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(alignof(T))));
+
+		NazaraAssertMsg(m_pool, "allocator has no pool");
+		return static_cast<T*>(m_pool->Allocate(sizeof(T)));
+	}
+
+	template<typename T>
+	void ENetCommandAllocator<T>::deallocate(T* ptr, std::size_t n) noexcept
+	{
+		if (n != 1 || alignof(T) > alignof(std::max_align_t))
+			return ::operator delete(ptr, std::align_val_t(alignof(T)));
+
+		m_pool->Free(ptr, sizeof(T));
+	}
+
+	template<typename T>
+	template<typename U>
+	bool ENetCommandAllocator<T>::operator==(const ENetCommandAllocator<U>& allocator) const noexcept
+	{
+		return m_pool == allocator.m_pool;
+	}
+
+	template<typename T>
+	template<typename U>
+	bool ENetCommandAllocator<T>::operator!=(const ENetCommandAllocator<U>& allocator) const noexcept
+	{
+		return !operator==(allocator);
+	}
+}
@@ -22,8 +22,10 @@
 #define NAZARA_NETWORK_ENETCOMPRESSOR_HPP
 
 #include <NazaraUtils/Prerequisites.hpp>
+#include <Nazara/Core/ByteArray.hpp>
 #include <Nazara/Network/Export.hpp>
 #include <Nazara/Network/NetBuffer.hpp>
+#include <span>
 
 namespace Nz
 {
@@ -37,6 +39,8 @@ namespace Nz
 
 			virtual std::size_t Compress(const ENetPeer* peer, const NetBuffer* buffers, std::size_t bufferCount, std::size_t totalInputSize, UInt8* output, std::size_t maxOutputSize) = 0;
 			virtual std::size_t Decompress(const ENetPeer* peer, const UInt8* input, std::size_t inputSize, UInt8* output, std::size_t maxOutputSize) = 0;
+
+			static ByteArray TrainDictionary(std::span<const ByteArray> samples, std::size_t maxDictionarySize = 16 * 1024);
 	};
 }
 
@@ -20,11 +20,13 @@
 #include <NazaraUtils/Prerequisites.hpp>
 #include <Nazara/Core/ByteArray.hpp>
 #include <Nazara/Core/Clock.hpp>
+#include <Nazara/Network/ENetCommandPool.hpp>
 #include <Nazara/Network/ENetCompressor.hpp>
 #include <Nazara/Network/ENetPeer.hpp>
 #include <Nazara/Network/ENetProtocol.hpp>
 #include <Nazara/Network/IpAddress.hpp>
 #include <Nazara/Network/NetBuffer.hpp>
+#include <Nazara/Network/NetDatagram.hpp>
 #include <Nazara/Network/SocketPoller.hpp>
 #include <Nazara/Network/UdpSocket.hpp>
 #include <NazaraUtils/Flags.hpp>
@@ -63,9 +65,15 @@ namespace Nz
 
 			inline bool DoesAllowIncomingConnections() const;
 
+			inline void EnablePortReuse(bool reusePort = true);
+
 			void Flush();
 
 			inline IpAddress GetBoundAddress() const;
+			inline double GetCompressionRatio() const;
+			inline Time GetCompressionTime() const;
+			inline double GetDecompressionRatio() const;
+			inline Time GetDecompressionTime() const;
 			inline UInt32 GetServiceTime() const;
 			inline UInt32 GetTotalReceivedPackets() const;
 			inline UInt64 GetTotalReceivedData() const;
@@ -85,10 +93,13 @@ namespace Nz
 			bool InitSocket(const IpAddress& address);
 
 			void AddToDispatchQueue(ENetPeer* peer);
+			void AddToSendQueue(ENetPeer* peer);
 			void RemoveFromDispatchQueue(ENetPeer* peer);
 
 			bool DispatchIncomingCommands(ENetEvent* event);
 
+			int FlushSendBatch(ENetEvent* event);
+
 			ENetPeer* HandleConnect(ENetProtocolHeader* header, ENetProtocol* command);
 			bool HandleIncomingCommands(ENetEvent* event);
 
@@ -97,6 +108,13 @@ namespace Nz
 			void NotifyConnect(ENetPeer* peer, ENetEvent* event, bool incoming);
 			void NotifyDisconnect(ENetPeer*, ENetEvent* event, bool timeout);
 
+			void QueueDatagram(ENetPeer* peer);
+
+			void RecordCompression(ENetPeer* peer, std::size_t uncompressedSize, std::size_t compressedSize, Time duration);
+			void RecordDecompression(ENetPeer* peer, std::size_t compressedSize, std::size_t uncompressedSize, Time duration);
+
+			void SchedulePeer(ENetPeer* peer, UInt32 serviceTime);
+
 			void SendAcknowledgements(ENetPeer* peer);
 			bool SendReliableOutgoingCommands(ENetPeer* peer);
 			int SendOutgoingCommands(ENetEvent* event, bool checkForTimeouts);
@@ -105,11 +123,20 @@ namespace Nz
 			void ThrottleBandwidth();
 
 			inline void UpdateServiceTime();
+			void UpdateTimerWheel();
 
 			static std::size_t GetCommandSize(UInt8 commandNumber);
 			static bool Initialize();
 			static void Uninitialize();
 
+			struct DatagramBatch
+			{
+				std::array<NetBuffer, ENetConstants::ENetHost_DatagramBatchSize> buffers;
+				std::array<NetDatagram, ENetConstants::ENetHost_DatagramBatchSize> datagrams;
+				std::size_t count = 0;
+				std::vector<UInt8> data; //< ENetProtocol_MaximumMTU bytes per datagram
+			};
+
 			struct PendingIncomingPacket
 			{
 				ByteArray data;
@@ -126,6 +153,8 @@ namespace Nz
 
 			std::array<ENetProtocol, ENetConstants::ENetProtocol_MaximumPacketCommands> m_commands;
 			std::array<NetBuffer, ENetConstants::ENetProtocol_MaximumPacketCommands * 2 + 1> m_buffers;
+			std::array<ENetPeer*, ENetConstants::ENetHost_DatagramBatchSize> m_sendBatchPeers;
+			std::array<std::vector<UInt16>, ENetConstants::ENetHost_TimerWheelSize> m_timerWheel; //< peer ids indexed by service time (in milliseconds)
 			std::array<UInt8, ENetConstants::ENetProtocol_MaximumMTU> m_packetData[2];
 			std::bernoulli_distribution m_packetLossProbability;
 			std::size_t m_bandwidthLimitedPeers;
@@ -137,18 +166,26 @@ namespace Nz
 			std::size_t m_maximumWaitingData;
 			std::size_t m_packetSize;
 			std::size_t m_peerCount;
+			std::size_t m_receiveBatchIndex;
 			std::size_t m_receivedDataLength;
 			std::uniform_int_distribution<UInt16> m_packetDelayDistribution;
 			std::unique_ptr<ENetCompressor> m_compressor;
 			std::vector<ENetPeer> m_peers;
+			std::unique_ptr<ENetCommandPool> m_commandPool; //< must outlive peers queues, heap-allocated so its address survives host moves
 			std::vector<PendingIncomingPacket> m_pendingIncomingPackets;
 			std::vector<PendingOutgoingPacket> m_pendingOutgoingPackets;
 			MovablePtr<UInt8> m_receivedData;
+			Bitset<UInt64> m_activePeers;
 			Bitset<UInt64> m_dispatchQueue;
+			Bitset<UInt64> m_sendQueue;
+			DatagramBatch m_receiveBatch;
+			DatagramBatch m_sendBatch;
 			MemoryPool<ENetPacket> m_packetPool;
 			IpAddress m_address;
 			IpAddress m_receivedAddress;
 			SocketPoller m_poller;
+			Time m_compressionTime;
+			Time m_decompressionTime;
 			UdpSocket m_socket;
 			UInt16 m_headerFlags;
 			UInt32 m_bandwidthThrottleEpoch;
@@ -158,13 +195,19 @@ namespace Nz
 			UInt32 m_incomingBandwidth;
 			UInt32 m_outgoingBandwidth;
 			UInt32 m_serviceTime;
+			UInt32 m_timerWheelTime;
 			UInt32 m_totalSentPackets;
 			UInt32 m_totalReceivedPackets;
+			UInt64 m_totalCompressedReceivedData;
+			UInt64 m_totalCompressedSentData;
 			UInt64 m_totalSentData;
+			UInt64 m_totalUncompressedReceivedData;
+			UInt64 m_totalUncompressedSentData;
 			UInt64 m_totalReceivedData;
 			bool m_allowsIncomingConnections;
 			bool m_continueSending;
 			bool m_isUsingDualStack;
+			bool m_isUsingPortReuse;
 			bool m_isSimulationEnabled;
 			bool m_recalculateBandwidthLimits;
 
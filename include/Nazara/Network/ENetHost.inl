@@ -2,13 +2,16 @@
 // This file is part of the "Nazara Engine - Network module"
 // For conditions of distribution and use, see copyright notice in Export.hpp
 
+#include <memory>
 #include <utility>
 
 namespace Nz
 {
 	inline ENetHost::ENetHost() :
+	m_commandPool(std::make_unique<ENetCommandPool>()),
 	m_packetPool(sizeof(ENetPacket)),
 	m_isUsingDualStack(false),
+	m_isUsingPortReuse(false),
 	m_isSimulationEnabled(false)
 	{
 	}
@@ -64,6 +67,13 @@ namespace Nz
 	{
 		m_poller.Clear();
 		m_peers.clear();
+		m_activePeers.Clear();
+		m_dispatchQueue.Clear();
+		m_sendQueue.Clear();
+
+		for (auto& slot : m_timerWheel)
+			slot.clear();
+
 		m_socket.Close();
 	}
 
@@ -72,11 +82,45 @@ namespace Nz
 		return m_allowsIncomingConnections;
 	}
 
+	inline void ENetHost::EnablePortReuse(bool reusePort)
+	{
+		// Must be set before Create, hosts sharing a port get incoming datagrams balanced by the system (Linux only)
+		m_isUsingPortReuse = reusePort;
+	}
+
 	inline IpAddress ENetHost::GetBoundAddress() const
 	{
 		return m_address;
 	}
 
+	inline double ENetHost::GetCompressionRatio() const
+	{
+		// Size on the wire relative to the uncompressed size of sent datagrams (datagrams the compressor declined count as 1)
+		if (m_totalUncompressedSentData == 0)
+			return 1.0;
+
+		return static_cast<double>(m_totalCompressedSentData) / m_totalUncompressedSentData;
+	}
+
+	inline Time ENetHost::GetCompressionTime() const
+	{
+		return m_compressionTime;
+	}
+
+	inline double ENetHost::GetDecompressionRatio() const
+	{
+		// Size on the wire relative to the uncompressed size of received datagrams (datagrams received uncompressed count as 1)
+		if (m_totalUncompressedReceivedData == 0)
+			return 1.0;
+
+		return static_cast<double>(m_totalCompressedReceivedData) / m_totalUncompressedReceivedData;
+	}
+
+	inline Time ENetHost::GetDecompressionTime() const
+	{
+		return m_decompressionTime;
+	}
+
 	inline UInt32 ENetHost::GetServiceTime() const
 	{
 		return m_serviceTime;
@@ -0,0 +1,41 @@
+// Copyright (C) 2026 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#pragma once
+
+#ifndef NAZARA_NETWORK_ENETLZ4COMPRESSOR_HPP
+#define NAZARA_NETWORK_ENETLZ4COMPRESSOR_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <Nazara/Core/ByteArray.hpp>
+#include <Nazara/Network/ENetCompressor.hpp>
+#include <Nazara/Network/Export.hpp>
+#include <memory>
+
+namespace Nz
+{
+	// Fast compression of each datagram, best suited for servers with many peers
+	class NAZARA_NETWORK_API ENetLz4Compressor final : public ENetCompressor
+	{
+		public:
+			explicit ENetLz4Compressor(int acceleration = 1);
+			explicit ENetLz4Compressor(ByteArray dictionary, int acceleration = 1);
+			ENetLz4Compressor(const ENetLz4Compressor&) = delete;
+			ENetLz4Compressor(ENetLz4Compressor&&) = delete;
+			~ENetLz4Compressor();
+
+			std::size_t Compress(const ENetPeer* peer, const NetBuffer* buffers, std::size_t bufferCount, std::size_t totalInputSize, UInt8* output, std::size_t maxOutputSize) override;
+			std::size_t Decompress(const ENetPeer* peer, const UInt8* input, std::size_t inputSize, UInt8* output, std::size_t maxOutputSize) override;
+
+			ENetLz4Compressor& operator=(const ENetLz4Compressor&) = delete;
+			ENetLz4Compressor& operator=(ENetLz4Compressor&&) = delete;
+
+		private:
+			struct Data;
+
+			std::unique_ptr<Data> m_data;
+	};
+}
+
+#endif // NAZARA_NETWORK_ENETLZ4COMPRESSOR_HPP
@@ -18,6 +18,8 @@
 #define NAZARA_NETWORK_ENETPEER_HPP
 
 #include <NazaraUtils/Prerequisites.hpp>
+#include <Nazara/Core/Time.hpp>
+#include <Nazara/Network/ENetCommandPool.hpp>
 #include <Nazara/Network/ENetPacket.hpp>
 #include <Nazara/Network/ENetProtocol.hpp>
 #include <Nazara/Network/IpAddress.hpp>
@@ -38,7 +40,7 @@ namespace Nz
 		friend struct PacketRef;
 
 		public:
-			inline ENetPeer(ENetHost* host, UInt16 peerId);
+			ENetPeer(ENetHost* host, UInt16 peerId);
 			ENetPeer(const ENetPeer&) = delete;
 			ENetPeer(ENetPeer&&) = default;
 			~ENetPeer() = default;
@@ -48,6 +50,10 @@ namespace Nz
 			void DisconnectNow(UInt32 data);
 
 			inline const IpAddress& GetAddress() const;
+			inline double GetCompressionRatio() const;
+			inline Time GetCompressionTime() const;
+			inline double GetDecompressionRatio() const;
+			inline Time GetDecompressionTime() const;
 			inline UInt32 GetLastReceiveTime() const;
 			inline UInt32 GetMtu() const;
 			inline UInt32 GetPacketThrottleAcceleration() const;
@@ -91,6 +97,9 @@ namespace Nz
 			struct IncomingCommmand;
 			struct OutgoingCommand;
 
+			using IncomingCommandList = std::list<IncomingCommmand, ENetCommandAllocator<IncomingCommmand>>;
+			using OutgoingCommandList = std::list<OutgoingCommand, ENetCommandAllocator<OutgoingCommand>>;
+
 			inline void ChangeState(ENetPeerState state);
 
 			bool CheckTimeouts(ENetEvent* event);
@@ -119,6 +128,7 @@ namespace Nz
 			void RemoveSentUnreliableCommands();
 
 			void ResetQueues();
+			void ResizeChannels(std::size_t channelCount);
 
 			bool QueueAcknowledgement(ENetProtocol* command, UInt16 sentTime);
 			IncomingCommmand* QueueIncomingCommand(const ENetProtocol& command, const void* data, std::size_t dataLength, ENetPacketFlags flags, UInt32 fragmentCount);
@@ -137,7 +147,9 @@ namespace Nz
 
 			struct Channel
 			{
-				Channel()
+				Channel(ENetCommandPool* commandPool) :
+				incomingReliableCommands(commandPool),
+				incomingUnreliableCommands(commandPool)
 				{
 					incomingReliableSequenceNumber = 0;
 					incomingUnreliableSequenceNumber = 0;
@@ -148,8 +160,8 @@ namespace Nz
 				}
 
 				std::array<UInt16, ENetPeer_ReliableWindows> reliableWindows;
-				std::list<IncomingCommmand>                  incomingReliableCommands;
-				std::list<IncomingCommmand>                  incomingUnreliableCommands;
+				IncomingCommandList                          incomingReliableCommands;
+				IncomingCommandList                          incomingUnreliableCommands;
 				UInt16                                       incomingReliableSequenceNumber;
 				UInt16                                       incomingUnreliableSequenceNumber;
 				UInt16                                       outgoingReliableSequenceNumber;
@@ -187,11 +199,11 @@ namespace Nz
 			IpAddress                             m_address; //< Internet address of the peer
 			std::array<UInt32, unsequencedWindow> m_unsequencedWindow;
 			std::bernoulli_distribution           m_packetLossProbability;
-			std::list<IncomingCommmand>           m_dispatchedCommands;
-			std::list<OutgoingCommand>            m_outgoingReliableCommands;
-			std::list<OutgoingCommand>            m_outgoingUnreliableCommands;
-			std::list<OutgoingCommand>            m_sentReliableCommands;
-			std::list<OutgoingCommand>            m_sentUnreliableCommands;
+			IncomingCommandList                   m_dispatchedCommands;
+			OutgoingCommandList                   m_outgoingReliableCommands;
+			OutgoingCommandList                   m_outgoingUnreliableCommands;
+			OutgoingCommandList                   m_sentReliableCommands;
+			OutgoingCommandList                   m_sentUnreliableCommands;
 			std::size_t                           m_totalWaitingData;
 			std::uniform_int_distribution<UInt16> m_packetDelayDistribution;
 			std::vector<Acknowledgement>          m_acknowledgements;
@@ -217,6 +229,7 @@ namespace Nz
 			UInt32                                m_lastSendTime;
 			UInt32                                m_lowestRoundTripTime;
 			UInt32                                m_mtu;
+			UInt32                                m_nextServiceTime;
 			UInt32                                m_nextTimeout;
 			UInt32                                m_outgoingBandwidth;  /**< Upstream bandwidth of the client in bytes/second */
 			UInt32                                m_outgoingBandwidthThrottleEpoch;
@@ -246,7 +259,14 @@ namespace Nz
 			UInt32                                m_windowSize;
 			UInt64                                m_totalByteReceived;
 			UInt64                                m_totalByteSent;
+			UInt64                                m_totalCompressedReceivedData;
+			UInt64                                m_totalCompressedSentData;
+			UInt64                                m_totalUncompressedReceivedData;
+			UInt64                                m_totalUncompressedSentData;
+			Time                                  m_compressionTime;
+			Time                                  m_decompressionTime;
 			bool                                  m_canTimeout;
+			bool                                  m_isServiceScheduled;
 			bool                                  m_isSimulationEnabled;
 			bool                                  m_timedOut;
 	};
@@ -5,21 +5,35 @@
 
 namespace Nz
 {
-	inline ENetPeer::ENetPeer(ENetHost* host, UInt16 peerId) :
-	m_host(host),
-	m_state(ENetPeerState::Disconnected),
-	m_incomingSessionID(0xFF),
-	m_outgoingSessionID(0xFF),
-	m_incomingPeerID(peerId),
-	m_canTimeout(true),
-	m_isSimulationEnabled(false)
+	inline const IpAddress& ENetPeer::GetAddress() const
 	{
-		Reset();
+		return m_address;
 	}
 
-	inline const IpAddress& ENetPeer::GetAddress() const
+	inline double ENetPeer::GetCompressionRatio() const
 	{
-		return m_address;
+		if (m_totalUncompressedSentData == 0)
+			return 1.0;
+
+		return static_cast<double>(m_totalCompressedSentData) / m_totalUncompressedSentData;
+	}
+
+	inline Time ENetPeer::GetCompressionTime() const
+	{
+		return m_compressionTime;
+	}
+
+	inline double ENetPeer::GetDecompressionRatio() const
+	{
+		if (m_totalUncompressedReceivedData == 0)
+			return 1.0;
+
+		return static_cast<double>(m_totalCompressedReceivedData) / m_totalUncompressedReceivedData;
+	}
+
+	inline Time ENetPeer::GetDecompressionTime() const
+	{
+		return m_decompressionTime;
 	}
 
 	inline UInt32 ENetPeer::GetLastReceiveTime() const
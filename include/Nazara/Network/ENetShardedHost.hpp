@@ -0,0 +1,74 @@
+// Copyright (C) 2026 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#pragma once
+
+#ifndef NAZARA_NETWORK_ENETSHARDEDHOST_HPP
+#define NAZARA_NETWORK_ENETSHARDEDHOST_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <Nazara/Core/ByteArray.hpp>
+#include <Nazara/Network/ENetPacket.hpp>
+#include <Nazara/Network/ENetProtocol.hpp>
+#include <Nazara/Network/Export.hpp>
+#include <Nazara/Network/IpAddress.hpp>
+#include <memory>
+
+namespace Nz
+{
+	// Server host spreading its peers over multiple ENetHost, each one serviced by its own thread
+	class NAZARA_NETWORK_API ENetShardedHost
+	{
+		public:
+			struct Event;
+
+			ENetShardedHost();
+			ENetShardedHost(const ENetShardedHost&) = delete;
+			ENetShardedHost(ENetShardedHost&&) = delete;
+			~ENetShardedHost();
+
+			void Broadcast(UInt8 channelId, ENetPacketFlags flags, ByteArray&& packet);
+
+			bool Create(const IpAddress& listenAddress, std::size_t shardCount, std::size_t peerCountPerShard, std::size_t channelCount = 0);
+			void Destroy();
+
+			void Disconnect(UInt64 peerId, UInt32 data = 0);
+
+			IpAddress GetBoundAddress() const;
+			std::size_t GetShardCount() const;
+
+			bool PollEvent(Event* event);
+
+			void Send(UInt64 peerId, UInt8 channelId, ENetPacketFlags flags, ByteArray&& packet);
+
+			ENetShardedHost& operator=(const ENetShardedHost&) = delete;
+			ENetShardedHost& operator=(ENetShardedHost&&) = delete;
+
+			static constexpr UInt64 BuildPeerId(std::size_t shardIndex, UInt16 peerIndex, UInt32 generation);
+			static constexpr UInt32 GetGeneration(UInt64 peerId);
+			static constexpr std::size_t GetPeerIndex(UInt64 peerId);
+			static constexpr std::size_t GetShardIndex(UInt64 peerId);
+
+			struct Event
+			{
+				ByteArray data; //< packet content (receive events only)
+				ENetEventType type = ENetEventType::None;
+				UInt32 eventData = 0;
+				UInt64 peerId = 0; //< identifies a connection, commands targeting a disconnected peer are dropped even if its slot has been reused
+				UInt8 channelId = 0;
+			};
+
+		private:
+			struct Data;
+			struct Shard;
+
+			void RunShard(Shard& shard);
+
+			std::unique_ptr<Data> m_data;
+	};
+}
+
+#include <Nazara/Network/ENetShardedHost.inl>
+
+#endif // NAZARA_NETWORK_ENETSHARDEDHOST_HPP
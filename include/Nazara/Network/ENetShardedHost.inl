@@ -0,0 +1,26 @@
+// Copyright (C) 2026 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+namespace Nz
+{
+	constexpr UInt64 ENetShardedHost::BuildPeerId(std::size_t shardIndex, UInt16 peerIndex, UInt32 generation)
+	{
+		return (UInt64(generation) << 32) | (UInt64(shardIndex & 0xFFFF) << 16) | peerIndex;
+	}
+
+	constexpr UInt32 ENetShardedHost::GetGeneration(UInt64 peerId)
+	{
+		return static_cast<UInt32>(peerId >> 32);
+	}
+
+	constexpr std::size_t ENetShardedHost::GetPeerIndex(UInt64 peerId)
+	{
+		return peerId & 0xFFFF;
+	}
+
+	constexpr std::size_t ENetShardedHost::GetShardIndex(UInt64 peerId)
+	{
+		return (peerId >> 16) & 0xFFFF;
+	}
+}
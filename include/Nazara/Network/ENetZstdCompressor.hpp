@@ -0,0 +1,41 @@
+// Copyright (C) 2026 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#pragma once
+
+#ifndef NAZARA_NETWORK_ENETZSTDCOMPRESSOR_HPP
+#define NAZARA_NETWORK_ENETZSTDCOMPRESSOR_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <Nazara/Core/ByteArray.hpp>
+#include <Nazara/Network/ENetCompressor.hpp>
+#include <Nazara/Network/Export.hpp>
+#include <memory>
+
+namespace Nz
+{
+	// Higher compression ratio than LZ4 for a higher CPU cost, best suited when bandwidth is the bottleneck
+	class NAZARA_NETWORK_API ENetZstdCompressor final : public ENetCompressor
+	{
+		public:
+			explicit ENetZstdCompressor(int compressionLevel = 3);
+			explicit ENetZstdCompressor(ByteArray dictionary, int compressionLevel = 3);
+			ENetZstdCompressor(const ENetZstdCompressor&) = delete;
+			ENetZstdCompressor(ENetZstdCompressor&&) = delete;
+			~ENetZstdCompressor();
+
+			std::size_t Compress(const ENetPeer* peer, const NetBuffer* buffers, std::size_t bufferCount, std::size_t totalInputSize, UInt8* output, std::size_t maxOutputSize) override;
+			std::size_t Decompress(const ENetPeer* peer, const UInt8* input, std::size_t inputSize, UInt8* output, std::size_t maxOutputSize) override;
+
+			ENetZstdCompressor& operator=(const ENetZstdCompressor&) = delete;
+			ENetZstdCompressor& operator=(ENetZstdCompressor&&) = delete;
+
+		private:
+			struct Data;
+
+			std::unique_ptr<Data> m_data;
+	};
+}
+
+#endif // NAZARA_NETWORK_ENETZSTDCOMPRESSOR_HPP
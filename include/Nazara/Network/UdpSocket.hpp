@@ -14,6 +14,7 @@
 namespace Nz
 {
 	struct NetBuffer;
+	struct NetDatagram;
 
 	class NAZARA_NETWORK_API UdpSocket : public AbstractSocket
 	{
@@ -29,6 +30,7 @@ namespace Nz
 			inline bool Create(NetProtocol protocol);
 
 			void EnableBroadcasting(bool broadcasting);
+			bool EnablePortReuse(bool reusePort);
 
 			inline IpAddress GetBoundAddress() const;
 			inline UInt16 GetBoundPort() const;
@@ -37,10 +39,14 @@ namespace Nz
 
 			std::size_t QueryMaxDatagramSize();
 
+			static bool IsPortReuseSupported();
+
 			bool Receive(void* buffer, std::size_t size, IpAddress* from, std::size_t* received);
+			bool ReceiveBatch(NetDatagram* datagrams, std::size_t datagramCount, std::size_t* receivedCount);
 			bool ReceiveMultiple(NetBuffer* buffers, std::size_t bufferCount, IpAddress* from, std::size_t* received);
 
 			bool Send(const IpAddress& to, const void* buffer, std::size_t size, std::size_t* sent);
+			bool SendBatch(NetDatagram* datagrams, std::size_t datagramCount, std::size_t* sentCount);
 			bool SendMultiple(const IpAddress& to, const NetBuffer* buffers, std::size_t bufferCount, std::size_t* sent);
 
 			UdpSocket& operator=(const UdpSocket& udpSocket) = delete;
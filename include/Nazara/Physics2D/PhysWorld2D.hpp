@@ -11,6 +11,7 @@
 #include <Nazara/Core/Color.hpp>
 #include <Nazara/Core/Time.hpp>
 #include <Nazara/Math/Angle.hpp>
+#include <Nazara/Math/Rect.hpp>
 #include <Nazara/Math/Vector2.hpp>
 #include <Nazara/Physics2D/Export.hpp>
 #include <Nazara/Physics2D/RigidBody2D.hpp>
@@ -19,6 +20,7 @@
 #include <NazaraUtils/Signal.hpp>
 #include <functional>
 #include <memory>
+#include <span>
 #include <unordered_map>
 #include <vector>
 
@@ -28,6 +30,7 @@ struct cpSpace;
 namespace Nz
 {
 	class PhysArbiter2D;
+	class TaskScheduler;
 
 	class NAZARA_PHYSICS2D_API PhysWorld2D
 	{
@@ -49,6 +52,7 @@ namespace Nz
 			struct ContactCallbacks;
 			struct DebugDrawOptions;
 			struct NearestQueryResult;
+			struct Raycast;
 			struct RaycastHit;
 
 			PhysWorld2D();
@@ -63,17 +67,23 @@ namespace Nz
 			cpSpace* GetHandle() const;
 			std::size_t GetIterationCount() const;
 			std::size_t GetMaxStepCount() const;
+			std::size_t GetSolverThreadCount() const;
 			Time GetStepSize() const;
+			TaskScheduler* GetTaskScheduler() const;
+			Time GetTimestepAccumulator() const;
 
 			bool NearestBodyQuery(const Vector2f& from, float maxDistance, UInt32 collisionGroup, UInt32 categoryMask, UInt32 collisionMask, RigidBody2D** nearestBody = nullptr);
 			bool NearestBodyQuery(const Vector2f& from, float maxDistance, UInt32 collisionGroup, UInt32 categoryMask, UInt32 collisionMask, NearestQueryResult* result);
+			std::size_t NearestBodyQueryBatch(std::span<const Vector2f> positions, float maxDistance, UInt32 collisionGroup, UInt32 categoryMask, UInt32 collisionMask, std::span<NearestQueryResult> results) const;
 
 			void RaycastQuery(const Vector2f& from, const Vector2f& to, float radius, UInt32 collisionGroup, UInt32 categoryMask, UInt32 collisionMask, const FunctionRef<void(const RaycastHit&)>& callback);
 			bool RaycastQuery(const Vector2f& from, const Vector2f& to, float radius, UInt32 collisionGroup, UInt32 categoryMask, UInt32 collisionMask, std::vector<RaycastHit>* hitInfos);
 			bool RaycastQueryFirst(const Vector2f& from, const Vector2f& to, float radius, UInt32 collisionGroup, UInt32 categoryMask, UInt32 collisionMask, RaycastHit* hitInfo = nullptr);
+			std::size_t RaycastQueryFirstBatch(std::span<const Raycast> raycasts, UInt32 collisionGroup, UInt32 categoryMask, UInt32 collisionMask, std::span<RaycastHit> hits) const;
 
 			void RegionQuery(const Rectf& boundingBox, UInt32 collisionGroup, UInt32 categoryMask, UInt32 collisionMask, const FunctionRef<void(RigidBody2D*)>& callback);
 			void RegionQuery(const Rectf& boundingBox, UInt32 collisionGroup, UInt32 categoryMask, UInt32 collisionMask, std::vector<RigidBody2D*>* bodies);
+			std::size_t RegionQueryBatch(std::span<const Rectf> boundingBoxes, UInt32 collisionGroup, UInt32 categoryMask, UInt32 collisionMask, std::span<RigidBody2D*> bodies, std::size_t maxBodiesPerQuery, std::span<std::size_t> bodyCounts) const;
 
 			void RegisterCallbacks(unsigned int collisionId, ContactCallbacks callbacks);
 			void RegisterCallbacks(unsigned int collisionIdA, unsigned int collisionIdB, ContactCallbacks callbacks);
@@ -83,7 +93,9 @@ namespace Nz
 			void SetIterationCount(std::size_t iterationCount);
 			void SetMaxStepCount(std::size_t maxStepCount);
 			void SetSleepTime(Time sleepTime);
+			void SetSolverThreadCount(std::size_t threadCount);
 			void SetStepSize(Time stepSize);
+			void SetTaskScheduler(TaskScheduler* taskScheduler);
 
 			void Step(Time timestep);
 
@@ -125,6 +137,13 @@ namespace Nz
 				float distance;
 			};
 
+			struct Raycast
+			{
+				Vector2f from;
+				Vector2f to;
+				float radius = 0.f;
+			};
+
 			struct RaycastHit
 			{
 				RigidBody2D* nearestBody;
@@ -148,13 +167,16 @@ namespace Nz
 			inline void UpdateBodyPointer(RigidBody2D& rigidBody);
 
 			std::size_t m_maxStepCount;
+			std::size_t m_solverThreadCount;
 			std::unordered_map<cpCollisionHandler*, std::unique_ptr<ContactCallbacks>> m_callbacks;
 			std::unordered_map<UInt32, std::vector<PostStep>> m_rigidBodyPostSteps;
 			std::vector<RigidBody2D*> m_bodies;
 			cpSpace* m_handle;
 			Bitset<UInt64> m_freeBodyIndices;
+			TaskScheduler* m_taskScheduler;
 			Time m_stepSize;
 			Time m_timestepAccumulator;
+			bool m_usesSpatialHash;
 	};
 }
 
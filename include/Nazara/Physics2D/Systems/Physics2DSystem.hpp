@@ -12,6 +12,7 @@
 #include <Nazara/Core/Time.hpp>
 #include <Nazara/Physics2D/PhysWorld2D.hpp>
 #include <Nazara/Physics2D/Components/RigidBody2DComponent.hpp>
+#include <NazaraUtils/Bitset.hpp>
 #include <NazaraUtils/TypeList.hpp>
 #include <entt/entt.hpp>
 
@@ -37,10 +38,14 @@ namespace Nz
 			Physics2DSystem(Physics2DSystem&&) = delete;
 			~Physics2DSystem();
 
+			void EnableTransformInterpolation(bool enable = true);
+
 			inline PhysWorld2D& GetPhysWorld();
 			inline const PhysWorld2D& GetPhysWorld() const;
 			inline entt::handle GetRigidBodyEntity(UInt32 bodyIndex) const;
 
+			inline bool IsTransformInterpolationEnabled() const;
+
 			inline bool NearestBodyQuery(const Vector2f& from, float maxDistance, UInt32 collisionGroup, UInt32 categoryMask, UInt32 collisionMask, entt::handle* nearestEntity = nullptr);
 			inline bool NearestBodyQuery(const Vector2f& from, float maxDistance, UInt32 collisionGroup, UInt32 categoryMask, UInt32 collisionMask, NearestQueryResult* result);
 
@@ -79,16 +84,34 @@ namespace Nz
 			};
 
 		private:
+			void CapturePreviousTransforms();
 			void OnBodyConstruct(entt::registry& registry, entt::entity entity);
 			void OnBodyDestruct(entt::registry& registry, entt::entity entity);
 			PhysWorld2D::ContactCallbacks SetupContactCallbacks(ContactCallbacks callbacks);
 
+			// Poses of the two last physics steps, indexed by body index
+			struct InterpolationData
+			{
+				std::vector<Vector2f> currentPositions;
+				std::vector<Vector2f> previousPositions;
+				std::vector<float> currentRotations;
+				std::vector<float> previousRotations;
+				Bitset<UInt64> capturedBodies;
+				Bitset<UInt64> interpolatedBodies; //< bodies which moved during one of the two last steps
+				Bitset<UInt64> movingBodies; //< bodies which moved during the last step
+			};
+
+			NazaraSlot(PhysWorld2D, OnPhysWorld2DPreStep, m_onPreStep);
+
 			std::vector<entt::entity> m_bodyIndicesToEntity;
 			entt::registry& m_registry;
 			entt::scoped_connection m_bodyConstructConnection;
 			entt::scoped_connection m_bodyDestructConnection;
 			EnttObserver<TypeList<class RigidBody2DComponent, class NodeComponent>, TypeList<class DisabledComponent>> m_physicsObserver;
+			InterpolationData m_interpolation;
 			PhysWorld2D m_physWorld;
+			bool m_hasStepped;
+			bool m_transformInterpolation;
 	};
 }
 
@@ -20,6 +20,11 @@ namespace Nz
 		return entt::handle(m_registry, m_bodyIndicesToEntity[bodyIndex]);
 	}
 
+	inline bool Physics2DSystem::IsTransformInterpolationEnabled() const
+	{
+		return m_transformInterpolation;
+	}
+
 	inline bool Physics2DSystem::NearestBodyQuery(const Vector2f& from, float maxDistance, UInt32 collisionGroup, UInt32 categoryMask, UInt32 collisionMask, entt::handle* nearestEntity)
 	{
 		RigidBody2D* nearestBody;
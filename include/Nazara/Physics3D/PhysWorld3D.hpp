@@ -10,6 +10,8 @@
 #include <NazaraUtils/Prerequisites.hpp>
 #include <Nazara/Core/Time.hpp>
 #include <Nazara/Math/Box.hpp>
+#include <Nazara/Math/Matrix4.hpp>
+#include <Nazara/Math/Quaternion.hpp>
 #include <Nazara/Math/Vector3.hpp>
 #include <Nazara/Physics3D/Export.hpp>
 #include <Nazara/Physics3D/PhysFilter3D.hpp>
@@ -17,6 +19,7 @@
 #include <NazaraUtils/MovablePtr.hpp>
 #include <atomic>
 #include <optional>
+#include <span>
 #include <vector>
 
 namespace JPH
@@ -45,8 +48,11 @@ namespace Nz
 		public:
 			struct ContactListener;
 			struct PointCollisionInfo;
+			struct Raycast;
 			struct RaycastHit;
 			struct Settings;
+			struct Shapecast;
+			struct ShapecastHit;
 			struct ShapeCollisionInfo;
 
 			PhysWorld3D(Settings&& settings = BuildDefaultSettings());
@@ -59,6 +65,7 @@ namespace Nz
 			bool CollisionQuery(const Collider3D& collider, const Matrix4f& colliderTransform, const Vector3f& colliderScale, const FunctionRef<std::optional<float>(const ShapeCollisionInfo& hitInfo)>& callback, const PhysBroadphaseLayerFilter3D* broadphaseFilter = nullptr, const PhysObjectLayerFilter3D* objectLayerFilter = nullptr, const PhysBodyFilter3D* bodyFilter = nullptr);
 
 			UInt32 GetActiveBodyCount() const;
+			void GetActiveBodyTransforms(std::vector<UInt32>& bodyIndices, std::vector<Vector3f>& positions, std::vector<Quaternionf>& rotations) const;
 			Boxf GetBoundingBox() const;
 			Vector3f GetGravity() const;
 			inline std::size_t GetMaxStepCount() const;
@@ -71,6 +78,7 @@ namespace Nz
 
 			bool RaycastQuery(const Vector3f& from, const Vector3f& to, const FunctionRef<std::optional<float>(const RaycastHit& hitInfo)>& callback, const PhysBroadphaseLayerFilter3D* broadphaseFilter = nullptr, const PhysObjectLayerFilter3D* objectLayerFilter = nullptr, const PhysBodyFilter3D* bodyFilter = nullptr);
 			bool RaycastQueryFirst(const Vector3f& from, const Vector3f& to, const FunctionRef<void(const RaycastHit& hitInfo)>& callback, const PhysBroadphaseLayerFilter3D* broadphaseFilter = nullptr, const PhysObjectLayerFilter3D* objectLayerFilter = nullptr, const PhysBodyFilter3D* bodyFilter = nullptr);
+			std::size_t RaycastQueryFirstBatch(std::span<const Raycast> raycasts, std::span<RaycastHit> hits, const PhysBroadphaseLayerFilter3D* broadphaseFilter = nullptr, const PhysObjectLayerFilter3D* objectLayerFilter = nullptr, const PhysBodyFilter3D* bodyFilter = nullptr);
 
 			void RefreshBodies();
 
@@ -81,6 +89,8 @@ namespace Nz
 			inline void SetMaxStepCount(std::size_t maxStepCount);
 			void SetStepSize(Time stepSize);
 
+			std::size_t ShapecastQueryFirstBatch(const Collider3D& collider, std::span<const Shapecast> shapecasts, std::span<ShapecastHit> hits, const PhysBroadphaseLayerFilter3D* broadphaseFilter = nullptr, const PhysObjectLayerFilter3D* objectLayerFilter = nullptr, const PhysBodyFilter3D* bodyFilter = nullptr);
+
 			bool Step(Time timestep);
 
 			inline void UnregisterStepListener(PhysWorld3DStepListener* stepListener);
@@ -106,6 +116,12 @@ namespace Nz
 				PhysBody3D* hitBody = nullptr;
 			};
 
+			struct Raycast
+			{
+				Vector3f from;
+				Vector3f to;
+			};
+
 			struct RaycastHit
 			{
 				float fraction;
@@ -133,6 +149,22 @@ namespace Nz
 				unsigned int tempAllocatorSize = 10 * 1024 * 1024;
 			};
 
+			struct Shapecast
+			{
+				Matrix4f colliderTransform;
+				Vector3f displacement;
+			};
+
+			struct ShapecastHit
+			{
+				float fraction;
+				PhysBody3D* hitBody = nullptr;
+				Vector3f hitPosition;
+				Vector3f penetrationAxis;
+				float penetrationDepth;
+				UInt32 subShapeID;
+			};
+
 			struct ShapeCollisionInfo
 			{
 				PhysBody3D* hitBody = nullptr;
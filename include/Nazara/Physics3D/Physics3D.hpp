@@ -15,11 +15,12 @@
 namespace JPH
 {
 	class JobSystem;
-	class JobSystemThreadPool;
 }
 
 namespace Nz
 {
+	class TaskScheduler;
+
 	class NAZARA_PHYSICS3D_API Physics3D : public ModuleBase<Physics3D>
 	{
 		friend ModuleBase;
@@ -27,15 +28,21 @@ namespace Nz
 		public:
 			using Dependencies = TypeList<Core>;
 
-			struct Config {};
+			struct Config;
 
-			Physics3D(Config /*config*/);
+			Physics3D(Config config);
 			~Physics3D();
 
 			JPH::JobSystem& GetThreadPool();
 
+			struct Config
+			{
+				// When set, physics jobs are run by this task scheduler (which must outlive the module) instead of a dedicated thread pool
+				TaskScheduler* taskScheduler = nullptr;
+			};
+
 		private:
-			std::unique_ptr<JPH::JobSystemThreadPool> m_threadPool;
+			std::unique_ptr<JPH::JobSystem> m_threadPool;
 
 			static Physics3D* s_instance;
 	};
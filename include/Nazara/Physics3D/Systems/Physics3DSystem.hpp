@@ -12,15 +12,21 @@
 #include <Nazara/Core/EnttObserver.hpp>
 #include <Nazara/Core/Time.hpp>
 #include <Nazara/Physics3D/PhysWorld3D.hpp>
+#include <Nazara/Physics3D/PhysWorld3DStepListener.hpp>
 #include <Nazara/Physics3D/Components/PhysCharacter3DComponent.hpp>
 #include <Nazara/Physics3D/Components/RigidBody3DComponent.hpp>
+#include <NazaraUtils/Bitset.hpp>
 #include <NazaraUtils/TypeList.hpp>
 #include <entt/entt.hpp>
+#include <span>
 #include <vector>
 
 namespace Nz
 {
-	class NAZARA_PHYSICS3D_API Physics3DSystem
+	class NodeComponent;
+	class TaskScheduler;
+
+	class NAZARA_PHYSICS3D_API Physics3DSystem : private PhysWorld3DStepListener
 	{
 		public:
 			static constexpr Int64 ExecutionOrder = 0;
@@ -29,8 +35,11 @@ namespace Nz
 			struct ContactListener;
 			struct PointCollisionInfo;
 			struct RaycastHit;
+			struct ShapecastHit;
 			struct ShapeCollisionInfo;
+			using Raycast = PhysWorld3D::Raycast;
 			using Settings = PhysWorld3D::Settings;
+			using Shapecast = PhysWorld3D::Shapecast;
 
 			Physics3DSystem(entt::registry& registry, Settings&& settings = PhysWorld3D::BuildDefaultSettings());
 			Physics3DSystem(const Physics3DSystem&) = delete;
@@ -41,14 +50,23 @@ namespace Nz
 			bool CollisionQuery(const Collider3D& collider, const Matrix4f& colliderTransform, const FunctionRef<std::optional<float>(const ShapeCollisionInfo& hitInfo)>& callback, const PhysBroadphaseLayerFilter3D* broadphaseFilter = nullptr, const PhysObjectLayerFilter3D* objectLayerFilter = nullptr, const PhysBodyFilter3D* bodyFilter = nullptr);
 			bool CollisionQuery(const Collider3D& collider, const Matrix4f& colliderTransform, const Vector3f& colliderScale, const FunctionRef<std::optional<float>(const ShapeCollisionInfo& hitInfo)>& callback, const PhysBroadphaseLayerFilter3D* broadphaseFilter = nullptr, const PhysObjectLayerFilter3D* objectLayerFilter = nullptr, const PhysBodyFilter3D* bodyFilter = nullptr);
 
+			void EnableTransformInterpolation(bool enable = true);
+
 			inline PhysWorld3D& GetPhysWorld();
 			inline const PhysWorld3D& GetPhysWorld() const;
 			inline entt::handle GetRigidBodyEntity(UInt32 bodyIndex) const;
+			inline TaskScheduler* GetTaskScheduler() const;
+
+			inline bool IsTransformInterpolationEnabled() const;
 
 			bool RaycastQuery(const Vector3f& from, const Vector3f& to, const FunctionRef<std::optional<float>(const RaycastHit& hitInfo)>& callback, const PhysBroadphaseLayerFilter3D* broadphaseFilter = nullptr, const PhysObjectLayerFilter3D* objectLayerFilter = nullptr, const PhysBodyFilter3D* bodyFilter = nullptr);
 			bool RaycastQueryFirst(const Vector3f& from, const Vector3f& to, const FunctionRef<void(const RaycastHit& hitInfo)>& callback, const PhysBroadphaseLayerFilter3D* broadphaseFilter = nullptr, const PhysObjectLayerFilter3D* objectLayerFilter = nullptr, const PhysBodyFilter3D* bodyFilter = nullptr);
+			std::size_t RaycastQueryFirstBatch(std::span<const Raycast> raycasts, std::span<RaycastHit> hits, const PhysBroadphaseLayerFilter3D* broadphaseFilter = nullptr, const PhysObjectLayerFilter3D* objectLayerFilter = nullptr, const PhysBodyFilter3D* bodyFilter = nullptr);
 
 			void SetContactListener(std::unique_ptr<ContactListener> contactListener);
+			inline void SetTaskScheduler(TaskScheduler* taskScheduler);
+
+			std::size_t ShapecastQueryFirstBatch(const Collider3D& collider, std::span<const Shapecast> shapecasts, std::span<ShapecastHit> hits, const PhysBroadphaseLayerFilter3D* broadphaseFilter = nullptr, const PhysObjectLayerFilter3D* objectLayerFilter = nullptr, const PhysBodyFilter3D* bodyFilter = nullptr);
 
 			void Update(Time elapsedTime);
 
@@ -76,20 +94,73 @@ namespace Nz
 				entt::handle hitEntity;
 			};
 
+			struct ShapecastHit : PhysWorld3D::ShapecastHit
+			{
+				entt::handle hitEntity;
+			};
+
 			struct ShapeCollisionInfo : PhysWorld3D::ShapeCollisionInfo
 			{
 				entt::handle hitEntity;
 			};
 
 		private:
+			void ApplyNodeTransforms();
+
+			template<typename T> void CapturePreviousTransforms();
+
+			void InterpolateEntities(float interpolation);
+
 			void OnBodyConstruct(entt::registry& registry, entt::entity entity);
 			void OnBodyDestruct(entt::registry& registry, entt::entity entity);
 			void OnCharacterConstruct(entt::registry& registry, entt::entity entity);
 			void OnCharacterDestruct(entt::registry& registry, entt::entity entity);
 
-			template<typename T> void ReplicateEntities();
+			void PreSimulate(float elapsedTime) override;
+
+			void ReplicateEntities();
+			template<typename T> void ReplicateEntity(T& bodyComponent, NodeComponent& nodeComponent, const Vector3f& position, const Quaternionf& rotation);
+
+			void StoreInterpolatedTransform(UInt32 bodyIndex, const Vector3f& position, const Quaternionf& rotation);
+
+			template<typename F> bool VisitBodyComponent(UInt32 bodyIndex, F&& func);
+
+			// Poses of the two last physics steps, indexed by body index
+			struct InterpolationData
+			{
+				std::vector<Quaternionf> currentRotations;
+				std::vector<Quaternionf> previousRotations;
+				std::vector<Vector3f> currentPositions;
+				std::vector<Vector3f> previousPositions;
+				Bitset<UInt64> capturedBodies;
+				Bitset<UInt64> interpolatedBodies; //< bodies which moved during one of the two last steps
+				Bitset<UInt64> movingBodies; //< bodies which moved during the last step
+				Bitset<UInt64> updatedBodies; //< bodies whose current pose was stored by the last replication
+			};
+
+			struct NodeGlobalTransform
+			{
+				NodeComponent* node;
+				Quaternionf rotation;
+				Vector3f position;
+			};
+
+			// Active body transforms are fetched in bulk and written to nodes before their invalidation is signaled
+			struct ReplicationData
+			{
+				std::vector<NodeComponent*> nodes;
+				std::vector<NodeGlobalTransform> globalTransforms; //< nodes with a parent, which must be updated after it
+				std::vector<Quaternionf> bodyRotations;
+				std::vector<Quaternionf> nodeRotations;
+				std::vector<UInt32> bodyIndices;
+				std::vector<UInt32> customReplicationBodies;
+				std::vector<Vector3f> bodyPositions;
+				std::vector<Vector3f> nodePositions;
+			};
 
 			std::size_t m_stepCount;
+			std::vector<PhysWorld3D::RaycastHit> m_batchRaycastHits;
+			std::vector<PhysWorld3D::ShapecastHit> m_batchShapecastHits;
 			std::vector<entt::entity> m_bodyIndicesToEntity;
 			entt::registry& m_registry;
 			entt::scoped_connection m_bodyConstructConnection;
@@ -98,7 +169,11 @@ namespace Nz
 			entt::scoped_connection m_characterDestructConnection;
 			EnttObserver<TypeList<class PhysCharacter3DComponent, class NodeComponent>, TypeList<class DisabledComponent, class RigidBody3DComponent>> m_characterObserver;
 			EnttObserver<TypeList<class RigidBody3DComponent, class NodeComponent>, TypeList<class DisabledComponent, class PhysCharacter3DComponent>> m_rigidBodyObserver;
+			InterpolationData m_interpolation;
 			PhysWorld3D m_physWorld;
+			ReplicationData m_replication;
+			TaskScheduler* m_taskScheduler;
+			bool m_transformInterpolation;
 	};
 }
 
@@ -19,4 +19,24 @@ namespace Nz
 	{
 		return entt::handle(m_registry, m_bodyIndicesToEntity[bodyIndex]);
 	}
+
+	inline TaskScheduler* Physics3DSystem::GetTaskScheduler() const
+	{
+		return m_taskScheduler;
+	}
+
+	inline bool Physics3DSystem::IsTransformInterpolationEnabled() const
+	{
+		return m_transformInterpolation;
+	}
+
+	/*!
+	* \brief Sets the task scheduler used to replicate body transforms to nodes
+	*
+	* \param taskScheduler Task scheduler to use, or nullptr to replicate transforms on the calling thread
+	*/
+	inline void Physics3DSystem::SetTaskScheduler(TaskScheduler* taskScheduler)
+	{
+		m_taskScheduler = taskScheduler;
+	}
 }
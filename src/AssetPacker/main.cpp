@@ -0,0 +1,74 @@
+#include <Nazara/Core/AssetPackBuilder.hpp>
+#include <Nazara/Core/CommandLineParameters.hpp>
+#include <Nazara/Core/Core.hpp>
+#include <Nazara/Core/Modules.hpp>
+#include <NazaraUtils/PathUtils.hpp>
+#include <charconv>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+
+int main(int argc, char* argv[])
+{
+	Nz::Modules<Nz::Core> nazara;
+
+	Nz::CommandLineParameters parameters = Nz::CommandLineParameters::Parse(argc, argv);
+
+	std::string_view inputDir;
+	std::string_view outputFile;
+	if (!parameters.GetParameter("input", &inputDir) || !parameters.GetParameter("output", &outputFile))
+	{
+		std::cout << "Usage: NazaraAssetPacker --input=<directory> --output=<pack> [--compression=none|lz4|zstd] [--level=<level>] [--prefix=<path>]\n";
+		return EXIT_FAILURE;
+	}
+
+	Nz::AssetPackCompression compression = Nz::AssetPackCompression::None;
+
+	std::string_view compressionName;
+	if (parameters.GetParameter("compression", &compressionName))
+	{
+		if (compressionName == "lz4")
+			compression = Nz::AssetPackCompression::LZ4;
+		else if (compressionName == "zstd")
+			compression = Nz::AssetPackCompression::Zstd;
+		else if (compressionName != "none")
+		{
+			std::cerr << "unknown compression " << compressionName << '\n';
+			return EXIT_FAILURE;
+		}
+	}
+
+	Nz::AssetPackBuilder builder;
+
+	std::string_view levelStr;
+	if (parameters.GetParameter("level", &levelStr))
+	{
+		int level;
+		auto result = std::from_chars(levelStr.data(), levelStr.data() + levelStr.size(), level);
+		if (result.ec != std::errc{} || result.ptr != levelStr.data() + levelStr.size())
+		{
+			std::cerr << "invalid compression level " << levelStr << '\n';
+			return EXIT_FAILURE;
+		}
+
+		builder.SetLZ4CompressionLevel(level);
+		builder.SetZstdCompressionLevel(level);
+	}
+
+	std::string_view prefix;
+	parameters.GetParameter("prefix", &prefix);
+
+	std::filesystem::path inputPath = Nz::Utf8Path(inputDir);
+	if (!std::filesystem::is_directory(inputPath))
+	{
+		std::cerr << inputDir << " is not a directory\n";
+		return EXIT_FAILURE;
+	}
+
+	builder.AddDirectory(inputPath, compression, prefix);
+	if (!builder.Build(Nz::Utf8Path(outputFile)))
+		return EXIT_FAILURE;
+
+	std::cout << "Packed " << builder.GetEntryCount() << " file(s) into " << outputFile << '\n';
+	return EXIT_SUCCESS;
+}
@@ -29,6 +29,8 @@
 #include <Nazara/Core/IndexIterator.hpp>
 #include <Nazara/Core/Joint.hpp>
 #include <Nazara/Core/Mesh.hpp>
+#include <Nazara/Core/ParallelAlgorithm.hpp>
+#include <Nazara/Core/SimdUtils.hpp>
 #include <Nazara/Core/SkeletalMesh.hpp>
 #include <Nazara/Math/Angle.hpp>
 #include <algorithm>
@@ -630,6 +632,379 @@ namespace Nz
 				float m_valenceBoostScale;
 				float m_valenceBoostPower;
 		};
+
+		// Skinning matrices are affine, only the first three components of their rows are relevant
+		template<bool HasPositions, bool HasNormals, bool HasTangents>
+		void SkinLinearBlendVertices(const SkinningData& skinningInfos, const Matrix4f* skinningMatrices, UInt32 startVertex, UInt32 endVertex)
+		{
+			for (UInt32 i = startVertex; i < endVertex; ++i)
+			{
+				const Vector4i32& jointIndices = skinningInfos.inputJointIndices[i];
+				const Vector4f& jointWeights = skinningInfos.inputJointWeights[i];
+
+				const float* matrix0 = &skinningMatrices[jointIndices.x].m11;
+				const float* matrix1 = &skinningMatrices[jointIndices.y].m11;
+				const float* matrix2 = &skinningMatrices[jointIndices.z].m11;
+				const float* matrix3 = &skinningMatrices[jointIndices.w].m11;
+
+#ifdef NAZARA_CORE_SIMD_SSE2
+				// Blend the four joint matrices once, then transform every attribute with the blended matrix
+				__m128 weight0 = _mm_set1_ps(jointWeights.x);
+				__m128 weight1 = _mm_set1_ps(jointWeights.y);
+				__m128 weight2 = _mm_set1_ps(jointWeights.z);
+				__m128 weight3 = _mm_set1_ps(jointWeights.w);
+
+				__m128 rows[4];
+				for (std::size_t row = 0; row < 4; ++row)
+				{
+					__m128 blendedRow = _mm_mul_ps(_mm_loadu_ps(&matrix0[row * 4]), weight0);
+					blendedRow = _mm_add_ps(blendedRow, _mm_mul_ps(_mm_loadu_ps(&matrix1[row * 4]), weight1));
+					blendedRow = _mm_add_ps(blendedRow, _mm_mul_ps(_mm_loadu_ps(&matrix2[row * 4]), weight2));
+					blendedRow = _mm_add_ps(blendedRow, _mm_mul_ps(_mm_loadu_ps(&matrix3[row * 4]), weight3));
+					rows[row] = blendedRow;
+				}
+
+				auto TransformDirection = [&](const Vector3f& direction)
+				{
+					__m128 result = _mm_mul_ps(rows[0], _mm_set1_ps(direction.x));
+					result = _mm_add_ps(result, _mm_mul_ps(rows[1], _mm_set1_ps(direction.y)));
+					result = _mm_add_ps(result, _mm_mul_ps(rows[2], _mm_set1_ps(direction.z)));
+					return result;
+				};
+
+				auto ToVector3 = [](__m128 value)
+				{
+					alignas(16) float components[4];
+					_mm_store_ps(components, value);
+
+					return Vector3f(components[0], components[1], components[2]);
+				};
+
+				if constexpr (HasPositions)
+					skinningInfos.outputPositions[i] = ToVector3(_mm_add_ps(TransformDirection(skinningInfos.inputPositions[i]), rows[3]));
+
+				if constexpr (HasNormals)
+					skinningInfos.outputNormals[i] = ToVector3(TransformDirection(skinningInfos.inputNormals[i])).GetNormal();
+
+				if constexpr (HasTangents)
+					skinningInfos.outputTangents[i] = ToVector3(TransformDirection(skinningInfos.inputTangents[i])).GetNormal();
+#else
+				float rows[4][3];
+				for (std::size_t row = 0; row < 4; ++row)
+				{
+					for (std::size_t column = 0; column < 3; ++column)
+					{
+						std::size_t index = row * 4 + column;
+						rows[row][column] = matrix0[index] * jointWeights.x + matrix1[index] * jointWeights.y + matrix2[index] * jointWeights.z + matrix3[index] * jointWeights.w;
+					}
+				}
+
+				auto TransformDirection = [&](const Vector3f& direction)
+				{
+					return Vector3f(rows[0][0] * direction.x + rows[1][0] * direction.y + rows[2][0] * direction.z,
+					                rows[0][1] * direction.x + rows[1][1] * direction.y + rows[2][1] * direction.z,
+					                rows[0][2] * direction.x + rows[1][2] * direction.y + rows[2][2] * direction.z);
+				};
+
+				if constexpr (HasPositions)
+					skinningInfos.outputPositions[i] = TransformDirection(skinningInfos.inputPositions[i]) + Vector3f(rows[3][0], rows[3][1], rows[3][2]);
+
+				if constexpr (HasNormals)
+					skinningInfos.outputNormals[i] = TransformDirection(skinningInfos.inputNormals[i]).GetNormal();
+
+				if constexpr (HasTangents)
+					skinningInfos.outputTangents[i] = TransformDirection(skinningInfos.inputTangents[i]).GetNormal();
+#endif
+			}
+		}
+
+		// Flips influences to the hemisphere of the first one, so the blend takes the shortest path
+		inline float GetDualQuaternionBlendWeight(const SkinningDualQuaternion& first, const SkinningDualQuaternion& dualQuaternion, float weight)
+		{
+			return (first.real.DotProduct(dualQuaternion.real) < 0.f) ? -weight : weight;
+		}
+
+		inline void SkinDualQuaternionVertex(const SkinningData& skinningInfos, const SkinningDualQuaternion& blendedDualQuaternion, UInt32 i, bool hasPositions, bool hasNormals, bool hasTangents)
+		{
+			float invLength = 1.f / blendedDualQuaternion.real.Magnitude();
+			Quaternionf real = blendedDualQuaternion.real * invLength;
+			Quaternionf dual = blendedDualQuaternion.dual * invLength;
+
+			if (hasPositions)
+			{
+				Quaternionf translation = dual * real.GetConjugate();
+				skinningInfos.outputPositions[i] = real * skinningInfos.inputPositions[i] + 2.f * Vector3f(translation.x, translation.y, translation.z);
+			}
+
+			if (hasNormals)
+				skinningInfos.outputNormals[i] = real * skinningInfos.inputNormals[i];
+
+			if (hasTangents)
+				skinningInfos.outputTangents[i] = real * skinningInfos.inputTangents[i];
+		}
+
+		template<bool HasPositions, bool HasNormals, bool HasTangents>
+		void SkinDualQuaternionVertices(const SkinningData& skinningInfos, const SkinningDualQuaternion* dualQuaternions, UInt32 startVertex, UInt32 endVertex)
+		{
+			UInt32 i = startVertex;
+
+#ifdef NAZARA_CORE_SIMD_SSE2
+			// Process vertices four at a time, each SIMD lane handling a vertex
+			for (; i + 4 <= endVertex; i += 4)
+			{
+				__m128 real[4];
+				__m128 dual[4];
+				for (UInt32 lane = 0; lane < 4; ++lane)
+				{
+					const Vector4i32& jointIndices = skinningInfos.inputJointIndices[i + lane];
+					const Vector4f& jointWeights = skinningInfos.inputJointWeights[i + lane];
+
+					const SkinningDualQuaternion& dq0 = dualQuaternions[jointIndices.x];
+					const SkinningDualQuaternion& dq1 = dualQuaternions[jointIndices.y];
+					const SkinningDualQuaternion& dq2 = dualQuaternions[jointIndices.z];
+					const SkinningDualQuaternion& dq3 = dualQuaternions[jointIndices.w];
+
+					__m128 weight0 = _mm_set1_ps(jointWeights.x);
+					__m128 weight1 = _mm_set1_ps(GetDualQuaternionBlendWeight(dq0, dq1, jointWeights.y));
+					__m128 weight2 = _mm_set1_ps(GetDualQuaternionBlendWeight(dq0, dq2, jointWeights.z));
+					__m128 weight3 = _mm_set1_ps(GetDualQuaternionBlendWeight(dq0, dq3, jointWeights.w));
+
+					// Quaternion components are stored as w, x, y, z
+					__m128 blendedReal = _mm_mul_ps(_mm_loadu_ps(&dq0.real.w), weight0);
+					blendedReal = _mm_add_ps(blendedReal, _mm_mul_ps(_mm_loadu_ps(&dq1.real.w), weight1));
+					blendedReal = _mm_add_ps(blendedReal, _mm_mul_ps(_mm_loadu_ps(&dq2.real.w), weight2));
+					blendedReal = _mm_add_ps(blendedReal, _mm_mul_ps(_mm_loadu_ps(&dq3.real.w), weight3));
+
+					__m128 blendedDual = _mm_mul_ps(_mm_loadu_ps(&dq0.dual.w), weight0);
+					blendedDual = _mm_add_ps(blendedDual, _mm_mul_ps(_mm_loadu_ps(&dq1.dual.w), weight1));
+					blendedDual = _mm_add_ps(blendedDual, _mm_mul_ps(_mm_loadu_ps(&dq2.dual.w), weight2));
+					blendedDual = _mm_add_ps(blendedDual, _mm_mul_ps(_mm_loadu_ps(&dq3.dual.w), weight3));
+
+					real[lane] = blendedReal;
+					dual[lane] = blendedDual;
+				}
+
+				// Switch to a component-per-register layout (real[0] holds the w component of the four vertices, and so on)
+				_MM_TRANSPOSE4_PS(real[0], real[1], real[2], real[3]);
+				_MM_TRANSPOSE4_PS(dual[0], dual[1], dual[2], dual[3]);
+
+				__m128 squaredLength = _mm_mul_ps(real[0], real[0]);
+				squaredLength = _mm_add_ps(squaredLength, _mm_mul_ps(real[1], real[1]));
+				squaredLength = _mm_add_ps(squaredLength, _mm_mul_ps(real[2], real[2]));
+				squaredLength = _mm_add_ps(squaredLength, _mm_mul_ps(real[3], real[3]));
+
+				__m128 invLength = _mm_div_ps(_mm_set1_ps(1.f), _mm_sqrt_ps(squaredLength));
+
+				__m128 rw = _mm_mul_ps(real[0], invLength);
+				__m128 rx = _mm_mul_ps(real[1], invLength);
+				__m128 ry = _mm_mul_ps(real[2], invLength);
+				__m128 rz = _mm_mul_ps(real[3], invLength);
+
+				__m128 two = _mm_set1_ps(2.f);
+
+				// v + 2 * cross(r, cross(r, v) + w * v)
+				auto Rotate = [&](__m128 vx, __m128 vy, __m128 vz, __m128& outX, __m128& outY, __m128& outZ)
+				{
+					__m128 ux = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(ry, vz), _mm_mul_ps(rz, vy)), _mm_mul_ps(rw, vx));
+					__m128 uy = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(rz, vx), _mm_mul_ps(rx, vz)), _mm_mul_ps(rw, vy));
+					__m128 uz = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(rx, vy), _mm_mul_ps(ry, vx)), _mm_mul_ps(rw, vz));
+
+					outX = _mm_add_ps(vx, _mm_mul_ps(two, _mm_sub_ps(_mm_mul_ps(ry, uz), _mm_mul_ps(rz, uy))));
+					outY = _mm_add_ps(vy, _mm_mul_ps(two, _mm_sub_ps(_mm_mul_ps(rz, ux), _mm_mul_ps(rx, uz))));
+					outZ = _mm_add_ps(vz, _mm_mul_ps(two, _mm_sub_ps(_mm_mul_ps(rx, uy), _mm_mul_ps(ry, ux))));
+				};
+
+				auto TransformAttribute = [&](SparsePtr<const Vector3f> input, SparsePtr<Vector3f> output, bool translate)
+				{
+					const Vector3f& v0 = input[i + 0];
+					const Vector3f& v1 = input[i + 1];
+					const Vector3f& v2 = input[i + 2];
+					const Vector3f& v3 = input[i + 3];
+
+					__m128 x, y, z;
+					Rotate(_mm_set_ps(v3.x, v2.x, v1.x, v0.x), _mm_set_ps(v3.y, v2.y, v1.y, v0.y), _mm_set_ps(v3.z, v2.z, v1.z, v0.z), x, y, z);
+
+					if (translate)
+					{
+						__m128 dw = _mm_mul_ps(dual[0], invLength);
+						__m128 dx = _mm_mul_ps(dual[1], invLength);
+						__m128 dy = _mm_mul_ps(dual[2], invLength);
+						__m128 dz = _mm_mul_ps(dual[3], invLength);
+
+						// 2 * (w_r * d - w_d * r + cross(r, d))
+						__m128 tx = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(rw, dx), _mm_mul_ps(dw, rx)), _mm_sub_ps(_mm_mul_ps(ry, dz), _mm_mul_ps(rz, dy)));
+						__m128 ty = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(rw, dy), _mm_mul_ps(dw, ry)), _mm_sub_ps(_mm_mul_ps(rz, dx), _mm_mul_ps(rx, dz)));
+						__m128 tz = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(rw, dz), _mm_mul_ps(dw, rz)), _mm_sub_ps(_mm_mul_ps(rx, dy), _mm_mul_ps(ry, dx)));
+
+						x = _mm_add_ps(x, _mm_mul_ps(two, tx));
+						y = _mm_add_ps(y, _mm_mul_ps(two, ty));
+						z = _mm_add_ps(z, _mm_mul_ps(two, tz));
+					}
+
+					alignas(16) float outputX[4];
+					alignas(16) float outputY[4];
+					alignas(16) float outputZ[4];
+					_mm_store_ps(outputX, x);
+					_mm_store_ps(outputY, y);
+					_mm_store_ps(outputZ, z);
+
+					for (UInt32 lane = 0; lane < 4; ++lane)
+						output[i + lane] = Vector3f(outputX[lane], outputY[lane], outputZ[lane]);
+				};
+
+				if constexpr (HasPositions)
+					TransformAttribute(skinningInfos.inputPositions, skinningInfos.outputPositions, true);
+
+				if constexpr (HasNormals)
+					TransformAttribute(skinningInfos.inputNormals, skinningInfos.outputNormals, false);
+
+				if constexpr (HasTangents)
+					TransformAttribute(skinningInfos.inputTangents, skinningInfos.outputTangents, false);
+			}
+#endif
+
+			// Remaining vertices (or every vertex if SIMD isn't available)
+			for (; i < endVertex; ++i)
+			{
+				const Vector4i32& jointIndices = skinningInfos.inputJointIndices[i];
+				const Vector4f& jointWeights = skinningInfos.inputJointWeights[i];
+
+				const SkinningDualQuaternion& dq0 = dualQuaternions[jointIndices.x];
+				const SkinningDualQuaternion& dq1 = dualQuaternions[jointIndices.y];
+				const SkinningDualQuaternion& dq2 = dualQuaternions[jointIndices.z];
+				const SkinningDualQuaternion& dq3 = dualQuaternions[jointIndices.w];
+
+				float weight0 = jointWeights.x;
+				float weight1 = GetDualQuaternionBlendWeight(dq0, dq1, jointWeights.y);
+				float weight2 = GetDualQuaternionBlendWeight(dq0, dq2, jointWeights.z);
+				float weight3 = GetDualQuaternionBlendWeight(dq0, dq3, jointWeights.w);
+
+				SkinningDualQuaternion blendedDualQuaternion;
+				blendedDualQuaternion.real = dq0.real * weight0 + dq1.real * weight1 + dq2.real * weight2 + dq3.real * weight3;
+				blendedDualQuaternion.dual = dq0.dual * weight0 + dq1.dual * weight1 + dq2.dual * weight2 + dq3.dual * weight3;
+
+				SkinDualQuaternionVertex(skinningInfos, blendedDualQuaternion, i, HasPositions, HasNormals, HasTangents);
+			}
+		}
+
+		template<typename T>
+		using SkinningKernel = void(*)(const SkinningData& skinningInfos, const T* jointTransforms, UInt32 startVertex, UInt32 endVertex);
+
+		// Select the kernel once instead of branching for each vertex
+		template<typename T, template<bool, bool, bool> typename Kernel>
+		void SkinRange(const SkinningData& skinningInfos, const T* jointTransforms, UInt32 startVertex, UInt32 endVertex)
+		{
+			bool hasPositions = skinningInfos.inputPositions && skinningInfos.outputPositions;
+			bool hasNormals = skinningInfos.inputNormals && skinningInfos.outputNormals;
+			bool hasTangents = skinningInfos.inputTangents && skinningInfos.outputTangents;
+
+			constexpr SkinningKernel<T> kernels[8] = {
+				&Kernel<false, false, false>::Process,
+				&Kernel<true,  false, false>::Process,
+				&Kernel<false, true,  false>::Process,
+				&Kernel<true,  true,  false>::Process,
+				&Kernel<false, false, true>::Process,
+				&Kernel<true,  false, true>::Process,
+				&Kernel<false, true,  true>::Process,
+				&Kernel<true,  true,  true>::Process
+			};
+
+			std::size_t kernelIndex = (hasPositions ? 1 : 0) | (hasNormals ? 2 : 0) | (hasTangents ? 4 : 0);
+			if (kernelIndex != 0)
+				kernels[kernelIndex](skinningInfos, jointTransforms, startVertex, endVertex);
+
+			if (skinningInfos.outputUv)
+			{
+				NazaraAssertMsg(skinningInfos.inputUv, "missing input uv");
+
+				for (UInt32 i = startVertex; i < endVertex; ++i)
+					skinningInfos.outputUv[i] = skinningInfos.inputUv[i];
+			}
+		}
+
+		template<bool HasPositions, bool HasNormals, bool HasTangents>
+		struct DualQuaternionKernel
+		{
+			static void Process(const SkinningData& skinningInfos, const SkinningDualQuaternion* dualQuaternions, UInt32 startVertex, UInt32 endVertex)
+			{
+				SkinDualQuaternionVertices<HasPositions, HasNormals, HasTangents>(skinningInfos, dualQuaternions, startVertex, endVertex);
+			}
+		};
+
+		template<bool HasPositions, bool HasNormals, bool HasTangents>
+		struct LinearBlendKernel
+		{
+			static void Process(const SkinningData& skinningInfos, const Matrix4f* skinningMatrices, UInt32 startVertex, UInt32 endVertex)
+			{
+				SkinLinearBlendVertices<HasPositions, HasNormals, HasTangents>(skinningInfos, skinningMatrices, startVertex, endVertex);
+			}
+		};
+
+		void ValidateSkinningData([[maybe_unused]] const SkinningData& skinningInfos, [[maybe_unused]] bool hasJointTransforms)
+		{
+			NazaraAssertMsg(skinningInfos.inputJointIndices, "missing input joint indices");
+			NazaraAssertMsg(skinningInfos.inputJointWeights, "missing input joint weights");
+
+			if (skinningInfos.outputPositions || skinningInfos.outputNormals || skinningInfos.outputTangents)
+			{
+				NazaraAssertMsg(skinningInfos.joints || hasJointTransforms, "missing skeleton joints");
+
+				if (skinningInfos.outputPositions)
+					NazaraAssertMsg(skinningInfos.inputPositions, "missing input positions");
+
+				if (skinningInfos.outputNormals)
+					NazaraAssertMsg(skinningInfos.inputNormals, "missing input normals");
+
+				if (skinningInfos.outputTangents)
+					NazaraAssertMsg(skinningInfos.inputTangents, "missing input tangents");
+			}
+		}
+
+		// Returns precomputed joint transforms, or compute the ones used by this vertex range in the storage
+		template<typename T, typename F>
+		const T* PrepareJointTransforms(const SkinningData& skinningInfos, const T* precomputedTransforms, UInt32 startVertex, UInt32 vertexCount, std::vector<T>& storage, F&& computeTransforms)
+		{
+			if (precomputedTransforms)
+				return precomputedTransforms;
+
+			if (!skinningInfos.outputPositions && !skinningInfos.outputNormals && !skinningInfos.outputTangents)
+				return nullptr;
+
+			Int32 maxJointIndex = 0;
+			for (UInt32 i = startVertex; i < startVertex + vertexCount; ++i)
+			{
+				const Vector4i32& jointIndices = skinningInfos.inputJointIndices[i];
+				maxJointIndex = std::max({ maxJointIndex, jointIndices.x, jointIndices.y, jointIndices.z, jointIndices.w });
+			}
+
+			storage.resize(maxJointIndex + 1);
+			computeTransforms(skinningInfos.joints, storage.size(), storage.data());
+
+			return storage.data();
+		}
+
+		// Joints update their skinning matrix lazily, which isn't thread-safe, transforms are computed before splitting the work
+		template<typename T, template<bool, bool, bool> typename Kernel, typename F>
+		void SkinVertices(TaskScheduler* taskScheduler, const SkinningData& skinningInfos, const T* precomputedTransforms, UInt32 startVertex, UInt32 vertexCount, F&& computeTransforms)
+		{
+			constexpr std::size_t GrainSize = 1024;
+
+			ValidateSkinningData(skinningInfos, precomputedTransforms != nullptr);
+
+			std::vector<T> transformStorage;
+			const T* jointTransforms = PrepareJointTransforms(skinningInfos, precomputedTransforms, startVertex, vertexCount, transformStorage, computeTransforms);
+
+			if (!taskScheduler)
+			{
+				SkinRange<T, Kernel>(skinningInfos, jointTransforms, startVertex, startVertex + vertexCount);
+				return;
+			}
+
+			ParallelFor(*taskScheduler, startVertex, startVertex + vertexCount, GrainSize, [&](std::size_t chunkBegin, std::size_t chunkEnd)
+			{
+				SkinRange<T, Kernel>(skinningInfos, jointTransforms, static_cast<UInt32>(chunkBegin), static_cast<UInt32>(chunkEnd));
+			});
+		}
 	}
 
 	/**********************************Compute**********************************/
@@ -651,6 +1026,29 @@ namespace Nz
 		return aabb;
 	}
 
+	Boxf ComputeAABB(TaskScheduler& taskScheduler, SparsePtr<const Vector3f> positionPtr, UInt32 vertexCount)
+	{
+		constexpr std::size_t GrainSize = 16 * 1024;
+
+		if (vertexCount <= GrainSize)
+			return ComputeAABB(positionPtr, vertexCount);
+
+		// Starting from the first vertex box keeps the reduction correct without needing an empty box
+		Boxf firstVertexBox(positionPtr->x, positionPtr->y, positionPtr->z, 0.f, 0.f, 0.f);
+
+		return ParallelReduce(taskScheduler, 0, vertexCount, GrainSize, firstVertexBox, [&](std::size_t chunkBegin, std::size_t chunkEnd)
+		{
+			SparsePtr<const Vector3f> chunkPositionPtr = positionPtr;
+			chunkPositionPtr += static_cast<UInt32>(chunkBegin);
+
+			return ComputeAABB(chunkPositionPtr, static_cast<UInt32>(chunkEnd - chunkBegin));
+		},
+		[](const Boxf& lhs, const Boxf& rhs)
+		{
+			return Boxf(lhs).ExtendTo(rhs);
+		});
+	}
+
 	void ComputeBoxIndexVertexCount(const Vector3ui& subdivision, UInt32* indexCount, UInt32* vertexCount)
 	{
 		UInt32 xIndexCount, yIndexCount, zIndexCount;
@@ -1066,70 +1464,108 @@ namespace Nz
 
 	/************************************Skin***********************************/
 
-	void SkinLinearBlend(const SkinningData& skinningInfos, UInt32 startVertex, UInt32 vertexCount)
+	void ComputeSkinningDualQuaternions(const Joint* joints, std::size_t jointCount, SkinningDualQuaternion* skinningDualQuaternions)
 	{
-		NazaraAssertMsg(skinningInfos.inputJointIndices, "missing input joint indices");
-		NazaraAssertMsg(skinningInfos.inputJointWeights, "missing input joint weights");
-
-		UInt32 endVertex = startVertex + vertexCount - 1;
-		if (skinningInfos.outputPositions || skinningInfos.outputNormals || skinningInfos.outputTangents)
+		for (std::size_t i = 0; i < jointCount; ++i)
 		{
-			NazaraAssertMsg(skinningInfos.joints, "missing skeleton joints");
+			const Matrix4f& skinningMatrix = joints[i].GetSkinningMatrix();
+
+			// Dual quaternions only represent rigid transformations, remove the scale from the rotation part
+			Vector3f xAxis = Vector3f::Normalize(Vector3f(skinningMatrix.m11, skinningMatrix.m12, skinningMatrix.m13));
+			Vector3f yAxis = Vector3f::Normalize(Vector3f(skinningMatrix.m21, skinningMatrix.m22, skinningMatrix.m23));
+			Vector3f zAxis = Vector3f::Normalize(Vector3f(skinningMatrix.m31, skinningMatrix.m32, skinningMatrix.m33));
 
-			if (skinningInfos.outputPositions)
-				NazaraAssertMsg(skinningInfos.inputPositions, "missing input positions");
+			// Matrices are stored in row-major order and transform row vectors
+			Quaternionf rotation;
+			float trace = xAxis.x + yAxis.y + zAxis.z;
+			if (trace > 0.f)
+			{
+				float s = 2.f * std::sqrt(1.f + trace);
+				rotation = Quaternionf(0.25f * s, (yAxis.z - zAxis.y) / s, (zAxis.x - xAxis.z) / s, (xAxis.y - yAxis.x) / s);
+			}
+			else if (xAxis.x > yAxis.y && xAxis.x > zAxis.z)
+			{
+				float s = 2.f * std::sqrt(1.f + xAxis.x - yAxis.y - zAxis.z);
+				rotation = Quaternionf((yAxis.z - zAxis.y) / s, 0.25f * s, (yAxis.x + xAxis.y) / s, (zAxis.x + xAxis.z) / s);
+			}
+			else if (yAxis.y > zAxis.z)
+			{
+				float s = 2.f * std::sqrt(1.f + yAxis.y - xAxis.x - zAxis.z);
+				rotation = Quaternionf((zAxis.x - xAxis.z) / s, (yAxis.x + xAxis.y) / s, 0.25f * s, (zAxis.y + yAxis.z) / s);
+			}
+			else
+			{
+				float s = 2.f * std::sqrt(1.f + zAxis.z - xAxis.x - yAxis.y);
+				rotation = Quaternionf((xAxis.y - yAxis.x) / s, (zAxis.x + xAxis.z) / s, (zAxis.y + yAxis.z) / s, 0.25f * s);
+			}
+			rotation.Normalize();
 
-			if (skinningInfos.outputNormals)
-				NazaraAssertMsg(skinningInfos.inputNormals, "missing input positions");
+			Quaternionf translation(0.f, skinningMatrix.m41, skinningMatrix.m42, skinningMatrix.m43);
 
-			if (skinningInfos.outputTangents)
-				NazaraAssertMsg(skinningInfos.inputTangents, "missing input positions");
+			skinningDualQuaternions[i].real = rotation;
+			skinningDualQuaternions[i].dual = (translation * rotation) * 0.5f;
+		}
+	}
 
-			bool hasPositions = skinningInfos.inputPositions && skinningInfos.outputPositions;
-			bool hasNormals = skinningInfos.inputNormals && skinningInfos.outputNormals;
-			bool hasTangents = skinningInfos.inputTangents && skinningInfos.outputTangents;
+	void ComputeSkinningMatrices(const Joint* joints, std::size_t jointCount, Matrix4f* skinningMatrices)
+	{
+		for (std::size_t i = 0; i < jointCount; ++i)
+			skinningMatrices[i] = joints[i].GetSkinningMatrix();
+	}
 
-			for (UInt32 i = startVertex; i <= endVertex; ++i)
-			{
-				Vector3f finalPosition = Vector3f::Zero();
-				Vector3f finalNormal = Vector3f::Zero();
-				Vector3f finalTangent = Vector3f::Zero();
+	void Skin(SkinningMode skinningMode, const SkinningData& skinningInfos, UInt32 startVertex, UInt32 vertexCount)
+	{
+		switch (skinningMode)
+		{
+			case SkinningMode::DualQuaternion:
+				return SkinDualQuaternion(skinningInfos, startVertex, vertexCount);
 
-				for (Int32 j = 0; j < 4; ++j)
-				{
-					Int32 jointIndex = skinningInfos.inputJointIndices[i][j];
+			case SkinningMode::LinearBlend:
+				return SkinLinearBlend(skinningInfos, startVertex, vertexCount);
+		}
 
-					Matrix4f mat = skinningInfos.joints[jointIndex].GetSkinningMatrix();
-					mat *= skinningInfos.inputJointWeights[i][j];
+		NazaraError("unhandled skinning mode {0}", UnderlyingCast(skinningMode));
+	}
 
-					// Hopefully the branch predictor will help here
-					if (hasPositions)
-						finalPosition += mat.Transform(skinningInfos.inputPositions[i]);
+	void Skin(TaskScheduler& taskScheduler, SkinningMode skinningMode, const SkinningData& skinningInfos, UInt32 startVertex, UInt32 vertexCount)
+	{
+		switch (skinningMode)
+		{
+			case SkinningMode::DualQuaternion:
+				return SkinDualQuaternion(taskScheduler, skinningInfos, startVertex, vertexCount);
 
-					if (hasNormals)
-						finalNormal += mat.Transform(skinningInfos.inputNormals[i], 0.f);
+			case SkinningMode::LinearBlend:
+				return SkinLinearBlend(taskScheduler, skinningInfos, startVertex, vertexCount);
+		}
 
-					if (hasTangents)
-						finalTangent += mat.Transform(skinningInfos.inputTangents[i], 0.f);
-				}
+		NazaraError("unhandled skinning mode {0}", UnderlyingCast(skinningMode));
+	}
 
-				if (hasPositions)
-					skinningInfos.outputPositions[i] = finalPosition;
+	void SkinDualQuaternion(const SkinningData& skinningInfos, UInt32 startVertex, UInt32 vertexCount)
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
 
-				if (hasNormals)
-					skinningInfos.outputNormals[i] = finalNormal.GetNormal();
+		SkinVertices<SkinningDualQuaternion, DualQuaternionKernel>(nullptr, skinningInfos, skinningInfos.skinningDualQuaternions, startVertex, vertexCount, &ComputeSkinningDualQuaternions);
+	}
 
-				if (hasTangents)
-					skinningInfos.outputTangents[i] = finalTangent.GetNormal();
-			}
-		}
+	void SkinDualQuaternion(TaskScheduler& taskScheduler, const SkinningData& skinningInfos, UInt32 startVertex, UInt32 vertexCount)
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
 
-		if (skinningInfos.outputUv)
-		{
-			NazaraAssertMsg(skinningInfos.inputUv, "missing input uv");
+		SkinVertices<SkinningDualQuaternion, DualQuaternionKernel>(&taskScheduler, skinningInfos, skinningInfos.skinningDualQuaternions, startVertex, vertexCount, &ComputeSkinningDualQuaternions);
+	}
 
-			for (UInt64 i = startVertex; i <= endVertex; ++i)
-				skinningInfos.outputUv[i] = skinningInfos.inputUv[i];
-		}
+	void SkinLinearBlend(const SkinningData& skinningInfos, UInt32 startVertex, UInt32 vertexCount)
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		SkinVertices<Matrix4f, LinearBlendKernel>(nullptr, skinningInfos, skinningInfos.skinningMatrices, startVertex, vertexCount, &ComputeSkinningMatrices);
+	}
+
+	void SkinLinearBlend(TaskScheduler& taskScheduler, const SkinningData& skinningInfos, UInt32 startVertex, UInt32 vertexCount)
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		SkinVertices<Matrix4f, LinearBlendKernel>(&taskScheduler, skinningInfos, skinningInfos.skinningMatrices, startVertex, vertexCount, &ComputeSkinningMatrices);
 	}
 }
@@ -0,0 +1,330 @@
+// Copyright (C) 2026 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#include <Nazara/Core/AssetPack.hpp>
+#include <Nazara/Core/ByteArray.hpp>
+#include <Nazara/Core/ByteStream.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/MemoryView.hpp>
+#include <NazaraUtils/Algorithm.hpp>
+#include <lz4.h>
+#include <zstd.h>
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+namespace Nz
+{
+	namespace NAZARA_ANONYMOUS_NAMESPACE
+	{
+		// Compressed entries are only decompressed when first read, so listing a directory stays cheap
+		// They are not memory-mapped as decompression can fail, which a mapped pointer couldn't report
+		class CompressedEntryStream final : public Stream
+		{
+			public:
+				CompressedEntryStream(std::shared_ptr<const AssetPack> assetPack, std::size_t entryIndex) :
+				Stream(StreamOption::None, OpenMode::Read),
+				m_assetPack(std::move(assetPack)),
+				m_entryIndex(entryIndex),
+				m_cursor(0),
+				m_isDecompressed(false)
+				{
+				}
+
+				UInt64 GetSize() const override
+				{
+					return m_assetPack->GetEntry(m_entryIndex).size;
+				}
+
+			private:
+				bool EnsureDecompressed()
+				{
+					if (!m_isDecompressed)
+					{
+						ByteArray content(m_assetPack->GetEntry(m_entryIndex).size);
+						if (!m_assetPack->Decompress(m_entryIndex, content.GetBuffer()))
+							return false;
+
+						m_content = std::move(content);
+						m_isDecompressed = true;
+					}
+
+					return true;
+				}
+
+				void FlushStream() override
+				{
+				}
+
+				std::size_t ReadBlock(void* buffer, std::size_t size) override
+				{
+					if (!EnsureDecompressed())
+						return 0;
+
+					std::size_t readSize = std::min<std::size_t>(size, static_cast<std::size_t>(m_content.GetSize() - m_cursor));
+					if (buffer)
+						std::memcpy(buffer, m_content.GetConstBuffer() + m_cursor, readSize);
+
+					m_cursor += readSize;
+					return readSize;
+				}
+
+				bool SeekStreamCursor(UInt64 offset) override
+				{
+					m_cursor = std::min(offset, GetSize());
+					return true;
+				}
+
+				UInt64 TellStreamCursor() const override
+				{
+					return m_cursor;
+				}
+
+				bool TestStreamEnd() const override
+				{
+					return m_cursor >= GetSize();
+				}
+
+				std::size_t WriteBlock(const void* /*buffer*/, std::size_t /*size*/) override
+				{
+					NazaraError("asset pack entries are read-only");
+					return 0;
+				}
+
+				std::shared_ptr<const AssetPack> m_assetPack;
+				std::size_t m_entryIndex;
+				ByteArray m_content;
+				UInt64 m_cursor;
+				bool m_isDecompressed;
+		};
+	}
+
+	/*!
+	* \ingroup core
+	* \class Nz::AssetPack
+	* \brief Core class that represents a read-only pack of assets, built by AssetPackBuilder
+	*
+	* The pack file is memory-mapped and its index is kept sorted by path, uncompressed entries are accessed without any copy.
+	*
+	* \remark Packs must be opened using OpenFromFile as streams returned by OpenEntry keep the pack alive
+	*/
+
+	AssetPack::AssetPack() :
+	m_data(nullptr),
+	m_size(0)
+	{
+	}
+
+	/*!
+	* \brief Decompresses an entry
+	* \return true if the entry was successfully decompressed
+	*
+	* \param entryIndex Index of the entry
+	* \param buffer Buffer receiving the entry data, must be at least GetEntry(entryIndex).size bytes long
+	*/
+	bool AssetPack::Decompress(std::size_t entryIndex, void* buffer) const
+	{
+		const Entry& entry = GetEntry(entryIndex);
+		switch (entry.compression)
+		{
+			case AssetPackCompression::None:
+			{
+				std::memcpy(buffer, entry.data, entry.size);
+				return true;
+			}
+
+			case AssetPackCompression::LZ4:
+			{
+				if (entry.size > std::numeric_limits<int>::max() || entry.storedSize > std::numeric_limits<int>::max())
+				{
+					NazaraError("failed to decompress {0} from {1}: entry is too big for LZ4", entry.path, m_filePath);
+					return false;
+				}
+
+				int decompressedSize = LZ4_decompress_safe(reinterpret_cast<const char*>(entry.data), static_cast<char*>(buffer), static_cast<int>(entry.storedSize), static_cast<int>(entry.size));
+				if (decompressedSize < 0 || static_cast<UInt64>(decompressedSize) != entry.size)
+				{
+					NazaraError("failed to decompress {0} from {1}: corrupted LZ4 data", entry.path, m_filePath);
+					return false;
+				}
+
+				return true;
+			}
+
+			case AssetPackCompression::Zstd:
+			{
+				std::size_t decompressedSize = ZSTD_decompress(buffer, entry.size, entry.data, entry.storedSize);
+				if (ZSTD_isError(decompressedSize) || decompressedSize != entry.size)
+				{
+					NazaraError("failed to decompress {0} from {1}: {2}", entry.path, m_filePath, (ZSTD_isError(decompressedSize)) ? ZSTD_getErrorName(decompressedSize) : "size mismatch");
+					return false;
+				}
+
+				return true;
+			}
+		}
+
+		NazaraError("unhandled compression {0:#x}", UnderlyingCast(entry.compression));
+		return false;
+	}
+
+	/*!
+	* \brief Finds an entry by its path
+	* \return Index of the entry or std::nullopt if no entry has this path
+	*
+	* \param path Path of the entry (using '/' as separator, without leading separator)
+	*/
+	std::optional<std::size_t> AssetPack::FindEntry(std::string_view path) const
+	{
+		std::size_t entryIndex = FindFirstEntry(path);
+		if (entryIndex >= m_entries.size() || m_entries[entryIndex].path != path)
+			return std::nullopt;
+
+		return entryIndex;
+	}
+
+	/*!
+	* \brief Finds the first entry whose path is greater or equal to pathPrefix
+	* \return Index of the entry or GetEntryCount() if none
+	*
+	* As entries are sorted by path, every entry starting with pathPrefix is found starting from this index.
+	*
+	* \param pathPrefix Path prefix
+	*/
+	std::size_t AssetPack::FindFirstEntry(std::string_view pathPrefix) const
+	{
+		auto it = std::lower_bound(m_entries.begin(), m_entries.end(), pathPrefix, [](const Entry& entry, std::string_view path)
+		{
+			return entry.path < path;
+		});
+
+		return static_cast<std::size_t>(std::distance(m_entries.begin(), it));
+	}
+
+	/*!
+	* \brief Opens a stream on an entry
+	* \return Stream on the entry content, which keeps the pack alive
+	*
+	* Uncompressed entries are returned as a memory-mapped view on the pack, compressed entries are decompressed in memory on first read (and are not memory-mapped).
+	*
+	* \param entryIndex Index of the entry
+	*/
+	std::shared_ptr<Stream> AssetPack::OpenEntry(std::size_t entryIndex) const
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		const Entry& entry = GetEntry(entryIndex);
+		if (entry.compression != AssetPackCompression::None)
+			return std::make_shared<CompressedEntryStream>(shared_from_this(), entryIndex);
+
+		std::shared_ptr<const AssetPack> pack = shared_from_this();
+		return std::shared_ptr<Stream>(new MemoryView(entry.data, entry.size), [pack = std::move(pack)](Stream* stream)
+		{
+			delete stream;
+		});
+	}
+
+	/*!
+	* \brief Opens an asset pack
+	* \return Asset pack or null if an error occurred
+	*
+	* \param filePath Path to the pack
+	*/
+	std::shared_ptr<AssetPack> AssetPack::OpenFromFile(const std::filesystem::path& filePath)
+	{
+		std::shared_ptr<AssetPack> pack = std::make_shared<AssetPack>();
+		pack->m_filePath = filePath;
+
+		if (!pack->m_file.Open(filePath, OpenMode::Read | OpenMode::MemoryMapped))
+		{
+			NazaraError("failed to open asset pack {0}", filePath);
+			return nullptr;
+		}
+
+		if (!pack->m_file.IsMemoryMapped())
+		{
+			NazaraError("failed to open asset pack {0}: file could not be mapped", filePath);
+			return nullptr;
+		}
+
+		pack->m_data = static_cast<const UInt8*>(pack->m_file.GetMappedPointer());
+		pack->m_size = pack->m_file.GetSize();
+
+		if (!pack->ParseIndex())
+			return nullptr;
+
+		return pack;
+	}
+
+	bool AssetPack::ParseIndex()
+	{
+		if (m_size < HeaderSize)
+		{
+			NazaraError("failed to open asset pack {0}: file is too small", m_filePath);
+			return false;
+		}
+
+		ByteStream headerStream(m_data, HeaderSize);
+		headerStream.SetDataEndianness(Endianness::LittleEndian);
+
+		UInt32 magic, version, entryCount, reserved;
+		UInt64 indexOffset, indexSize;
+		headerStream >> magic >> version >> entryCount >> reserved >> indexOffset >> indexSize;
+
+		if (magic != Magic)
+		{
+			NazaraError("failed to open asset pack {0}: not an asset pack", m_filePath);
+			return false;
+		}
+
+		if (version != Version)
+		{
+			NazaraError("failed to open asset pack {0}: unsupported version {1}", m_filePath, version);
+			return false;
+		}
+
+		if (indexOffset > m_size || indexSize > m_size - indexOffset || UInt64(entryCount) * IndexEntrySize > indexSize)
+		{
+			NazaraError("failed to open asset pack {0}: corrupted index", m_filePath);
+			return false;
+		}
+
+		// Paths are stored right after the entry table
+		const char* stringTable = reinterpret_cast<const char*>(m_data + indexOffset + UInt64(entryCount) * IndexEntrySize);
+		UInt64 stringTableSize = indexSize - UInt64(entryCount) * IndexEntrySize;
+
+		ByteStream indexStream(m_data + indexOffset, UInt64(entryCount) * IndexEntrySize);
+		indexStream.SetDataEndianness(Endianness::LittleEndian);
+
+		m_entries.resize(entryCount);
+		for (Entry& entry : m_entries)
+		{
+			UInt32 pathOffset, pathSize;
+			UInt64 dataOffset;
+			UInt8 compression;
+			UInt8 padding[7];
+			indexStream >> pathOffset >> pathSize >> dataOffset >> entry.storedSize >> entry.size >> compression;
+			indexStream.Read(padding, sizeof(padding));
+
+			if (UInt64(pathOffset) + pathSize > stringTableSize || dataOffset > m_size || entry.storedSize > m_size - dataOffset || compression > UnderlyingCast(AssetPackCompression::Max) ||
+			    (compression == UnderlyingCast(AssetPackCompression::None) && entry.size != entry.storedSize))
+			{
+				NazaraError("failed to open asset pack {0}: corrupted index", m_filePath);
+				return false;
+			}
+
+			entry.path = std::string_view(stringTable + pathOffset, pathSize);
+			entry.data = m_data + dataOffset;
+			entry.compression = static_cast<AssetPackCompression>(compression);
+		}
+
+		if (!std::is_sorted(m_entries.begin(), m_entries.end(), [](const Entry& lhs, const Entry& rhs) { return lhs.path < rhs.path; }))
+		{
+			NazaraError("failed to open asset pack {0}: index is not sorted", m_filePath);
+			return false;
+		}
+
+		return true;
+	}
+}
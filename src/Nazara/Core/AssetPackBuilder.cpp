@@ -0,0 +1,277 @@
+// Copyright (C) 2026 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#include <Nazara/Core/AssetPackBuilder.hpp>
+#include <Nazara/Core/AssetPack.hpp>
+#include <Nazara/Core/ByteStream.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/File.hpp>
+#include <NazaraUtils/Algorithm.hpp>
+#include <NazaraUtils/PathUtils.hpp>
+#include <lz4hc.h>
+#include <zstd.h>
+#include <algorithm>
+#include <array>
+#include <limits>
+
+namespace Nz
+{
+	/*!
+	* \ingroup core
+	* \class Nz::AssetPackBuilder
+	* \brief Core class used to build asset packs (see AssetPack)
+	*/
+
+	/*!
+	* \brief Adds every file of a directory (recursively)
+	*
+	* \param directoryPath Path to the directory
+	* \param compression Compression used for the files
+	* \param pathPrefix Prefix added to the path of the files in the pack
+	*/
+	void AssetPackBuilder::AddDirectory(const std::filesystem::path& directoryPath, AssetPackCompression compression, std::string_view pathPrefix)
+	{
+		std::string prefix = NormalizePath(pathPrefix);
+		if (!prefix.empty())
+			prefix += '/';
+
+		for (auto&& entry : std::filesystem::recursive_directory_iterator(directoryPath))
+		{
+			if (!entry.is_regular_file())
+				continue;
+
+			std::string relativePath = PathToString(std::filesystem::relative(entry.path(), directoryPath));
+			AddFile(prefix + relativePath, entry.path(), compression);
+		}
+	}
+
+	/*!
+	* \brief Adds an entry from memory
+	*
+	* \param path Path of the entry in the pack
+	* \param content Content of the entry
+	* \param compression Compression used for the entry
+	*/
+	void AssetPackBuilder::AddEntry(std::string_view path, ByteArray content, AssetPackCompression compression)
+	{
+		m_entries.push_back({
+			.path = NormalizePath(path),
+			.source = std::move(content),
+			.compression = compression
+		});
+	}
+
+	/*!
+	* \brief Adds an entry from a file
+	*
+	* \param path Path of the entry in the pack
+	* \param filePath Path to the file, which is only read when building the pack
+	* \param compression Compression used for the entry
+	*/
+	void AssetPackBuilder::AddFile(std::string_view path, std::filesystem::path filePath, AssetPackCompression compression)
+	{
+		m_entries.push_back({
+			.path = NormalizePath(path),
+			.source = std::move(filePath),
+			.compression = compression
+		});
+	}
+
+	/*!
+	* \brief Builds the pack
+	* \return true if the pack was successfully written
+	*
+	* Entries whose compression wouldn't save any space are stored uncompressed.
+	*
+	* \param outputPath Path of the pack file
+	*/
+	bool AssetPackBuilder::Build(const std::filesystem::path& outputPath) const
+	{
+		// Entries are sorted by path to allow binary searching and directory listing
+		std::vector<const PendingEntry*> sortedEntries;
+		sortedEntries.reserve(m_entries.size());
+		for (const PendingEntry& entry : m_entries)
+			sortedEntries.push_back(&entry);
+
+		std::sort(sortedEntries.begin(), sortedEntries.end(), [](const PendingEntry* lhs, const PendingEntry* rhs) { return lhs->path < rhs->path; });
+
+		for (std::size_t i = 1; i < sortedEntries.size(); ++i)
+		{
+			if (sortedEntries[i - 1]->path == sortedEntries[i]->path)
+			{
+				NazaraError("failed to build asset pack: {0} was added multiple times", sortedEntries[i]->path);
+				return false;
+			}
+		}
+
+		if (sortedEntries.size() > std::numeric_limits<UInt32>::max())
+		{
+			NazaraError("failed to build asset pack: too many entries");
+			return false;
+		}
+
+		File file(outputPath);
+		if (!file.Open(OpenMode::Write | OpenMode::Truncate))
+		{
+			NazaraError("failed to open {0}", outputPath);
+			return false;
+		}
+
+		// Header is written last, once the index offset is known
+		std::array<UInt8, AssetPack::HeaderSize> zeroes = {};
+		file.Write(zeroes.data(), zeroes.size());
+
+		ByteArray index;
+		ByteStream indexStream(&index, OpenMode::Write);
+		indexStream.SetDataEndianness(Endianness::LittleEndian);
+
+		std::string stringTable;
+
+		UInt64 offset = AssetPack::HeaderSize;
+		ByteArray compressedContent;
+		for (const PendingEntry* entry : sortedEntries)
+		{
+			ByteArray content;
+			if (const ByteArray* byteArray = std::get_if<ByteArray>(&entry->source))
+				content = *byteArray;
+			else
+			{
+				const std::filesystem::path& filePath = std::get<std::filesystem::path>(entry->source);
+				std::optional<std::vector<UInt8>> fileContent = File::ReadWhole(filePath);
+				if (!fileContent)
+				{
+					NazaraError("failed to build asset pack: failed to read {0}", filePath);
+					return false;
+				}
+
+				content = ByteArray(fileContent->data(), fileContent->size());
+			}
+
+			AssetPackCompression compression = entry->compression;
+			const ByteArray* storedContent = &content;
+			if (compression != AssetPackCompression::None)
+			{
+				if (Compress(content, compression, compressedContent) && compressedContent.GetSize() < content.GetSize())
+					storedContent = &compressedContent;
+				else
+					compression = AssetPackCompression::None;
+			}
+
+			// Align entries so their content can be used in place (e.g. for pixel data)
+			UInt64 alignedOffset = AlignPow2(offset, UInt64(AssetPack::DataAlignment));
+			if (alignedOffset != offset)
+			{
+				file.Write(zeroes.data(), static_cast<std::size_t>(alignedOffset - offset));
+				offset = alignedOffset;
+			}
+
+			if (file.Write(storedContent->GetConstBuffer(), storedContent->GetSize()) != storedContent->GetSize())
+			{
+				NazaraError("failed to build asset pack: failed to write {0}", entry->path);
+				return false;
+			}
+
+			std::array<UInt8, 7> padding = {};
+
+			indexStream << UInt32(stringTable.size()) << UInt32(entry->path.size());
+			indexStream << offset << UInt64(storedContent->GetSize()) << UInt64(content.GetSize()) << UInt8(UnderlyingCast(compression));
+			indexStream.Write(padding.data(), padding.size());
+
+			stringTable += entry->path;
+			offset += storedContent->GetSize();
+		}
+
+		indexStream.Write(stringTable.data(), stringTable.size());
+		indexStream.FlushBits();
+
+		UInt64 indexOffset = AlignPow2(offset, UInt64(AssetPack::DataAlignment));
+		if (indexOffset != offset)
+			file.Write(zeroes.data(), static_cast<std::size_t>(indexOffset - offset));
+
+		if (file.Write(index.GetConstBuffer(), index.GetSize()) != index.GetSize())
+		{
+			NazaraError("failed to build asset pack: failed to write index");
+			return false;
+		}
+
+		file.SetCursorPos(0);
+
+		ByteStream headerStream(&file);
+		headerStream.SetDataEndianness(Endianness::LittleEndian);
+		headerStream << AssetPack::Magic << AssetPack::Version << UInt32(sortedEntries.size()) << UInt32(0) << indexOffset << UInt64(index.GetSize());
+		headerStream.FlushBits();
+
+		return true;
+	}
+
+	/*!
+	* \brief Removes every entry from the builder
+	*/
+	void AssetPackBuilder::Clear()
+	{
+		m_entries.clear();
+	}
+
+	/*!
+	* \brief Normalizes a path for use in a pack
+	* \return Normalized path, using '/' as separator without leading or trailing separator
+	*
+	* \param path Path to normalize
+	*/
+	std::string AssetPackBuilder::NormalizePath(std::string_view path)
+	{
+		std::string normalizedPath(path);
+		std::replace(normalizedPath.begin(), normalizedPath.end(), '\\', '/');
+
+		std::size_t firstChar = normalizedPath.find_first_not_of('/');
+		if (firstChar == std::string::npos)
+			return {};
+
+		std::size_t lastChar = normalizedPath.find_last_not_of('/');
+		return normalizedPath.substr(firstChar, lastChar - firstChar + 1);
+	}
+
+	bool AssetPackBuilder::Compress(const ByteArray& content, AssetPackCompression compression, ByteArray& output) const
+	{
+		switch (compression)
+		{
+			case AssetPackCompression::None:
+				return false;
+
+			case AssetPackCompression::LZ4:
+			{
+				if (content.GetSize() > LZ4_MAX_INPUT_SIZE)
+					return false;
+
+				int inputSize = static_cast<int>(content.GetSize());
+				output.Resize(LZ4_compressBound(inputSize));
+
+				int compressedSize = LZ4_compress_HC(reinterpret_cast<const char*>(content.GetConstBuffer()), reinterpret_cast<char*>(output.GetBuffer()), inputSize, static_cast<int>(output.GetSize()), m_lz4CompressionLevel);
+				if (compressedSize <= 0)
+					return false;
+
+				output.Resize(compressedSize);
+				return true;
+			}
+
+			case AssetPackCompression::Zstd:
+			{
+				output.Resize(ZSTD_compressBound(content.GetSize()));
+
+				std::size_t compressedSize = ZSTD_compress(output.GetBuffer(), output.GetSize(), content.GetConstBuffer(), content.GetSize(), m_zstdCompressionLevel);
+				if (ZSTD_isError(compressedSize))
+				{
+					NazaraWarning("failed to compress with zstd: {0}", ZSTD_getErrorName(compressedSize));
+					return false;
+				}
+
+				output.Resize(compressedSize);
+				return true;
+			}
+		}
+
+		NazaraError("unhandled compression {0:#x}", UnderlyingCast(compression));
+		return false;
+	}
+}
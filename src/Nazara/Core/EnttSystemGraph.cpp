@@ -3,6 +3,8 @@
 // For conditions of distribution and use, see copyright notice in Export.hpp
 
 #include <Nazara/Core/EnttSystemGraph.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <algorithm>
 
 namespace Nz
 {
@@ -17,23 +19,152 @@ namespace Nz
 	{
 		if (!m_systemOrderUpdated)
 		{
-			m_orderedNodes.clear();
-			m_orderedNodes.reserve(m_nodes.size());
-			for (auto& nodePtr : m_nodes)
+			BuildExecutionGraph();
+			m_systemOrderUpdated = true;
+		}
+
+		for (const NodeGroup& group : m_nodeGroups)
+		{
+			if (m_taskScheduler && group.nodeCount > 1)
+				UpdateConcurrentGroup(group, elapsedTime);
+			else
 			{
-				if (nodePtr->HasUpdate())
-					m_orderedNodes.emplace_back(nodePtr.get());
+				for (std::size_t i = 0; i < group.nodeCount; ++i)
+					m_orderedNodes[group.firstNode + i].node->Update(elapsedTime);
 			}
+		}
+	}
 
-			std::sort(m_orderedNodes.begin(), m_orderedNodes.end(), [](const NodeBase* a, const NodeBase* b)
+	void EnttSystemGraph::BuildExecutionGraph()
+	{
+		m_orderedNodes.clear();
+		m_orderedNodes.reserve(m_nodes.size());
+		for (auto& nodePtr : m_nodes)
+		{
+			if (nodePtr->HasUpdate())
 			{
-				return a->executionOrder < b->executionOrder;
-			});
+				auto& orderedNode = m_orderedNodes.emplace_back();
+				orderedNode.node = nodePtr.get();
+				orderedNode.dependencyCount = 0;
+			}
+		}
 
-			m_systemOrderUpdated = true;
+		// Keep systems with the same execution order in their insertion order, so conflicting systems always run in the same order
+		std::stable_sort(m_orderedNodes.begin(), m_orderedNodes.end(), [](const OrderedNode& a, const OrderedNode& b)
+		{
+			return a.node->executionOrder < b.node->executionOrder;
+		});
+
+		// Split nodes in groups of consecutive concurrent systems sharing the same execution order, non-concurrent systems get a group of their own
+		m_nodeGroups.clear();
+		for (std::size_t i = 0; i < m_orderedNodes.size(); ++i)
+		{
+			const NodeBase& node = *m_orderedNodes[i].node;
+			if (!m_nodeGroups.empty() && node.allowConcurrent)
+			{
+				NodeGroup& lastGroup = m_nodeGroups.back();
+				const NodeBase& lastGroupNode = *m_orderedNodes[lastGroup.firstNode].node;
+				if (lastGroupNode.allowConcurrent && lastGroupNode.executionOrder == node.executionOrder)
+				{
+					lastGroup.nodeCount++;
+					continue;
+				}
+			}
+
+			auto& group = m_nodeGroups.emplace_back();
+			group.firstNode = i;
+			group.nodeCount = 1;
+		}
+
+		// Inside a group, a system depends on every previous system it conflicts with
+		for (const NodeGroup& group : m_nodeGroups)
+		{
+			for (std::size_t i = group.firstNode; i < group.firstNode + group.nodeCount; ++i)
+			{
+				for (std::size_t j = i + 1; j < group.firstNode + group.nodeCount; ++j)
+				{
+					if (HasAccessConflict(*m_orderedNodes[i].node, *m_orderedNodes[j].node))
+					{
+						m_orderedNodes[i].dependents.push_back(j);
+						m_orderedNodes[j].dependencyCount++;
+					}
+				}
+			}
+		}
+
+		m_remainingDependencies = std::make_unique<std::atomic_uint[]>(m_orderedNodes.size());
+	}
+
+	void EnttSystemGraph::DispatchNode(std::size_t nodeIndex, Time elapsedTime)
+	{
+		m_taskScheduler->AddTask([this, nodeIndex, elapsedTime]
+		{
+			const OrderedNode& orderedNode = m_orderedNodes[nodeIndex];
+			orderedNode.node->Update(elapsedTime);
+
+			for (std::size_t dependentIndex : orderedNode.dependents)
+			{
+				if (--m_remainingDependencies[dependentIndex] == 0)
+					DispatchNode(dependentIndex, elapsedTime);
+			}
+
+			// m_remainingNodes is a member (and not a local variable of UpdateConcurrentGroup) as it's still accessed by notify_one after the waiting thread may have returned
+			if (--m_remainingNodes == 0)
+				m_remainingNodes.notify_one();
+		});
+	}
+
+	void EnttSystemGraph::UpdateConcurrentGroup(const NodeGroup& group, Time elapsedTime)
+	{
+		m_remainingNodes = static_cast<unsigned int>(group.nodeCount);
+
+		// Reset dependency counters before dispatching anything, as a dispatched node may decrement them
+		for (std::size_t i = group.firstNode; i < group.firstNode + group.nodeCount; ++i)
+			m_remainingDependencies[i] = m_orderedNodes[i].dependencyCount;
+
+		for (std::size_t i = group.firstNode; i < group.firstNode + group.nodeCount; ++i)
+		{
+			if (m_orderedNodes[i].dependencyCount == 0)
+				DispatchNode(i, elapsedTime);
+		}
+
+		// Wait until every node of the group has been updated
+		for (;;)
+		{
+			unsigned int remainingNodes = m_remainingNodes.load();
+			if (remainingNodes == 0)
+				break;
+
+			m_remainingNodes.wait(remainingNodes);
+		}
+	}
+
+	bool EnttSystemGraph::HasAccessConflict(const NodeBase& first, const NodeBase& second)
+	{
+		// Systems without any declared component could access anything
+		if (first.readComponents.empty() && first.writeComponents.empty())
+			return true;
+
+		if (second.readComponents.empty() && second.writeComponents.empty())
+			return true;
+
+		auto Contains = [](const std::vector<entt::id_type>& components, entt::id_type componentId)
+		{
+			return std::find(components.begin(), components.end(), componentId) != components.end();
+		};
+
+		for (entt::id_type componentId : first.writeComponents)
+		{
+			if (Contains(second.readComponents, componentId) || Contains(second.writeComponents, componentId))
+				return true;
+		}
+
+		for (entt::id_type componentId : second.writeComponents)
+		{
+			if (Contains(first.readComponents, componentId))
+				return true;
 		}
 
-		for (NodeBase* node : m_orderedNodes)
-			node->Update(elapsedTime);
+		return false;
 	}
 }
@@ -91,6 +91,7 @@ namespace Nz
 			m_impl.reset();
 
 			m_openMode = OpenMode::NotOpen;
+			m_streamOptions &= ~StreamOption::MemoryMapped;
 		}
 	}
 
@@ -180,6 +181,12 @@ namespace Nz
 		if (openMode == OpenMode::NotOpen)
 			return false;
 
+		if (openMode.Test(OpenMode::MemoryMapped) && openMode.Test(OpenMode::Write))
+		{
+			NazaraError("memory-mapped files can only be opened in read mode");
+			return false;
+		}
+
 		m_openMode = openMode;
 		if (m_openMode.Test(OpenMode::Defer))
 		{
@@ -197,7 +204,10 @@ namespace Nz
 
 		m_impl = std::move(impl);
 
-		EnableBuffering(!m_openMode.Test(OpenMode::Unbuffered));
+		if (m_openMode.Test(OpenMode::MemoryMapped))
+			MapFile();
+		else
+			EnableBuffering(!m_openMode.Test(OpenMode::Unbuffered));
 
 		if (m_openMode & OpenMode::Text)
 			m_streamOptions |= StreamOption::Text;
@@ -247,6 +257,9 @@ namespace Nz
 			}
 
 			m_impl = std::move(impl);
+
+			if (m_openMode.Test(OpenMode::MemoryMapped))
+				MapFile();
 		}
 
 		m_filePath = std::filesystem::absolute(filePath);
@@ -329,6 +342,28 @@ namespace Nz
 		m_impl->Flush();
 	}
 
+	void* File::GetMemoryMappedPointer() const
+	{
+		NazaraAssertMsg(m_impl, "file is not open");
+
+		return const_cast<void*>(m_impl->GetMappedPointer());
+	}
+
+	void File::MapFile()
+	{
+		// Reads are served from the mapping, buffering would only add an extra copy
+		EnableBuffering(false);
+
+		if (m_impl->Map())
+			m_streamOptions |= StreamOption::MemoryMapped;
+		else
+		{
+			// Empty files (or unsupported ones) fall back to regular reads
+			m_streamOptions &= ~StreamOption::MemoryMapped;
+			EnableBuffering(!m_openMode.Test(OpenMode::Unbuffered));
+		}
+	}
+
 	/*!
 	* \brief Reads blocks
 	* \return Number of blocks read
@@ -451,6 +486,12 @@ namespace Nz
 	*/
 	NAZARA_CORE_API bool HashAppend(AbstractHash& hash, const File& originalFile)
 	{
+		if (originalFile.IsMemoryMapped())
+		{
+			hash.Append(static_cast<const UInt8*>(originalFile.GetMappedPointer()), originalFile.GetSize());
+			return true;
+		}
+
 		File file(originalFile.GetPath());
 		if (!file.Open(OpenMode::Read))
 		{
@@ -392,60 +392,12 @@ namespace Nz
 
 	bool Image::ConvertTo(PixelFormat newFormat)
 	{
-		NazaraAssertMsg(IsValid(), "invalid image");
-		NazaraAssertMsg(PixelFormatInfo::IsValid(newFormat), "invalid pixel format");
-
-		if (m_sharedImage->format == newFormat)
-			return true;
-
-		NazaraCheck(PixelFormatInfo::IsConversionSupported(m_sharedImage->format, newFormat), "conversion from %s to %s is not supported", PixelFormatInfo::GetName(m_sharedImage->format), PixelFormatInfo::GetName(newFormat));
-
-		SharedImage::PixelContainer levels;
-		levels.resize(m_sharedImage->levels.size());
-
-		UInt32 width = m_sharedImage->width;
-		UInt32 height = m_sharedImage->height;
-		UInt32 depth = m_sharedImage->depth;
-		if (m_sharedImage->type == ImageType::Cubemap)
-			depth *= 6;
-
-		bool succeeded = ImageUtils::ForEachLevel(levels.size(), m_sharedImage->type, width, height, depth, [&](UInt8 level, UInt32 width, UInt32 height, UInt32 depth)
-		{
-			UInt8* src = m_sharedImage->levels[level].get();
-			if (!src)
-				return true;
-
-			std::size_t pixelsPerFace = static_cast<std::size_t>(width) * height;
-			levels[level] = std::make_unique_for_overwrite<UInt8[]>(pixelsPerFace * depth * PixelFormatInfo::GetBytesPerPixel(newFormat));
-			UInt8* dst = levels[level].get();
-
-			std::size_t srcStride = pixelsPerFace * PixelFormatInfo::GetBytesPerPixel(m_sharedImage->format);
-			std::size_t dstStride = pixelsPerFace * PixelFormatInfo::GetBytesPerPixel(newFormat);
-
-			for (UInt32 d = 0; d < depth; ++d)
-			{
-				if (!PixelFormatInfo::Convert(m_sharedImage->format, newFormat, src, &src[srcStride], dst))
-				{
-					NazaraError("failed to convert image");
-					return false;
-				}
-
-				src += srcStride;
-				dst += dstStride;
-			}
-
-			return true;
-		});
-
-		if (!succeeded)
-			return false;
-
-		SharedImage* newImage = new SharedImage(1, m_sharedImage->type, newFormat, std::move(levels), m_sharedImage->width, m_sharedImage->height, m_sharedImage->depth);
-
-		ReleaseImage();
-		m_sharedImage = newImage;
+		return ConvertToFormat(newFormat, nullptr);
+	}
 
-		return true;
+	bool Image::ConvertTo(TaskScheduler& taskScheduler, PixelFormat newFormat)
+	{
+		return ConvertToFormat(newFormat, &taskScheduler);
 	}
 
 	void Image::Copy(const Image& source, const Boxui32& srcBox, const Vector3ui32& dstPos)
@@ -1461,6 +1413,76 @@ namespace Nz
 		return core->GetImageLoader().LoadFromStream(stream, params);
 	}
 
+	bool Image::ConvertToFormat(PixelFormat newFormat, TaskScheduler* taskScheduler)
+	{
+		NazaraAssertMsg(IsValid(), "invalid image");
+		NazaraAssertMsg(PixelFormatInfo::IsValid(newFormat), "invalid pixel format");
+
+		if (m_sharedImage->format == newFormat)
+			return true;
+
+		NazaraCheck(PixelFormatInfo::IsConversionSupported(m_sharedImage->format, newFormat), "conversion from %s to %s is not supported", PixelFormatInfo::GetName(m_sharedImage->format), PixelFormatInfo::GetName(newFormat));
+
+		SharedImage::PixelContainer levels;
+		levels.resize(m_sharedImage->levels.size());
+
+		UInt32 width = m_sharedImage->width;
+		UInt32 height = m_sharedImage->height;
+		UInt32 depth = m_sharedImage->depth;
+		if (m_sharedImage->type == ImageType::Cubemap)
+			depth *= 6;
+
+		bool succeeded = ImageUtils::ForEachLevel(levels.size(), m_sharedImage->type, width, height, depth, [&](UInt8 level, UInt32 width, UInt32 height, UInt32 depth)
+		{
+			UInt8* src = m_sharedImage->levels[level].get();
+			if (!src)
+				return true;
+
+			std::size_t pixelsPerFace = static_cast<std::size_t>(width) * height;
+			levels[level] = std::make_unique_for_overwrite<UInt8[]>(pixelsPerFace * depth * PixelFormatInfo::GetBytesPerPixel(newFormat));
+			UInt8* dst = levels[level].get();
+
+			std::size_t srcStride = pixelsPerFace * PixelFormatInfo::GetBytesPerPixel(m_sharedImage->format);
+			std::size_t dstStride = pixelsPerFace * PixelFormatInfo::GetBytesPerPixel(newFormat);
+
+			if (taskScheduler)
+			{
+				// Slices are contiguous, convert them at once so rows can be split evenly between workers
+				if (!PixelFormatInfo::Convert(*taskScheduler, m_sharedImage->format, newFormat, src, &src[srcStride * depth], dst))
+				{
+					NazaraError("failed to convert image");
+					return false;
+				}
+
+				return true;
+			}
+
+			for (UInt32 d = 0; d < depth; ++d)
+			{
+				if (!PixelFormatInfo::Convert(m_sharedImage->format, newFormat, src, &src[srcStride], dst))
+				{
+					NazaraError("failed to convert image");
+					return false;
+				}
+
+				src += srcStride;
+				dst += dstStride;
+			}
+
+			return true;
+		});
+
+		if (!succeeded)
+			return false;
+
+		SharedImage* newImage = new SharedImage(1, m_sharedImage->type, newFormat, std::move(levels), m_sharedImage->width, m_sharedImage->height, m_sharedImage->depth);
+
+		ReleaseImage();
+		m_sharedImage = newImage;
+
+		return true;
+	}
+
 	void Image::EnsureOwnership()
 	{
 		if (m_sharedImage == &emptyImage)
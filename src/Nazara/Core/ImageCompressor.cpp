@@ -4,7 +4,14 @@
 
 #include <Nazara/Core/ImageCompressor.hpp>
 #include <Nazara/Core/Image.hpp>
+#include <Nazara/Core/ParallelAlgorithm.hpp>
+#include <Nazara/Core/SimdUtils.hpp>
 #include <NazaraUtils/MathUtils.hpp>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <limits>
 
 #define STB_DXT_IMPLEMENTATION
 #include <stb/stb_dxt.h>
@@ -21,11 +28,9 @@ namespace Nz::ImageCompressor
 		{
 			static constexpr std::size_t TargetBpp = 1;
 
-			template<UInt32 BlockSize>
-			static void Extract(const UInt8* input, std::size_t sourcePitch, std::span<UInt8, BlockSize * BlockSize * 1> output)
+			static void ExtractPixel(const UInt8* input, UInt8* output)
 			{
-				for (std::size_t y = 0; y < BlockSize; ++y)
-					std::memcpy(&output[y * BlockSize * 1], &input[y * sourcePitch], BlockSize * 1);
+				output[0] = input[0];
 			}
 		};
 
@@ -34,11 +39,10 @@ namespace Nz::ImageCompressor
 		{
 			static constexpr std::size_t TargetBpp = 2;
 
-			template<UInt32 BlockSize>
-			static void Extract(const UInt8* input, std::size_t sourcePitch, std::span<UInt8, BlockSize * BlockSize * 2> output)
+			static void ExtractPixel(const UInt8* input, UInt8* output)
 			{
-				for (std::size_t y = 0; y < BlockSize; ++y)
-					std::memcpy(&output[y * BlockSize * 2], &input[y * sourcePitch], BlockSize * 2);
+				output[0] = input[0];
+				output[1] = input[1];
 			}
 		};
 
@@ -47,66 +51,640 @@ namespace Nz::ImageCompressor
 		{
 			static constexpr std::size_t TargetBpp = 4;
 
-			template<UInt32 BlockSize>
-			static void Extract(const UInt8* input, std::size_t sourcePitch, std::span<UInt8, BlockSize * BlockSize * 4> output)
+			static void ExtractPixel(const UInt8* input, UInt8* output)
 			{
-				const UInt8* inputPtr = input;
-				UInt8* outputPtr = output.data();
-				for (std::size_t y = 0; y < BlockSize; ++y)
+				output[0] = input[0];
+				output[1] = input[1];
+				output[2] = input[2];
+				output[3] = 0xFF;
+			}
+		};
+
+		template<>
+		struct BlockExtractor<PixelFormat::RGBA8>
+		{
+			static constexpr std::size_t TargetBpp = 4;
+
+			static void ExtractPixel(const UInt8* input, UInt8* output)
+			{
+				std::memcpy(output, input, 4);
+			}
+		};
+
+		template<PixelFormat SourceFormat, UInt32 BlockSize>
+		void ExtractBlock(const UInt8* pixels, std::size_t sourcePitch, std::size_t bpp, UInt32 blockX, UInt32 blockY, UInt32 width, UInt32 height, std::span<UInt8, BlockSize * BlockSize * BlockExtractor<SourceFormat>::TargetBpp> output)
+		{
+			constexpr std::size_t TargetBpp = BlockExtractor<SourceFormat>::TargetBpp;
+
+			// Pixels outside of the image (when its size isn't a multiple of the block size) are clamped to its edges
+			for (UInt32 y = 0; y < BlockSize; ++y)
+			{
+				UInt32 sourceY = std::min(blockY * BlockSize + y, height - 1);
+				const UInt8* sourceRow = &pixels[sourceY * sourcePitch];
+
+				for (UInt32 x = 0; x < BlockSize; ++x)
+				{
+					UInt32 sourceX = std::min(blockX * BlockSize + x, width - 1);
+					BlockExtractor<SourceFormat>::ExtractPixel(&sourceRow[sourceX * bpp], &output[(y * BlockSize + x) * TargetBpp]);
+				}
+			}
+		}
+
+		/********************************Fast BC1-5*********************************/
+
+		// Computes the bounding box of the 16 RGBA pixels of a block
+		void ComputeColorBounds(const UInt8* block, UInt8* minColor, UInt8* maxColor)
+		{
+#if defined(NAZARA_CORE_SIMD_SSE2)
+			__m128i row0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&block[0]));
+			__m128i row1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&block[16]));
+			__m128i row2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&block[32]));
+			__m128i row3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&block[48]));
+
+			__m128i minValues = _mm_min_epu8(_mm_min_epu8(row0, row1), _mm_min_epu8(row2, row3));
+			__m128i maxValues = _mm_max_epu8(_mm_max_epu8(row0, row1), _mm_max_epu8(row2, row3));
+
+			// Reduce the four pixels of each register to one
+			minValues = _mm_min_epu8(minValues, _mm_shuffle_epi32(minValues, _MM_SHUFFLE(1, 0, 3, 2)));
+			minValues = _mm_min_epu8(minValues, _mm_shuffle_epi32(minValues, _MM_SHUFFLE(2, 3, 0, 1)));
+			maxValues = _mm_max_epu8(maxValues, _mm_shuffle_epi32(maxValues, _MM_SHUFFLE(1, 0, 3, 2)));
+			maxValues = _mm_max_epu8(maxValues, _mm_shuffle_epi32(maxValues, _MM_SHUFFLE(2, 3, 0, 1)));
+
+			Int32 packedMin = _mm_cvtsi128_si32(minValues);
+			Int32 packedMax = _mm_cvtsi128_si32(maxValues);
+			std::memcpy(minColor, &packedMin, 4);
+			std::memcpy(maxColor, &packedMax, 4);
+#elif defined(NAZARA_CORE_SIMD_NEON)
+			uint8x16_t row0 = vld1q_u8(&block[0]);
+			uint8x16_t row1 = vld1q_u8(&block[16]);
+			uint8x16_t row2 = vld1q_u8(&block[32]);
+			uint8x16_t row3 = vld1q_u8(&block[48]);
+
+			uint8x16_t minValues = vminq_u8(vminq_u8(row0, row1), vminq_u8(row2, row3));
+			uint8x16_t maxValues = vmaxq_u8(vmaxq_u8(row0, row1), vmaxq_u8(row2, row3));
+
+			// Reduce the four pixels of each register to one
+			uint8x8_t minPair = vmin_u8(vget_low_u8(minValues), vget_high_u8(minValues));
+			uint8x8_t maxPair = vmax_u8(vget_low_u8(maxValues), vget_high_u8(maxValues));
+			minPair = vmin_u8(minPair, vreinterpret_u8_u32(vrev64_u32(vreinterpret_u32_u8(minPair))));
+			maxPair = vmax_u8(maxPair, vreinterpret_u8_u32(vrev64_u32(vreinterpret_u32_u8(maxPair))));
+
+			UInt32 packedMin = vget_lane_u32(vreinterpret_u32_u8(minPair), 0);
+			UInt32 packedMax = vget_lane_u32(vreinterpret_u32_u8(maxPair), 0);
+			std::memcpy(minColor, &packedMin, 4);
+			std::memcpy(maxColor, &packedMax, 4);
+#else
+			std::memcpy(minColor, block, 4);
+			std::memcpy(maxColor, block, 4);
+			for (std::size_t i = 1; i < 16; ++i)
+			{
+				for (std::size_t c = 0; c < 4; ++c)
+				{
+					minColor[c] = std::min(minColor[c], block[i * 4 + c]);
+					maxColor[c] = std::max(maxColor[c], block[i * 4 + c]);
+				}
+			}
+#endif
+		}
+
+		UInt16 EncodeRGB565(const UInt8* color)
+		{
+			UInt16 r = static_cast<UInt16>((color[0] * 31 + 127) / 255);
+			UInt16 g = static_cast<UInt16>((color[1] * 63 + 127) / 255);
+			UInt16 b = static_cast<UInt16>((color[2] * 31 + 127) / 255);
+
+			return static_cast<UInt16>((r << 11) | (g << 5) | b);
+		}
+
+		void DecodeRGB565(UInt16 color, Int32* output)
+		{
+			Int32 r = (color >> 11) & 0x1F;
+			Int32 g = (color >> 5) & 0x3F;
+			Int32 b = color & 0x1F;
+
+			output[0] = (r << 3) | (r >> 2);
+			output[1] = (g << 2) | (g >> 4);
+			output[2] = (b << 3) | (b >> 2);
+		}
+
+		// Computes the position (0-3) of each pixel along the axis going from origin, with axisLength2 being the squared length of the axis
+		void ComputeColorSteps(const UInt8* block, const Int32* origin, const Int32* axis, Int32 axisLength2, Int32* steps)
+		{
+			float scale = 3.f / axisLength2;
+
+			std::size_t i = 0;
+#if defined(NAZARA_CORE_SIMD_SSE2)
+			const __m128i zero = _mm_setzero_si128();
+			const __m128i originValues = _mm_setr_epi16(Int16(origin[0]), Int16(origin[1]), Int16(origin[2]), 0, Int16(origin[0]), Int16(origin[1]), Int16(origin[2]), 0);
+			const __m128i axisValues = _mm_setr_epi16(Int16(axis[0]), Int16(axis[1]), Int16(axis[2]), 0, Int16(axis[0]), Int16(axis[1]), Int16(axis[2]), 0);
+			const __m128 scaleValues = _mm_set1_ps(scale);
+			const __m128 half = _mm_set1_ps(0.5f);
+			const __m128 minStep = _mm_setzero_ps();
+			const __m128 maxStep = _mm_set1_ps(3.f);
+
+			// Dot products of two pixels, in the two lowest lanes
+			auto ComputeDotProducts = [&](__m128i pixels)
+			{
+				__m128i products = _mm_madd_epi16(_mm_sub_epi16(pixels, originValues), axisValues);
+				products = _mm_add_epi32(products, _mm_shuffle_epi32(products, _MM_SHUFFLE(2, 3, 0, 1)));
+
+				return _mm_shuffle_epi32(products, _MM_SHUFFLE(3, 1, 2, 0));
+			};
+
+			for (; i < 16; i += 4)
+			{
+				__m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&block[i * 4]));
+				__m128i dotProducts = _mm_unpacklo_epi64(ComputeDotProducts(_mm_unpacklo_epi8(pixels, zero)), ComputeDotProducts(_mm_unpackhi_epi8(pixels, zero)));
+
+				__m128 pixelSteps = _mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(dotProducts), scaleValues), half);
+				pixelSteps = _mm_min_ps(_mm_max_ps(pixelSteps, minStep), maxStep);
+
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(&steps[i]), _mm_cvttps_epi32(pixelSteps));
+			}
+#endif
+			for (; i < 16; ++i)
+			{
+				const UInt8* pixel = &block[i * 4];
+				Int32 dotProduct = (pixel[0] - origin[0]) * axis[0] + (pixel[1] - origin[1]) * axis[1] + (pixel[2] - origin[2]) * axis[2];
+
+				float step = static_cast<float>(dotProduct) * scale + 0.5f;
+				steps[i] = static_cast<Int32>(std::clamp(step, 0.f, 3.f));
+			}
+		}
+
+		// The bounding box goes from min to max on every component, which only fits colors increasing together:
+		// flip the components varying in the opposite direction of green to pick the right diagonal
+		void SelectDiagonal(const UInt8* block, std::size_t componentCount, UInt8* color0, UInt8* color1)
+		{
+			std::array<Int32, 4> center;
+			for (std::size_t c = 0; c < componentCount; ++c)
+				center[c] = (color0[c] + color1[c] + 1) / 2;
+
+			std::array<Int32, 4> covariance = {};
+			for (std::size_t i = 0; i < 16; ++i)
+			{
+				Int32 green = block[i * 4 + 1] - center[1];
+				for (std::size_t c = 0; c < componentCount; ++c)
+					covariance[c] += (block[i * 4 + c] - center[c]) * green;
+			}
+
+			for (std::size_t c = 0; c < componentCount; ++c)
+			{
+				if (covariance[c] < 0)
+					std::swap(color0[c], color1[c]);
+			}
+		}
+
+		// Encodes a BC1 color block (in four colors mode) using the inset bounding box of the colors as endpoints
+		// see "Real-Time DXT Compression" by J.M.P. van Waveren
+		void EncodeColorBlockFast(const UInt8* block, const UInt8* minColor, const UInt8* maxColor, UInt8* output)
+		{
+			std::array<UInt8, 3> insetMin;
+			std::array<UInt8, 3> insetMax;
+			for (std::size_t c = 0; c < 3; ++c)
+			{
+				UInt8 inset = static_cast<UInt8>((maxColor[c] - minColor[c]) >> 4);
+				insetMin[c] = static_cast<UInt8>(minColor[c] + inset);
+				insetMax[c] = static_cast<UInt8>(maxColor[c] - inset);
+			}
+
+			SelectDiagonal(block, 3, insetMax.data(), insetMin.data());
+
+			UInt16 color0 = EncodeRGB565(insetMax.data());
+			UInt16 color1 = EncodeRGB565(insetMin.data());
+
+			// color0 > color1 selects the four colors mode
+			if (color0 < color1)
+				std::swap(color0, color1);
+
+			UInt32 indices = 0;
+			if (color0 != color1)
+			{
+				Int32 endpoint0[3];
+				Int32 endpoint1[3];
+				DecodeRGB565(color0, endpoint0);
+				DecodeRGB565(color1, endpoint1);
+
+				Int32 axis[3] = { endpoint0[0] - endpoint1[0], endpoint0[1] - endpoint1[1], endpoint0[2] - endpoint1[2] };
+				Int32 axisLength2 = axis[0] * axis[0] + axis[1] * axis[1] + axis[2] * axis[2];
+
+				std::array<Int32, 16> steps;
+				ComputeColorSteps(block, endpoint1, axis, axisLength2, steps.data());
+
+				// Palette is color0, color1, 2/3 color0 + 1/3 color1, 1/3 color0 + 2/3 color1
+				constexpr std::array<UInt32, 4> stepToIndex = { 1, 3, 2, 0 };
+				for (std::size_t i = 0; i < 16; ++i)
+					indices |= stepToIndex[steps[i]] << (i * 2);
+			}
+
+			output[0] = static_cast<UInt8>(color0 & 0xFF);
+			output[1] = static_cast<UInt8>(color0 >> 8);
+			output[2] = static_cast<UInt8>(color1 & 0xFF);
+			output[3] = static_cast<UInt8>(color1 >> 8);
+			for (std::size_t i = 0; i < 4; ++i)
+				output[4 + i] = static_cast<UInt8>(indices >> (i * 8));
+		}
+
+		// Encodes a BC4 block (also used for BC3 alpha) in eight values mode using the range of the values as endpoints
+		void EncodeValueBlockFast(const UInt8* values, std::size_t stride, UInt8 minValue, UInt8 maxValue, UInt8* output)
+		{
+			UInt64 indices = 0;
+			if (maxValue > minValue)
+			{
+				UInt32 range = maxValue - minValue;
+
+				// Palette is max, min then six values going from max to min
+				for (std::size_t i = 0; i < 16; ++i)
+				{
+					UInt32 step = ((values[i * stride] - minValue) * 14 + range) / (range * 2);
+					UInt64 index = (step == 0) ? 1 : (step == 7) ? 0 : 8 - step;
+					indices |= index << (i * 3);
+				}
+			}
+
+			output[0] = maxValue;
+			output[1] = minValue;
+			for (std::size_t i = 0; i < 6; ++i)
+				output[2 + i] = static_cast<UInt8>(indices >> (i * 8));
+		}
+
+		void EncodeValueBlockFast(const UInt8* values, std::size_t stride, UInt8* output)
+		{
+			UInt8 minValue = values[0];
+			UInt8 maxValue = values[0];
+			for (std::size_t i = 1; i < 16; ++i)
+			{
+				minValue = std::min(minValue, values[i * stride]);
+				maxValue = std::max(maxValue, values[i * stride]);
+			}
+
+			EncodeValueBlockFast(values, stride, minValue, maxValue, output);
+		}
+
+		/***********************************BC7*************************************/
+
+		// Only mode 6 is used (one subset, RGBA 7.7.7.7 endpoints with a p-bit each, 4bits indices), which handles alpha and is the most precise single subset mode
+		constexpr std::array<Int32, 16> BC7Weights = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+		struct BC7Endpoint
+		{
+			std::array<UInt8, 4> values; //< 7bits
+			UInt8 pBit;
+
+			UInt8 Decode(std::size_t component) const
+			{
+				return static_cast<UInt8>((values[component] << 1) | pBit);
+			}
+		};
+
+		struct BC7Block
+		{
+			BC7Endpoint endpoints[2];
+			std::array<UInt8, 16> indices;
+			UInt32 error;
+		};
+
+		BC7Endpoint QuantizeBC7Endpoint(const float* color)
+		{
+			BC7Endpoint bestEndpoint;
+			float bestError = std::numeric_limits<float>::infinity();
+			for (UInt8 pBit = 0; pBit < 2; ++pBit)
+			{
+				BC7Endpoint endpoint;
+				endpoint.pBit = pBit;
+
+				float error = 0.f;
+				for (std::size_t c = 0; c < 4; ++c)
+				{
+					float value = std::clamp(std::round((color[c] - pBit) * 0.5f), 0.f, 127.f);
+					endpoint.values[c] = static_cast<UInt8>(value);
+
+					float delta = color[c] - endpoint.Decode(c);
+					error += delta * delta;
+				}
+
+				if (error < bestError)
+				{
+					bestEndpoint = endpoint;
+					bestError = error;
+				}
+			}
+
+			return bestEndpoint;
+		}
+
+		// Picks the nearest palette entry for each pixel and returns the total squared error
+		UInt32 ComputeBC7Indices(const UInt8* block, const BC7Endpoint& endpoint0, const BC7Endpoint& endpoint1, std::array<UInt8, 16>& indices)
+		{
+			std::array<std::array<Int32, 4>, 16> palette;
+			for (std::size_t i = 0; i < 16; ++i)
+			{
+				for (std::size_t c = 0; c < 4; ++c)
+					palette[i][c] = ((64 - BC7Weights[i]) * endpoint0.Decode(c) + BC7Weights[i] * endpoint1.Decode(c) + 32) >> 6;
+			}
+
+			UInt32 totalError = 0;
+			for (std::size_t i = 0; i < 16; ++i)
+			{
+				const UInt8* pixel = &block[i * 4];
+
+				UInt32 bestError = std::numeric_limits<UInt32>::max();
+				for (std::size_t j = 0; j < 16; ++j)
 				{
-					const UInt8* sourceRowPtr = inputPtr;
-					for (std::size_t x = 0; x < BlockSize; ++x)
+					UInt32 error = 0;
+					for (std::size_t c = 0; c < 4; ++c)
 					{
-						outputPtr[0] = input[0];
-						outputPtr[1] = input[1];
-						outputPtr[2] = input[2];
-						outputPtr[3] = 0xFF;
+						Int32 delta = pixel[c] - palette[j][c];
+						error += static_cast<UInt32>(delta * delta);
+					}
 
-						sourceRowPtr += 4;
-						outputPtr += 4;
+					if (error < bestError)
+					{
+						bestError = error;
+						indices[i] = static_cast<UInt8>(j);
 					}
+				}
+
+				totalError += bestError;
+			}
+
+			return totalError;
+		}
 
-					inputPtr += sourcePitch;
+		BC7Block EncodeBC7Endpoints(const UInt8* block, const float* color0, const float* color1)
+		{
+			BC7Block encodedBlock;
+			encodedBlock.endpoints[0] = QuantizeBC7Endpoint(color0);
+			encodedBlock.endpoints[1] = QuantizeBC7Endpoint(color1);
+			encodedBlock.error = ComputeBC7Indices(block, encodedBlock.endpoints[0], encodedBlock.endpoints[1], encodedBlock.indices);
+
+			return encodedBlock;
+		}
+
+		// Computes the endpoints minimizing the error for the current indices (least squares)
+		bool RefineBC7Endpoints(const UInt8* block, const std::array<UInt8, 16>& indices, float* color0, float* color1)
+		{
+			float a = 0.f, b = 0.f, c = 0.f;
+			std::array<float, 4> x0 = {};
+			std::array<float, 4> x1 = {};
+			for (std::size_t i = 0; i < 16; ++i)
+			{
+				float weight = BC7Weights[indices[i]] / 64.f;
+				float invWeight = 1.f - weight;
+
+				a += invWeight * invWeight;
+				b += invWeight * weight;
+				c += weight * weight;
+				for (std::size_t k = 0; k < 4; ++k)
+				{
+					x0[k] += invWeight * block[i * 4 + k];
+					x1[k] += weight * block[i * 4 + k];
 				}
 			}
-		};
 
-		template<>
-		struct BlockExtractor<PixelFormat::RGBA8>
+			float determinant = a * c - b * b;
+			if (std::abs(determinant) < 1e-6f)
+				return false;
+
+			float invDeterminant = 1.f / determinant;
+			for (std::size_t k = 0; k < 4; ++k)
+			{
+				color0[k] = std::clamp((c * x0[k] - b * x1[k]) * invDeterminant, 0.f, 255.f);
+				color1[k] = std::clamp((a * x1[k] - b * x0[k]) * invDeterminant, 0.f, 255.f);
+			}
+
+			return true;
+		}
+
+		// Finds the principal axis of the block colors and the extents of the colors along it
+		void ComputeBC7PrincipalEndpoints(const UInt8* block, float* color0, float* color1)
 		{
-			static constexpr std::size_t TargetBpp = 4;
+			std::array<float, 4> mean = {};
+			for (std::size_t i = 0; i < 16; ++i)
+			{
+				for (std::size_t k = 0; k < 4; ++k)
+					mean[k] += block[i * 4 + k];
+			}
+
+			for (float& value : mean)
+				value /= 16.f;
+
+			std::array<std::array<float, 4>, 4> covariance = {};
+			for (std::size_t i = 0; i < 16; ++i)
+			{
+				std::array<float, 4> delta;
+				for (std::size_t k = 0; k < 4; ++k)
+					delta[k] = block[i * 4 + k] - mean[k];
 
-			template<UInt32 BlockSize>
-			static void Extract(const UInt8* input, std::size_t sourcePitch, std::span<UInt8, BlockSize * BlockSize * 4> output)
+				for (std::size_t row = 0; row < 4; ++row)
+				{
+					for (std::size_t column = 0; column < 4; ++column)
+						covariance[row][column] += delta[row] * delta[column];
+				}
+			}
+
+			// Power iteration, starting from the covariance column of the component with the largest variance
+			std::size_t largestComponent = 0;
+			for (std::size_t k = 1; k < 4; ++k)
 			{
-				for (std::size_t y = 0; y < BlockSize; ++y)
-					std::memcpy(&output[y * BlockSize * 4], &input[y * sourcePitch], BlockSize * 4);
+				if (covariance[k][k] > covariance[largestComponent][largestComponent])
+					largestComponent = k;
 			}
-		};
+
+			std::array<float, 4> axis = covariance[largestComponent];
+
+			for (unsigned int iteration = 0; iteration < 8; ++iteration)
+			{
+				std::array<float, 4> newAxis = {};
+				for (std::size_t row = 0; row < 4; ++row)
+				{
+					for (std::size_t column = 0; column < 4; ++column)
+						newAxis[row] += covariance[row][column] * axis[column];
+				}
+
+				float length = std::sqrt(newAxis[0] * newAxis[0] + newAxis[1] * newAxis[1] + newAxis[2] * newAxis[2] + newAxis[3] * newAxis[3]);
+				if (length < 1e-6f)
+					break;
+
+				for (std::size_t k = 0; k < 4; ++k)
+					axis[k] = newAxis[k] / length;
+			}
+
+			float axisLength2 = axis[0] * axis[0] + axis[1] * axis[1] + axis[2] * axis[2] + axis[3] * axis[3];
+			if (axisLength2 < 1e-6f)
+			{
+				// Every pixel is the same
+				for (std::size_t k = 0; k < 4; ++k)
+					color0[k] = color1[k] = mean[k];
+
+				return;
+			}
+
+			float minProjection = std::numeric_limits<float>::max();
+			float maxProjection = std::numeric_limits<float>::lowest();
+			for (std::size_t i = 0; i < 16; ++i)
+			{
+				float projection = 0.f;
+				for (std::size_t k = 0; k < 4; ++k)
+					projection += (block[i * 4 + k] - mean[k]) * axis[k];
+
+				minProjection = std::min(minProjection, projection);
+				maxProjection = std::max(maxProjection, projection);
+			}
+
+			minProjection /= axisLength2;
+			maxProjection /= axisLength2;
+			for (std::size_t k = 0; k < 4; ++k)
+			{
+				color0[k] = std::clamp(mean[k] + axis[k] * minProjection, 0.f, 255.f);
+				color1[k] = std::clamp(mean[k] + axis[k] * maxProjection, 0.f, 255.f);
+			}
+		}
+
+		void WriteBC7Block(BC7Block& encodedBlock, UInt8* output)
+		{
+			// First index has an implicit zero high bit, swap endpoints if required
+			if (encodedBlock.indices[0] >= 8)
+			{
+				std::swap(encodedBlock.endpoints[0], encodedBlock.endpoints[1]);
+				for (UInt8& index : encodedBlock.indices)
+					index = static_cast<UInt8>(15 - index);
+			}
+
+			std::array<UInt64, 2> bits = {};
+			std::size_t bitOffset = 0;
+			auto WriteBits = [&](UInt64 value, std::size_t bitCount)
+			{
+				for (std::size_t i = 0; i < bitCount; ++i, ++bitOffset)
+					bits[bitOffset / 64] |= ((value >> i) & 1) << (bitOffset % 64);
+			};
+
+			WriteBits(1 << 6, 7); //< mode 6
+
+			for (std::size_t c = 0; c < 4; ++c)
+			{
+				WriteBits(encodedBlock.endpoints[0].values[c], 7);
+				WriteBits(encodedBlock.endpoints[1].values[c], 7);
+			}
+
+			WriteBits(encodedBlock.endpoints[0].pBit, 1);
+			WriteBits(encodedBlock.endpoints[1].pBit, 1);
+
+			WriteBits(encodedBlock.indices[0], 3);
+			for (std::size_t i = 1; i < 16; ++i)
+				WriteBits(encodedBlock.indices[i], 4);
+
+			for (std::size_t i = 0; i < 16; ++i)
+				output[i] = static_cast<UInt8>(bits[i / 8] >> ((i % 8) * 8));
+		}
 	}
 
-	void RGBA8BlockToBC1(std::span<const UInt8, 16 * 4> input, std::span<UInt8, 8> output)
+	void RGBA8BlockToBC1(std::span<const UInt8, 16 * 4> input, std::span<UInt8, 8> output, ImageCompressionQuality quality)
 	{
-		stb_compress_dxt_block(output.data(), input.data(), 0, STB_DXT_HIGHQUAL);
+		switch (quality)
+		{
+			case ImageCompressionQuality::Fast:
+			{
+				std::array<UInt8, 4> minColor, maxColor;
+				ComputeColorBounds(input.data(), minColor.data(), maxColor.data());
+				EncodeColorBlockFast(input.data(), minColor.data(), maxColor.data(), output.data());
+				break;
+			}
+
+			case ImageCompressionQuality::Normal:
+				stb_compress_dxt_block(output.data(), input.data(), 0, STB_DXT_NORMAL);
+				break;
+
+			case ImageCompressionQuality::High:
+				stb_compress_dxt_block(output.data(), input.data(), 0, STB_DXT_HIGHQUAL);
+				break;
+		}
 	}
 
-	void RGBA8BlockToBC3(std::span<const UInt8, 16 * 4> input, std::span<UInt8, 16> output)
+	void RGBA8BlockToBC3(std::span<const UInt8, 16 * 4> input, std::span<UInt8, 16> output, ImageCompressionQuality quality)
 	{
-		stb_compress_dxt_block(output.data(), input.data(), 1, STB_DXT_HIGHQUAL);
+		switch (quality)
+		{
+			case ImageCompressionQuality::Fast:
+			{
+				std::array<UInt8, 4> minColor, maxColor;
+				ComputeColorBounds(input.data(), minColor.data(), maxColor.data());
+				EncodeValueBlockFast(&input[3], 4, minColor[3], maxColor[3], &output[0]);
+				EncodeColorBlockFast(input.data(), minColor.data(), maxColor.data(), &output[8]);
+				break;
+			}
+
+			case ImageCompressionQuality::Normal:
+				stb_compress_dxt_block(output.data(), input.data(), 1, STB_DXT_NORMAL);
+				break;
+
+			case ImageCompressionQuality::High:
+				stb_compress_dxt_block(output.data(), input.data(), 1, STB_DXT_HIGHQUAL);
+				break;
+		}
 	}
 
-	void R8BlockToBC4(std::span<const UInt8, 16> input, std::span<UInt8, 8> output)
+	void R8BlockToBC4(std::span<const UInt8, 16> input, std::span<UInt8, 8> output, ImageCompressionQuality quality)
 	{
-		stb_compress_bc4_block(output.data(), input.data());
+		if (quality == ImageCompressionQuality::Fast)
+			EncodeValueBlockFast(input.data(), 1, output.data());
+		else
+			stb_compress_bc4_block(output.data(), input.data());
 	}
 
-	void RG8BlockToBC5(std::span<const UInt8, 16 * 2> input, std::span<UInt8, 16> output)
+	void RG8BlockToBC5(std::span<const UInt8, 16 * 2> input, std::span<UInt8, 16> output, ImageCompressionQuality quality)
 	{
-		stb_compress_bc5_block(output.data(), input.data());
+		if (quality == ImageCompressionQuality::Fast)
+		{
+			EncodeValueBlockFast(&input[0], 2, &output[0]);
+			EncodeValueBlockFast(&input[1], 2, &output[8]);
+		}
+		else
+			stb_compress_bc5_block(output.data(), input.data());
+	}
+
+	void RGBA8BlockToBC7(std::span<const UInt8, 16 * 4> input, std::span<UInt8, 16> output, ImageCompressionQuality quality)
+	{
+		const UInt8* block = input.data();
+
+		std::array<float, 4> color0, color1;
+		if (quality == ImageCompressionQuality::Fast)
+		{
+			std::array<UInt8, 4> minColor, maxColor;
+			ComputeColorBounds(block, minColor.data(), maxColor.data());
+			SelectDiagonal(block, 4, minColor.data(), maxColor.data());
+
+			for (std::size_t k = 0; k < 4; ++k)
+			{
+				color0[k] = minColor[k];
+				color1[k] = maxColor[k];
+			}
+		}
+		else
+			ComputeBC7PrincipalEndpoints(block, color0.data(), color1.data());
+
+		BC7Block encodedBlock = EncodeBC7Endpoints(block, color0.data(), color1.data());
+
+		if (quality == ImageCompressionQuality::High)
+		{
+			for (unsigned int iteration = 0; iteration < 2 && encodedBlock.error > 0; ++iteration)
+			{
+				if (!RefineBC7Endpoints(block, encodedBlock.indices, color0.data(), color1.data()))
+					break;
+
+				BC7Block refinedBlock = EncodeBC7Endpoints(block, color0.data(), color1.data());
+				if (refinedBlock.error >= encodedBlock.error)
+					break;
+
+				encodedBlock = refinedBlock;
+			}
+		}
+
+		WriteBC7Block(encodedBlock, output.data());
 	}
 
 	template<PixelFormat SourceFormat, PixelFormat DestFormat, UInt32 BlockSize, std::size_t CompressedBlockSize>
-	Image CompressImage(const Image& sourceImage, auto BlockCompressor)
+	Image CompressImage(const Image& sourceImage, const Settings& settings, auto BlockCompressor)
 	{
 		NazaraAssert(sourceImage.IsValid());
 
@@ -135,64 +713,100 @@ namespace Nz::ImageCompressor
 			if (sourceImage.GetType() == ImageType::Cubemap)
 				depth *= 6;
 
-			UInt32 blockCountX = width / BlockSize;
-			UInt32 blockCountY = height / BlockSize;
+			// Compressed levels can have more blocks than required by the source level (as its size is aligned before being halved)
+			UInt32 blockCountX = (compressedImage.GetWidth(level) + BlockSize - 1) / BlockSize;
+			UInt32 blockCountY = (compressedImage.GetHeight(level) + BlockSize - 1) / BlockSize;
 			std::size_t bpp = PixelFormatInfo::GetBytesPerPixel(sourceFormat);
-			std::size_t sourcePitch = sourceImage.GetWidth(level) * bpp;
+			std::size_t sourcePitch = width * bpp;
 
 			std::size_t bytesPerLayer = PixelFormatInfo::ComputeSize(destFormat, compressedImage.GetWidth(level), compressedImage.GetHeight(level), 1u);
+			UInt8* compressedPixels = compressedImage.GetPixels(level);
 
-			for (UInt32 z = 0; z < depth; ++z)
+			// Block rows of every layer are independent
+			auto CompressBlockRows = [&](std::size_t rowBegin, std::size_t rowEnd)
 			{
-				const UInt8* sourcePixels = sourceImage.GetConstPixels(0, 0, z, level);
-				UInt8* targetPixels = compressedImage.GetPixels(level) + bytesPerLayer * z;
+				constexpr std::size_t TargetBpp = BlockExtractor<SourceFormat>::TargetBpp;
 
-				std::size_t blockIndex = 0;
-				for (UInt32 blockY = 0; blockY < blockCountY; ++blockY)
+				for (std::size_t row = rowBegin; row < rowEnd; ++row)
 				{
-					const UInt8* lineStart = &sourcePixels[blockY * BlockSize * sourcePitch];
+					UInt32 z = static_cast<UInt32>(row / blockCountY);
+					UInt32 blockY = static_cast<UInt32>(row % blockCountY);
+
+					const UInt8* sourcePixels = sourceImage.GetConstPixels(0, 0, z, level);
+					UInt8* targetPixels = compressedPixels + bytesPerLayer * z + std::size_t(blockY) * blockCountX * CompressedBlockSize;
+
 					for (UInt32 blockX = 0; blockX < blockCountX; ++blockX)
 					{
-						constexpr std::size_t TargetBpp = BlockExtractor<SourceFormat>::TargetBpp;
-
 						std::array<UInt8, BlockSize * BlockSize * TargetBpp> blockData;
-						BlockExtractor<SourceFormat>::template Extract<BlockSize>(&lineStart[blockX * BlockSize * bpp], sourcePitch, blockData);
-						BlockCompressor(blockData, std::span<UInt8, CompressedBlockSize>(&targetPixels[blockIndex * CompressedBlockSize], CompressedBlockSize));
-						blockIndex++;
+						ExtractBlock<SourceFormat, BlockSize>(sourcePixels, sourcePitch, bpp, blockX, blockY, width, height, blockData);
+						BlockCompressor(blockData, std::span<UInt8, CompressedBlockSize>(&targetPixels[blockX * CompressedBlockSize], CompressedBlockSize));
 					}
-
-					// TODO: Handle overflow blocks
 				}
+			};
 
-				// TODO: Handle overflow blocks
-			}
+			std::size_t blockRowCount = std::size_t(blockCountY) * depth;
+			if (settings.taskScheduler)
+				ParallelFor(*settings.taskScheduler, 0, blockRowCount, 1, CompressBlockRows);
+			else
+				CompressBlockRows(0, blockRowCount);
 		}
 
 		return compressedImage;
 	}
 
-	Image RGB8ToBC1(const Image& sourceImage)
+	Image RGB8ToBC1(const Image& sourceImage, const Settings& settings)
+	{
+		return CompressImage<PixelFormat::RGB8, PixelFormat::BC1_RGB_Unorm, 4, 8>(sourceImage, settings, [&](std::span<const UInt8, 16 * 4> input, std::span<UInt8, 8> output)
+		{
+			RGBA8BlockToBC1(input, output, settings.quality);
+		});
+	}
+
+	Image RGBA8ToBC1(const Image& sourceImage, const Settings& settings)
+	{
+		return CompressImage<PixelFormat::RGBA8, PixelFormat::BC1_RGBA_Unorm, 4, 8>(sourceImage, settings, [&](std::span<const UInt8, 16 * 4> input, std::span<UInt8, 8> output)
+		{
+			RGBA8BlockToBC1(input, output, settings.quality);
+		});
+	}
+
+	Image RGBA8ToBC3(const Image& sourceImage, const Settings& settings)
 	{
-		return CompressImage<PixelFormat::RGB8, PixelFormat::BC1_RGB_Unorm, 4, 8>(sourceImage, RGBA8BlockToBC1);
+		return CompressImage<PixelFormat::RGBA8, PixelFormat::BC3_Unorm, 4, 16>(sourceImage, settings, [&](std::span<const UInt8, 16 * 4> input, std::span<UInt8, 16> output)
+		{
+			RGBA8BlockToBC3(input, output, settings.quality);
+		});
 	}
 
-	Image RGBA8ToBC1(const Image& sourceImage)
+	Image R8ToBC4(const Image& sourceImage, const Settings& settings)
 	{
-		return CompressImage<PixelFormat::RGBA8, PixelFormat::BC1_RGBA_Unorm, 4, 8>(sourceImage, RGBA8BlockToBC1);
+		return CompressImage<PixelFormat::R8, PixelFormat::BC4_Unorm, 4, 8>(sourceImage, settings, [&](std::span<const UInt8, 16> input, std::span<UInt8, 8> output)
+		{
+			R8BlockToBC4(input, output, settings.quality);
+		});
 	}
 
-	Image RGBA8ToBC3(const Image& sourceImage)
+	Image RG8ToBC5(const Image& sourceImage, const Settings& settings)
 	{
-		return CompressImage<PixelFormat::RGBA8, PixelFormat::BC3_Unorm, 4, 16>(sourceImage, RGBA8BlockToBC3);
+		return CompressImage<PixelFormat::RG8, PixelFormat::BC5_Unorm, 4, 16>(sourceImage, settings, [&](std::span<const UInt8, 16 * 2> input, std::span<UInt8, 16> output)
+		{
+			RG8BlockToBC5(input, output, settings.quality);
+		});
 	}
 
-	Image R8ToBC4(const Image& sourceImage)
+	Image RGB8ToBC7(const Image& sourceImage, const Settings& settings)
 	{
-		return CompressImage<PixelFormat::R8, PixelFormat::BC4_Unorm, 4, 8>(sourceImage, R8BlockToBC4);
+		return CompressImage<PixelFormat::RGB8, PixelFormat::BC7_Unorm, 4, 16>(sourceImage, settings, [&](std::span<const UInt8, 16 * 4> input, std::span<UInt8, 16> output)
+		{
+			RGBA8BlockToBC7(input, output, settings.quality);
+		});
 	}
 
-	Image RG8ToBC5(const Image& sourceImage)
+	Image RGBA8ToBC7(const Image& sourceImage, const Settings& settings)
 	{
-		return CompressImage<PixelFormat::RG8, PixelFormat::BC5_Unorm, 4, 16>(sourceImage, RG8BlockToBC5);
+		return CompressImage<PixelFormat::RGBA8, PixelFormat::BC7_Unorm, 4, 16>(sourceImage, settings, [&](std::span<const UInt8, 16 * 4> input, std::span<UInt8, 16> output)
+		{
+			RGBA8BlockToBC7(input, output, settings.quality);
+		});
 	}
 }
@@ -3,9 +3,16 @@
 // For conditions of distribution and use, see copyright notice in Export.hpp
 
 #include <Nazara/Core/PixelFormat.hpp>
+#include <Nazara/Core/Color.hpp>
 #include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/ParallelAlgorithm.hpp>
+#include <Nazara/Core/SimdUtils.hpp>
 #include <Nazara/Core/StringExt.hpp>
 #include <NazaraUtils/Endianness.hpp>
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <utility>
 
 namespace Nz
 {
@@ -22,6 +29,259 @@ namespace Nz
 			return nullptr;
 		}
 
+		/********************************Helpers*********************************/
+		UInt8 FloatToUnorm8(float value)
+		{
+			// Written so NaN ends up as zero, like the vectorized versions
+			value = (value > 0.f) ? value : 0.f;
+			value = (value < 1.f) ? value : 1.f;
+
+			return static_cast<UInt8>(value * 255.f + 0.5f);
+		}
+
+		const std::array<float, 256>& GetSRGBToLinearTable()
+		{
+			static const std::array<float, 256> table = []
+			{
+				std::array<float, 256> values;
+				for (std::size_t i = 0; i < values.size(); ++i)
+					values[i] = Color::sRGBToLinear(i / 255.f);
+
+				return values;
+			}();
+
+			return table;
+		}
+
+		UInt8 LinearToSRGB8(float value)
+		{
+			// thresholds[i] is the linear value from which a component is encoded as i (the first one is never used)
+			static const std::array<float, 256> thresholds = []
+			{
+				std::array<float, 256> values;
+				values[0] = 0.f;
+				for (std::size_t i = 1; i < values.size(); ++i)
+					values[i] = Color::sRGBToLinear((i - 0.5f) / 255.f);
+
+				return values;
+			}();
+
+			// Exact encoding using a branchless binary search on thresholds (NaN ends up as zero)
+			std::size_t index = 0;
+			for (std::size_t step = 128; step > 0; step >>= 1)
+				index += (value >= thresholds[index + step]) ? step : 0;
+
+			return static_cast<UInt8>(index);
+		}
+
+		/*
+		 * Vectorized kernels for the most common conversions (using SSE2 or NEON when available), pixel kernels process as many pixels as they can
+		 * and return that count, remaining pixels being left to the scalar loops. Vector loads and stores may touch bytes past the pixels they process
+		 * (but never past the buffers), which is why they stop a few pixels before the end.
+		 */
+		std::size_t ExpandRGB8ToRGBA8(const UInt8* src, std::size_t pixelCount, UInt8* dst)
+		{
+			std::size_t i = 0;
+#if defined(NAZARA_CORE_SIMD_SSE2)
+			const __m128i alpha = _mm_set1_epi32(static_cast<int>(0xFF000000u));
+			const __m128i mask0 = _mm_setr_epi32(0x00FFFFFF, 0, 0, 0);
+			const __m128i mask1 = _mm_setr_epi32(0, 0x00FFFFFF, 0, 0);
+			const __m128i mask2 = _mm_setr_epi32(0, 0, 0x00FFFFFF, 0);
+			const __m128i mask3 = _mm_setr_epi32(0, 0, 0, 0x00FFFFFF);
+
+			// 16 bytes are read for 4 pixels (12 bytes)
+			for (; i + 6 <= pixelCount; i += 4)
+			{
+				__m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&src[i * 3]));
+
+				__m128i result = _mm_or_si128(_mm_and_si128(pixels, mask0), _mm_and_si128(_mm_slli_si128(pixels, 1), mask1));
+				result = _mm_or_si128(result, _mm_and_si128(_mm_slli_si128(pixels, 2), mask2));
+				result = _mm_or_si128(result, _mm_and_si128(_mm_slli_si128(pixels, 3), mask3));
+				result = _mm_or_si128(result, alpha);
+
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(&dst[i * 4]), result);
+			}
+#elif defined(NAZARA_CORE_SIMD_NEON)
+			for (; i + 16 <= pixelCount; i += 16)
+			{
+				uint8x16x3_t pixels = vld3q_u8(&src[i * 3]);
+
+				uint8x16x4_t result;
+				result.val[0] = pixels.val[0];
+				result.val[1] = pixels.val[1];
+				result.val[2] = pixels.val[2];
+				result.val[3] = vdupq_n_u8(0xFF);
+
+				vst4q_u8(&dst[i * 4], result);
+			}
+#endif
+			NazaraUnused(src);
+			NazaraUnused(pixelCount);
+			NazaraUnused(dst);
+
+			return i;
+		}
+
+		std::size_t ShrinkRGBA8ToRGB8(const UInt8* src, std::size_t pixelCount, UInt8* dst)
+		{
+			std::size_t i = 0;
+#if defined(NAZARA_CORE_SIMD_SSE2)
+			const __m128i mask0 = _mm_setr_epi32(0x00FFFFFF, 0, 0, 0);
+			const __m128i mask1 = _mm_setr_epi32(0, 0x00FFFFFF, 0, 0);
+			const __m128i mask2 = _mm_setr_epi32(0, 0, 0x00FFFFFF, 0);
+			const __m128i mask3 = _mm_setr_epi32(0, 0, 0, 0x00FFFFFF);
+
+			// 16 bytes are written for 4 pixels (12 bytes), the extra bytes are overwritten by the next pixels
+			for (; i + 6 <= pixelCount; i += 4)
+			{
+				__m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&src[i * 4]));
+
+				__m128i result = _mm_or_si128(_mm_and_si128(pixels, mask0), _mm_srli_si128(_mm_and_si128(pixels, mask1), 1));
+				result = _mm_or_si128(result, _mm_srli_si128(_mm_and_si128(pixels, mask2), 2));
+				result = _mm_or_si128(result, _mm_srli_si128(_mm_and_si128(pixels, mask3), 3));
+
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(&dst[i * 3]), result);
+			}
+#elif defined(NAZARA_CORE_SIMD_NEON)
+			for (; i + 16 <= pixelCount; i += 16)
+			{
+				uint8x16x4_t pixels = vld4q_u8(&src[i * 4]);
+
+				uint8x16x3_t result;
+				result.val[0] = pixels.val[0];
+				result.val[1] = pixels.val[1];
+				result.val[2] = pixels.val[2];
+
+				vst3q_u8(&dst[i * 3], result);
+			}
+#endif
+			NazaraUnused(src);
+			NazaraUnused(pixelCount);
+			NazaraUnused(dst);
+
+			return i;
+		}
+
+		// Swaps first and third component of 4-bytes pixels (RGBA8 <=> BGRA8)
+		std::size_t SwapRedBlue8(const UInt8* src, std::size_t pixelCount, UInt8* dst)
+		{
+			std::size_t i = 0;
+#if defined(NAZARA_CORE_SIMD_SSE2)
+			const __m128i greenAlphaMask = _mm_set1_epi32(static_cast<int>(0xFF00FF00u));
+			const __m128i redBlueMask = _mm_set1_epi32(0x00FF00FF);
+
+			for (; i + 4 <= pixelCount; i += 4)
+			{
+				__m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&src[i * 4]));
+
+				__m128i redBlue = _mm_and_si128(pixels, redBlueMask);
+				__m128i result = _mm_or_si128(_mm_and_si128(pixels, greenAlphaMask), _mm_or_si128(_mm_slli_epi32(redBlue, 16), _mm_srli_epi32(redBlue, 16)));
+
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(&dst[i * 4]), result);
+			}
+#elif defined(NAZARA_CORE_SIMD_NEON)
+			for (; i + 16 <= pixelCount; i += 16)
+			{
+				uint8x16x4_t pixels = vld4q_u8(&src[i * 4]);
+				std::swap(pixels.val[0], pixels.val[2]);
+
+				vst4q_u8(&dst[i * 4], pixels);
+			}
+#endif
+			NazaraUnused(src);
+			NazaraUnused(pixelCount);
+			NazaraUnused(dst);
+
+			return i;
+		}
+
+		// Converts 8bits unsigned normalized components to floats
+		void ConvertUnorm8ToFloat(const UInt8* src, std::size_t componentCount, float* dst)
+		{
+			std::size_t i = 0;
+#if defined(NAZARA_CORE_SIMD_SSE2)
+			const __m128 scale = _mm_set1_ps(1.f / 255.f);
+			const __m128i zero = _mm_setzero_si128();
+
+			for (; i + 16 <= componentCount; i += 16)
+			{
+				__m128i components = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&src[i]));
+				__m128i low = _mm_unpacklo_epi8(components, zero);
+				__m128i high = _mm_unpackhi_epi8(components, zero);
+
+				_mm_storeu_ps(&dst[i +  0], _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(low, zero)), scale));
+				_mm_storeu_ps(&dst[i +  4], _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(low, zero)), scale));
+				_mm_storeu_ps(&dst[i +  8], _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(high, zero)), scale));
+				_mm_storeu_ps(&dst[i + 12], _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(high, zero)), scale));
+			}
+#elif defined(NAZARA_CORE_SIMD_NEON)
+			const float32x4_t scale = vdupq_n_f32(1.f / 255.f);
+
+			for (; i + 16 <= componentCount; i += 16)
+			{
+				uint8x16_t components = vld1q_u8(&src[i]);
+				uint16x8_t low = vmovl_u8(vget_low_u8(components));
+				uint16x8_t high = vmovl_u8(vget_high_u8(components));
+
+				vst1q_f32(&dst[i +  0], vmulq_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(low))), scale));
+				vst1q_f32(&dst[i +  4], vmulq_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(low))), scale));
+				vst1q_f32(&dst[i +  8], vmulq_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(high))), scale));
+				vst1q_f32(&dst[i + 12], vmulq_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(high))), scale));
+			}
+#endif
+			for (; i < componentCount; ++i)
+				dst[i] = src[i] * (1.f / 255.f);
+		}
+
+		// Converts floats to 8bits unsigned normalized components, with clamping and rounding (see FloatToUnorm8)
+		void ConvertFloatToUnorm8(const float* src, std::size_t componentCount, UInt8* dst)
+		{
+			std::size_t i = 0;
+#if defined(NAZARA_CORE_SIMD_SSE2)
+			const __m128 zero = _mm_setzero_ps();
+			const __m128 one = _mm_set1_ps(1.f);
+			const __m128 scale = _mm_set1_ps(255.f);
+			const __m128 half = _mm_set1_ps(0.5f);
+
+			auto ConvertComponents = [&](const float* components)
+			{
+				// _mm_max_ps returns its second operand if any of them is NaN
+				__m128 values = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(components), zero), one);
+				return _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(values, scale), half));
+			};
+
+			for (; i + 16 <= componentCount; i += 16)
+			{
+				__m128i low = _mm_packs_epi32(ConvertComponents(&src[i + 0]), ConvertComponents(&src[i + 4]));
+				__m128i high = _mm_packs_epi32(ConvertComponents(&src[i + 8]), ConvertComponents(&src[i + 12]));
+
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(&dst[i]), _mm_packus_epi16(low, high));
+			}
+#elif defined(NAZARA_CORE_SIMD_NEON)
+			const float32x4_t zero = vdupq_n_f32(0.f);
+			const float32x4_t one = vdupq_n_f32(1.f);
+			const float32x4_t scale = vdupq_n_f32(255.f);
+			const float32x4_t half = vdupq_n_f32(0.5f);
+
+			auto ConvertComponents = [&](const float* components)
+			{
+				// NaN is propagated by min/max and converted to zero
+				float32x4_t values = vminq_f32(vmaxq_f32(vld1q_f32(components), zero), one);
+				return vmovn_u32(vcvtq_u32_f32(vaddq_f32(vmulq_f32(values, scale), half)));
+			};
+
+			for (; i + 16 <= componentCount; i += 16)
+			{
+				uint16x8_t low = vcombine_u16(ConvertComponents(&src[i + 0]), ConvertComponents(&src[i + 4]));
+				uint16x8_t high = vcombine_u16(ConvertComponents(&src[i + 8]), ConvertComponents(&src[i + 12]));
+
+				vst1q_u8(&dst[i], vcombine_u8(vmovn_u16(low), vmovn_u16(high)));
+			}
+#endif
+			for (; i < componentCount; ++i)
+				dst[i] = FloatToUnorm8(src[i]);
+		}
+
 		/**********************************A8***********************************/
 		template<>
 		UInt8* ConvertPixels<PixelFormat::A8, PixelFormat::BGRA8>(const UInt8* start, const UInt8* end, UInt8* dst)
@@ -382,6 +642,10 @@ namespace Nz
 		template<>
 		UInt8* ConvertPixels<PixelFormat::BGRA8, PixelFormat::RGBA8>(const UInt8* start, const UInt8* end, UInt8* dst)
 		{
+			std::size_t processedPixels = SwapRedBlue8(start, (end - start) / 4, dst);
+			start += processedPixels * 4;
+			dst += processedPixels * 4;
+
 			while (start < end)
 			{
 				*dst++ = start[2];
@@ -1182,6 +1446,10 @@ namespace Nz
 		template<>
 		UInt8* ConvertPixels<PixelFormat::RGB8, PixelFormat::RGBA8>(const UInt8* start, const UInt8* end, UInt8* dst)
 		{
+			std::size_t processedPixels = ExpandRGB8ToRGBA8(start, (end - start) / 3, dst);
+			start += processedPixels * 3;
+			dst += processedPixels * 4;
+
 			while (start < end)
 			{
 				*dst++ = start[0];
@@ -1199,17 +1467,7 @@ namespace Nz
 		UInt8* ConvertPixels<PixelFormat::RGB8, PixelFormat::RGBA8_SRGB>(const UInt8* start, const UInt8* end, UInt8* dst)
 		{
 			//FIXME: Not correct
-			while (start < end)
-			{
-				*dst++ = start[0];
-				*dst++ = start[1];
-				*dst++ = start[2];
-				*dst++ = 0xFF;
-
-				start += 3;
-			}
-
-			return dst;
+			return ConvertPixels<PixelFormat::RGB8, PixelFormat::RGBA8>(start, end, dst);
 		}
 
 		template<>
@@ -1261,6 +1519,10 @@ namespace Nz
 		template<>
 		UInt8* ConvertPixels<PixelFormat::RGBA8, PixelFormat::BGRA8>(const UInt8* start, const UInt8* end, UInt8* dst)
 		{
+			std::size_t processedPixels = SwapRedBlue8(start, (end - start) / 4, dst);
+			start += processedPixels * 4;
+			dst += processedPixels * 4;
+
 			while (start < end)
 			{
 				*dst++ = start[2];
@@ -1352,6 +1614,10 @@ namespace Nz
 		template<>
 		UInt8* ConvertPixels<PixelFormat::RGBA8, PixelFormat::RGB8>(const UInt8* start, const UInt8* end, UInt8* dst)
 		{
+			std::size_t processedPixels = ShrinkRGBA8ToRGB8(start, (end - start) / 4, dst);
+			start += processedPixels * 4;
+			dst += processedPixels * 3;
+
 			while (start < end)
 			{
 				*dst++ = start[0];
@@ -1368,16 +1634,7 @@ namespace Nz
 		UInt8* ConvertPixels<PixelFormat::RGBA8, PixelFormat::RGB8_SRGB>(const UInt8* start, const UInt8* end, UInt8* dst)
 		{
 			// FIXME: Not correct
-			while (start < end)
-			{
-				*dst++ = start[0];
-				*dst++ = start[1];
-				*dst++ = start[2];
-
-				start += 4;
-			}
-
-			return dst;
+			return ConvertPixels<PixelFormat::RGBA8, PixelFormat::RGB8>(start, end, dst);
 		}
 
 		template<>
@@ -1414,32 +1671,53 @@ namespace Nz
 		template<>
 		UInt8* ConvertPixels<PixelFormat::RGBA8, PixelFormat::RGBA32F>(const UInt8* start, const UInt8* end, UInt8* dst)
 		{
+			std::size_t componentCount = end - start;
+			ConvertUnorm8ToFloat(start, componentCount, reinterpret_cast<float*>(dst));
+
+			return dst + componentCount * sizeof(float);
+		}
+
+		/*******************************RGBA8_SRGB********************************/
+		template<>
+		UInt8* ConvertPixels<PixelFormat::RGBA8_SRGB, PixelFormat::RGBA32F>(const UInt8* start, const UInt8* end, UInt8* dst)
+		{
+			const std::array<float, 256>& sRGBToLinear = GetSRGBToLinearTable();
+
 			float* ptr = reinterpret_cast<float*>(dst);
 			while (start < end)
 			{
-				*ptr++ = start[0] / 255.f;
-				*ptr++ = start[1] / 255.f;
-				*ptr++ = start[2] / 255.f;
-				*ptr++ = start[3] / 255.f;
+				*ptr++ = sRGBToLinear[start[0]];
+				*ptr++ = sRGBToLinear[start[1]];
+				*ptr++ = sRGBToLinear[start[2]];
+				*ptr++ = start[3] * (1.f / 255.f);
 
 				start += 4;
 			}
 
-			return dst;
+			return reinterpret_cast<UInt8*>(ptr);
 		}
 
 		/**********************************RGBA32F**********************************/
 		template<>
 		UInt8* ConvertPixels<PixelFormat::RGBA32F, PixelFormat::RGBA8>(const UInt8* start, const UInt8* end, UInt8* dst)
+		{
+			std::size_t componentCount = (end - start) / sizeof(float);
+			ConvertFloatToUnorm8(reinterpret_cast<const float*>(start), componentCount, dst);
+
+			return dst + componentCount;
+		}
+
+		template<>
+		UInt8* ConvertPixels<PixelFormat::RGBA32F, PixelFormat::RGBA8_SRGB>(const UInt8* start, const UInt8* end, UInt8* dst)
 		{
 			while (start < end)
 			{
 				const float* ptr = reinterpret_cast<const float*>(start);
 
-				*dst++ = static_cast<UInt8>(ptr[0] * 255.f);
-				*dst++ = static_cast<UInt8>(ptr[1] * 255.f);
-				*dst++ = static_cast<UInt8>(ptr[2] * 255.f);
-				*dst++ = static_cast<UInt8>(ptr[3] * 255.f);
+				*dst++ = LinearToSRGB8(ptr[0]);
+				*dst++ = LinearToSRGB8(ptr[1]);
+				*dst++ = LinearToSRGB8(ptr[2]);
+				*dst++ = FloatToUnorm8(ptr[3]);
 
 				start += 16;
 			}
@@ -1447,12 +1725,6 @@ namespace Nz
 			return dst;
 		}
 
-		template<>
-		UInt8* ConvertPixels<PixelFormat::RGBA32F, PixelFormat::RGBA8_SRGB>(const UInt8* start, const UInt8* end, UInt8* dst)
-		{
-			return ConvertPixels<PixelFormat::RGBA32F, PixelFormat::RGBA8>(start, end, dst);
-		}
-
 		template<PixelFormat Format1, PixelFormat Format2>
 		void RegisterConverter()
 		{
@@ -1460,6 +1732,59 @@ namespace Nz
 		}
 	}
 
+	/*!
+	* \brief Converts pixels from a format to another, splitting the work across a task scheduler
+	* \return true if the conversion succeeded
+	*
+	* Conversions between uncompressed formats are split in ranges of pixels converted in parallel, other conversions are done on the calling thread.
+	*
+	* \param taskScheduler Task scheduler used to convert the pixels
+	* \param srcFormat Format of the source pixels
+	* \param dstFormat Format of the destination pixels
+	* \param start Pointer to the first source pixel
+	* \param end Pointer past the last source pixel
+	* \param dst Pointer to the destination, which must be big enough to hold the converted pixels
+	*
+	* \see Convert
+	*/
+	bool PixelFormatInfo::Convert(TaskScheduler& taskScheduler, PixelFormat srcFormat, PixelFormat dstFormat, const void* start, const void* end, void* dst)
+	{
+		// Below that, splitting the work costs more than it saves
+		constexpr std::size_t GrainSize = 16 * 1024;
+
+		if (srcFormat == dstFormat || IsCompressed(srcFormat) || IsCompressed(dstFormat))
+			return Convert(srcFormat, dstFormat, start, end, dst);
+
+		const ConvertFunction& func = s_convertFunctions[srcFormat][dstFormat];
+		if (!func)
+		{
+			NazaraError("pixel format conversion from {0} to {1} is not supported", GetName(srcFormat), GetName(dstFormat));
+			return false;
+		}
+
+		const UInt8* srcPtr = static_cast<const UInt8*>(start);
+		UInt8* dstPtr = static_cast<UInt8*>(dst);
+
+		std::size_t srcBpp = GetBytesPerPixel(srcFormat);
+		std::size_t dstBpp = GetBytesPerPixel(dstFormat);
+		std::size_t pixelCount = (static_cast<const UInt8*>(end) - srcPtr) / srcBpp;
+
+		std::atomic_bool succeeded = true;
+		ParallelFor(taskScheduler, 0, pixelCount, GrainSize, [&](std::size_t pixelBegin, std::size_t pixelEnd)
+		{
+			if (!func(&srcPtr[pixelBegin * srcBpp], &srcPtr[pixelEnd * srcBpp], &dstPtr[pixelBegin * dstBpp]))
+				succeeded.store(false, std::memory_order_relaxed);
+		});
+
+		if (!succeeded.load(std::memory_order_relaxed))
+		{
+			NazaraError("pixel format conversion from {0} to {1} failed", GetName(srcFormat), GetName(dstFormat));
+			return false;
+		}
+
+		return true;
+	}
+
 	bool PixelFormatInfo::Flip(PixelFlipping flipping, PixelFormat format, unsigned int width, unsigned int height, unsigned int depth, const void* src, void* dst)
 	{
 		NazaraAssertMsg(IsValid(format), "invalid pixel format");
@@ -1869,6 +2194,9 @@ namespace Nz
 		RegisterConverter<PixelFormat::RGBA8, PixelFormat::RGBA8_SRGB>();
 		RegisterConverter<PixelFormat::RGBA8, PixelFormat::RGBA32F>();
 
+		/*******************************RGBA8_SRGB********************************/
+		RegisterConverter<PixelFormat::RGBA8_SRGB, PixelFormat::RGBA32F>();
+
 		/**********************************RGBA32F**********************************/
 		RegisterConverter<PixelFormat::RGBA32F, PixelFormat::RGBA8>();
 		RegisterConverter<PixelFormat::RGBA32F, PixelFormat::RGBA8_SRGB>();
@@ -9,9 +9,13 @@
 #include <NazaraUtils/Algorithm.hpp>
 #include <NazaraUtils/CallOnExit.hpp>
 #include <NazaraUtils/PathUtils.hpp>
+#include <algorithm>
 #include <cstdio>
+#include <cstring>
+#include <limits>
 #include <fcntl.h>
 #include <unistd.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 
 #ifdef NAZARA_PLATFORM_BSD
@@ -26,6 +30,9 @@
 namespace Nz::PlatformImpl
 {
 	FileImpl::FileImpl(const File* /*parent*/) :
+	m_mappedCursor(0),
+	m_mappedSize(0),
+	m_mappedPointer(nullptr),
 	m_fileDescriptor(-1),
 	m_endOfFile(false),
 	m_endOfFileUpdated(true)
@@ -34,12 +41,18 @@ namespace Nz::PlatformImpl
 
 	FileImpl::~FileImpl()
 	{
+		if (m_mappedPointer)
+			munmap(m_mappedPointer, static_cast<std::size_t>(m_mappedSize));
+
 		if (m_fileDescriptor != -1)
 			close(m_fileDescriptor);
 	}
 
 	bool FileImpl::EndOfFile() const
 	{
+		if (m_mappedPointer)
+			return m_mappedCursor >= m_mappedSize;
+
 		if (!m_endOfFileUpdated)
 		{
 			struct stat64 fileSize;
@@ -61,10 +74,51 @@ namespace Nz::PlatformImpl
 
 	UInt64 FileImpl::GetCursorPos() const
 	{
+		if (m_mappedPointer)
+			return m_mappedCursor;
+
 		off64_t position = lseek64(m_fileDescriptor, 0, SEEK_CUR);
 		return static_cast<UInt64>(position);
 	}
 
+	bool FileImpl::Map()
+	{
+		NazaraAssertMsg(!m_mappedPointer, "file is already mapped");
+
+		struct stat64 fileStats;
+		if (fstat64(m_fileDescriptor, &fileStats) == -1)
+		{
+			NazaraError("failed to retrieve file size: {0}", Error::GetLastSystemError());
+			return false;
+		}
+
+		// Empty files can't be mapped
+		if (fileStats.st_size <= 0)
+			return false;
+
+		UInt64 fileSize = static_cast<UInt64>(fileStats.st_size);
+		if (fileSize > std::numeric_limits<std::size_t>::max())
+			return false;
+
+		void* mappedPointer = mmap(nullptr, static_cast<std::size_t>(fileSize), PROT_READ, MAP_PRIVATE, m_fileDescriptor, 0);
+		if (mappedPointer == MAP_FAILED)
+		{
+			NazaraError("failed to map file: {0}", Error::GetLastSystemError());
+			return false;
+		}
+
+		// Resources are usually read from start to end
+		posix_madvise(mappedPointer, static_cast<std::size_t>(fileSize), POSIX_MADV_SEQUENTIAL);
+
+		off64_t position = lseek64(m_fileDescriptor, 0, SEEK_CUR);
+
+		m_mappedCursor = (position > 0) ? static_cast<UInt64>(position) : 0;
+		m_mappedPointer = mappedPointer;
+		m_mappedSize = fileSize;
+
+		return true;
+	}
+
 	bool FileImpl::Open(const std::filesystem::path& filePath, OpenModeFlags mode)
 	{
 		int flags;
@@ -130,6 +184,16 @@ namespace Nz::PlatformImpl
 
 	std::size_t FileImpl::Read(void* buffer, std::size_t size)
 	{
+		if (m_mappedPointer)
+		{
+			std::size_t readSize = (m_mappedCursor < m_mappedSize) ? static_cast<std::size_t>(std::min<UInt64>(size, m_mappedSize - m_mappedCursor)) : 0;
+			if (buffer && readSize > 0)
+				std::memcpy(buffer, static_cast<const UInt8*>(m_mappedPointer) + m_mappedCursor, readSize);
+
+			m_mappedCursor += readSize;
+			return readSize;
+		}
+
 		ssize_t read = SafeRead(m_fileDescriptor, buffer, size);
 		if (read < 0)
 		{
@@ -145,6 +209,27 @@ namespace Nz::PlatformImpl
 
 	bool FileImpl::SetCursorPos(CursorPosition pos, Int64 offset)
 	{
+		if (m_mappedPointer)
+		{
+			Int64 origin;
+			switch (pos)
+			{
+				case CursorPosition::AtBegin:   origin = 0; break;
+				case CursorPosition::AtCurrent: origin = static_cast<Int64>(m_mappedCursor); break;
+				case CursorPosition::AtEnd:     origin = static_cast<Int64>(m_mappedSize); break;
+
+				default:
+					NazaraInternalError("cursor position not handled ({0:#x})", UnderlyingCast(pos));
+					return false;
+			}
+
+			if (origin + offset < 0)
+				return false;
+
+			m_mappedCursor = static_cast<UInt64>(origin + offset);
+			return true;
+		}
+
 		int moveMethod;
 		switch (pos)
 		{
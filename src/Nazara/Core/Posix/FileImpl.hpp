@@ -34,6 +34,8 @@ namespace Nz::PlatformImpl
 			bool EndOfFile() const;
 			void Flush();
 			UInt64 GetCursorPos() const;
+			inline const void* GetMappedPointer() const;
+			bool Map();
 			bool Open(const std::filesystem::path& filePath, OpenModeFlags mode);
 			std::size_t Read(void* buffer, std::size_t size);
 			bool SetCursorPos(CursorPosition pos, Int64 offset);
@@ -44,10 +46,18 @@ namespace Nz::PlatformImpl
 			FileImpl& operator=(FileImpl&&) = delete; ///TODO
 
 		private:
+			UInt64 m_mappedCursor;
+			UInt64 m_mappedSize;
+			void* m_mappedPointer;
 			int m_fileDescriptor;
 			mutable bool m_endOfFile;
 			mutable bool m_endOfFileUpdated;
 	};
+
+	inline const void* FileImpl::GetMappedPointer() const
+	{
+		return m_mappedPointer;
+	}
 }
 
 #endif // NAZARA_CORE_POSIX_FILEIMPL_HPP
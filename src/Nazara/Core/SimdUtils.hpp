@@ -0,0 +1,21 @@
+// Copyright (C) 2026 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#pragma once
+
+#ifndef NAZARA_CORE_SIMDUTILS_HPP
+#define NAZARA_CORE_SIMDUTILS_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+
+// Instruction sets always available on the target architecture (no runtime dispatch required)
+#if defined(NAZARA_ARCH_x86_64) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define NAZARA_CORE_SIMD_SSE2
+	#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+	#define NAZARA_CORE_SIMD_NEON
+	#include <arm_neon.h>
+#endif
+
+#endif // NAZARA_CORE_SIMDUTILS_HPP
@@ -4,15 +4,21 @@
 
 #include <Nazara/Core/TaskScheduler.hpp>
 #include <Nazara/Core/Core.hpp>
+#include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/ThreadExt.hpp>
 #include <NazaraUtils/StackArray.hpp>
 #include <concurrentqueue.h>
+#include <algorithm>
 #include <mutex>
 #include <new>
 #include <random>
 #include <semaphore>
 #include <thread>
 
+#if defined(NAZARA_ARCH_x86) || defined(NAZARA_ARCH_x86_64)
+#include <emmintrin.h>
+#endif
+
 namespace Nz
 {
 	NAZARA_WARNING_PUSH()
@@ -25,12 +31,42 @@ namespace Nz
 #else
 		constexpr std::size_t hardware_destructive_interference_size = 64;
 #endif
+
+		void CpuRelax()
+		{
+#if defined(NAZARA_ARCH_x86) || defined(NAZARA_ARCH_x86_64)
+			_mm_pause();
+#endif
+		}
 	}
 
+	struct TaskScheduler::TaskGroupState
+	{
+		std::atomic_uint remainingTasks = 0;
+	};
+
+	struct TaskScheduler::TaskState
+	{
+		Task task;
+		std::atomic_bool finished = false;
+		std::atomic_uint pendingDependencies = 1; //< starts at one to prevent the task from being scheduled while its dependencies are registered
+		std::mutex continuationMutex;
+		std::shared_ptr<TaskGroupState> group;
+		std::vector<std::shared_ptr<TaskState>> continuations;
+	};
+
 	struct TaskScheduler::Data
 	{
+		void NotifyTaskCompletion()
+		{
+			if (--remainingTasks == 0)
+				remainingTasks.notify_all();
+		}
+
 		std::atomic_uint remainingTasks = 0;
 		std::atomic_uint nextWorkerIndex = 0;
+		std::atomic_uint spinCount = 0;
+		std::atomic_uint yieldCount = 0;
 		std::vector<Worker> workers;
 		unsigned int workerCount;
 	};
@@ -67,12 +103,6 @@ namespace Nz
 				WakeUp();
 			}
 
-			void NotifyTaskCompletion()
-			{
-				if (--m_data.remainingTasks == 0)
-					m_data.remainingTasks.notify_one();
-			}
-
 			void Run()
 			{
 				// Wait until task scheduler started
@@ -92,6 +122,7 @@ namespace Nz
 					std::shuffle(randomWorkerIndices.begin(), randomWorkerIndices.end(), gen);
 				}
 
+				unsigned int idleCount = 0;
 				while (m_running.load(std::memory_order_relaxed))
 				{
 					// Get a task
@@ -108,15 +139,31 @@ namespace Nz
 
 					if (task)
 					{
+						idleCount = 0;
+
 						task();
 
-						NotifyTaskCompletion();
+						m_data.NotifyTaskCompletion();
 					}
 					else
 					{
-						// Wait for tasks if we don't have any right now
-						m_notifier.wait(false);
-						m_notifier.clear();
+						// Spin, then yield, before waiting for tasks to reduce wake up latency when tasks are added in bursts
+						unsigned int spinCount = m_data.spinCount.load(std::memory_order_relaxed);
+						unsigned int yieldCount = m_data.yieldCount.load(std::memory_order_relaxed);
+						if (idleCount < spinCount)
+							NAZARA_ANONYMOUS_NAMESPACE_PREFIX(CpuRelax());
+						else if (idleCount < spinCount + yieldCount)
+							std::this_thread::yield();
+						else
+						{
+							// Wait for tasks if we don't have any right now
+							m_notifier.wait(false);
+							m_notifier.clear();
+							idleCount = 0;
+							continue;
+						}
+
+						idleCount++;
 					}
 				}
 			}
@@ -165,13 +212,20 @@ namespace Nz
 
 	NAZARA_WARNING_POP()
 
-	TaskScheduler::TaskScheduler(unsigned int workerCount)
+	TaskScheduler::TaskScheduler(unsigned int workerCount) :
+	TaskScheduler(workerCount, WorkerBackoff{})
+	{
+	}
+
+	TaskScheduler::TaskScheduler(unsigned int workerCount, const WorkerBackoff& workerBackoff)
 	{
 		if (workerCount == 0)
 			workerCount = std::max(Core::Instance()->GetHardwareInfo().GetCpuThreadCount(), 1u);
 
 		m_data = std::make_unique<Data>();
 		m_data->workerCount = workerCount;
+		m_data->spinCount = workerBackoff.spinCount;
+		m_data->yieldCount = workerBackoff.yieldCount;
 
 		m_data->workers.reserve(workerCount);
 		for (unsigned int i = 0; i < workerCount; ++i)
@@ -192,6 +246,16 @@ namespace Nz
 			worker.WaitForExit();
 	}
 
+	auto TaskScheduler::AddContinuation(const TaskHandle& dependency, Task&& continuation) -> TaskHandle
+	{
+		return CreateTask(nullptr, std::move(continuation), std::span(&dependency, 1));
+	}
+
+	auto TaskScheduler::AddContinuation(TaskGroup& group, const TaskHandle& dependency, Task&& continuation) -> TaskHandle
+	{
+		return CreateTask(&group, std::move(continuation), std::span(&dependency, 1));
+	}
+
 	void TaskScheduler::AddTask(Task&& task)
 	{
 		m_data->remainingTasks++;
@@ -202,15 +266,83 @@ namespace Nz
 		worker.AddTask(std::move(task));
 	}
 
+	auto TaskScheduler::AddTask(Task&& task, std::span<const TaskHandle> dependencies) -> TaskHandle
+	{
+		return CreateTask(nullptr, std::move(task), dependencies);
+	}
+
+	auto TaskScheduler::AddTask(TaskGroup& group, Task&& task, std::span<const TaskHandle> dependencies) -> TaskHandle
+	{
+		return CreateTask(&group, std::move(task), dependencies);
+	}
+
+	auto TaskScheduler::GetWorkerBackoff() const -> WorkerBackoff
+	{
+		WorkerBackoff workerBackoff;
+		workerBackoff.spinCount = m_data->spinCount.load(std::memory_order_relaxed);
+		workerBackoff.yieldCount = m_data->yieldCount.load(std::memory_order_relaxed);
+
+		return workerBackoff;
+	}
+
 	unsigned int TaskScheduler::GetWorkerCount() const
 	{
 		return m_data->workerCount;
 	}
 
-	void TaskScheduler::WaitForTasks()
+	void TaskScheduler::SetWorkerBackoff(const WorkerBackoff& workerBackoff)
+	{
+		m_data->spinCount.store(workerBackoff.spinCount, std::memory_order_relaxed);
+		m_data->yieldCount.store(workerBackoff.yieldCount, std::memory_order_relaxed);
+	}
+
+	bool TaskScheduler::TryRunTask()
+	{
+		// Start from a different worker each time to spread stealing
+		unsigned int firstWorkerIndex = m_data->nextWorkerIndex.load(std::memory_order_relaxed);
+		for (unsigned int i = 0; i < m_data->workerCount; ++i)
+		{
+			Task task = m_data->workers[(firstWorkerIndex + i) % m_data->workerCount].StealTask();
+			if (task)
+			{
+				task();
+
+				m_data->NotifyTaskCompletion();
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	void TaskScheduler::WaitForTask(const TaskHandle& task, WaitMode waitMode)
+	{
+		NazaraAssertMsg(task.IsValid(), "invalid task handle");
+
+		if (waitMode == WaitMode::Participate)
+			WaitParticipating([&] { return task.IsFinished(); }, [&] { task.Wait(); });
+		else
+			task.Wait();
+	}
+
+	void TaskScheduler::WaitForTasks(const TaskGroup& group, WaitMode waitMode)
+	{
+		if (waitMode == WaitMode::Participate)
+			WaitParticipating([&] { return group.IsFinished(); }, [&] { group.Wait(); });
+		else
+			group.Wait();
+	}
+
+	void TaskScheduler::WaitForTasks(WaitMode waitMode)
 	{
+		if (waitMode == WaitMode::Participate)
+		{
+			WaitParticipating([&] { return m_data->remainingTasks.load() == 0; }, [&] { WaitForTasks(WaitMode::Block); });
+			return;
+		}
+
 		// Wait until remaining task counter reaches 0
-		for (;;) 
+		for (;;)
 		{
 			// Load and test current value
 			unsigned int remainingTasks = m_data->remainingTasks.load();
@@ -222,4 +354,137 @@ namespace Nz
 			m_data->remainingTasks.wait(remainingTasks);
 		}
 	}
+
+	auto TaskScheduler::CreateTask(TaskGroup* group, Task&& task, std::span<const TaskHandle> dependencies) -> TaskHandle
+	{
+		std::shared_ptr<TaskState> taskState = std::make_shared<TaskState>();
+		taskState->task = std::move(task);
+		if (group)
+		{
+			taskState->group = group->m_state;
+			taskState->group->remainingTasks++;
+		}
+
+		for (const TaskHandle& dependency : dependencies)
+		{
+			NazaraAssertMsg(dependency.IsValid(), "invalid dependency");
+
+			TaskState& dependencyState = *dependency.m_state;
+
+			std::lock_guard lock(dependencyState.continuationMutex);
+			if (dependencyState.finished.load(std::memory_order_relaxed))
+				continue;
+
+			taskState->pendingDependencies++;
+			dependencyState.continuations.push_back(taskState);
+		}
+
+		// Release the registration guard, schedule the task if all its dependencies are already done
+		if (--taskState->pendingDependencies == 0)
+			ScheduleTask(taskState);
+
+		return TaskHandle(std::move(taskState));
+	}
+
+	void TaskScheduler::RunTask(TaskState& taskState)
+	{
+		taskState.task();
+		taskState.task = nullptr; //< release captured resources as soon as possible
+
+		std::vector<std::shared_ptr<TaskState>> continuations;
+		{
+			std::lock_guard lock(taskState.continuationMutex);
+			taskState.finished = true;
+			continuations = std::move(taskState.continuations);
+		}
+		taskState.finished.notify_all();
+
+		// Continuations have to be scheduled before this task is marked as completed, to prevent WaitForTasks from returning before them
+		for (std::shared_ptr<TaskState>& continuation : continuations)
+		{
+			if (--continuation->pendingDependencies == 0)
+				ScheduleTask(std::move(continuation));
+		}
+
+		if (taskState.group)
+		{
+			if (--taskState.group->remainingTasks == 0)
+				taskState.group->remainingTasks.notify_all();
+		}
+	}
+
+	void TaskScheduler::WaitParticipating(FunctionRef<bool()> isFinished, FunctionRef<void()> block)
+	{
+		unsigned int idleCount = 0;
+		while (!isFinished())
+		{
+			if (TryRunTask())
+			{
+				idleCount = 0;
+				continue;
+			}
+
+			// Remaining tasks are being run by workers, back off like workers do before blocking
+			unsigned int spinCount = m_data->spinCount.load(std::memory_order_relaxed);
+			unsigned int yieldCount = m_data->yieldCount.load(std::memory_order_relaxed);
+			if (idleCount < spinCount)
+				NAZARA_ANONYMOUS_NAMESPACE_PREFIX(CpuRelax());
+			else if (idleCount < spinCount + yieldCount)
+				std::this_thread::yield();
+			else
+			{
+				block();
+				break;
+			}
+
+			idleCount++;
+		}
+	}
+
+	void TaskScheduler::ScheduleTask(std::shared_ptr<TaskState> taskState)
+	{
+		AddTask([this, taskState = std::move(taskState)]
+		{
+			RunTask(*taskState);
+		});
+	}
+
+	TaskScheduler::TaskGroup::TaskGroup() :
+	m_state(std::make_shared<TaskGroupState>())
+	{
+	}
+
+	unsigned int TaskScheduler::TaskGroup::GetRemainingTaskCount() const
+	{
+		return m_state->remainingTasks.load(std::memory_order_relaxed);
+	}
+
+	bool TaskScheduler::TaskGroup::IsFinished() const
+	{
+		return m_state->remainingTasks.load() == 0;
+	}
+
+	void TaskScheduler::TaskGroup::Wait() const
+	{
+		for (;;)
+		{
+			unsigned int remainingTasks = m_state->remainingTasks.load();
+			if (remainingTasks == 0)
+				break;
+
+			m_state->remainingTasks.wait(remainingTasks);
+		}
+	}
+
+	bool TaskScheduler::TaskHandle::IsFinished() const
+	{
+		NazaraAssertMsg(IsValid(), "invalid task handle");
+		return m_state->finished.load();
+	}
+
+	void TaskScheduler::TaskHandle::Wait() const
+	{
+		NazaraAssertMsg(IsValid(), "invalid task handle");
+		m_state->finished.wait(false);
+	}
 }
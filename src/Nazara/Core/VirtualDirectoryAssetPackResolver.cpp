@@ -0,0 +1,75 @@
+// Copyright (C) 2026 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#include <Nazara/Core/VirtualDirectoryAssetPackResolver.hpp>
+
+namespace Nz
+{
+	void VirtualDirectoryAssetPackResolver::ForEach(std::weak_ptr<VirtualDirectory> parent, FunctionRef<bool(std::string_view name, VirtualDirectory::Entry&& entry)> callback) const
+	{
+		std::size_t entryCount = m_assetPack->GetEntryCount();
+
+		// Entries are sorted by path, so the content of this directory is contiguous
+		std::size_t entryIndex = m_assetPack->FindFirstEntry(m_pathPrefix);
+		while (entryIndex < entryCount)
+		{
+			std::string_view path = m_assetPack->GetEntry(entryIndex).path;
+			if (!path.starts_with(m_pathPrefix))
+				break;
+
+			std::string_view name = path.substr(m_pathPrefix.size());
+			std::size_t separatorPos = name.find('/');
+			if (separatorPos == std::string_view::npos)
+			{
+				if (!callback(name, VirtualDirectory::FileEntry{ m_assetPack->OpenEntry(entryIndex) }))
+					return;
+
+				entryIndex++;
+			}
+			else
+			{
+				name = name.substr(0, separatorPos);
+
+				std::string directoryPrefix = m_pathPrefix;
+				directoryPrefix += name;
+				directoryPrefix += '/';
+
+				VirtualDirectoryPtr virtualDir = std::make_shared<VirtualDirectory>(std::make_shared<VirtualDirectoryAssetPackResolver>(m_assetPack, directoryPrefix), parent);
+				if (!callback(name, VirtualDirectory::DirectoryEntry{ { std::move(virtualDir) } }))
+					return;
+
+				// Skip the whole subdirectory ('0' follows '/' in ASCII)
+				directoryPrefix.back() = '0';
+				entryIndex = m_assetPack->FindFirstEntry(directoryPrefix);
+			}
+		}
+	}
+
+	std::optional<VirtualDirectory::Entry> VirtualDirectoryAssetPackResolver::Resolve(std::weak_ptr<VirtualDirectory> parent, const std::string_view* parts, std::size_t partCount) const
+	{
+		std::string path = m_pathPrefix;
+		for (std::size_t i = 0; i < partCount; ++i)
+		{
+			if (i != 0)
+				path += '/';
+
+			path += parts[i];
+		}
+
+		if (std::optional<std::size_t> entryIndex = m_assetPack->FindEntry(path))
+			return VirtualDirectory::FileEntry{ m_assetPack->OpenEntry(*entryIndex) };
+
+		// Directories aren't stored in packs, check if any entry is prefixed by this path
+		path += '/';
+
+		std::size_t entryIndex = m_assetPack->FindFirstEntry(path);
+		if (entryIndex < m_assetPack->GetEntryCount() && m_assetPack->GetEntry(entryIndex).path.starts_with(path))
+		{
+			VirtualDirectoryPtr virtualDir = std::make_shared<VirtualDirectory>(std::make_shared<VirtualDirectoryAssetPackResolver>(m_assetPack, std::move(path)), parent);
+			return VirtualDirectory::DirectoryEntry{ { std::move(virtualDir) } };
+		}
+
+		return std::nullopt;
+	}
+}
@@ -8,11 +8,18 @@
 #include <Nazara/Core/Win32/Win32Utils.hpp>
 #include <NazaraUtils/CallOnExit.hpp>
 #include <NazaraUtils/PathUtils.hpp>
+#include <algorithm>
+#include <cstring>
+#include <limits>
 #include <memory>
 
 namespace Nz::PlatformImpl
 {
 	FileImpl::FileImpl(const File* parent) :
+	m_mappingHandle(nullptr),
+	m_mappedCursor(0),
+	m_mappedSize(0),
+	m_mappedPointer(nullptr),
 	m_endOfFile(false),
 	m_endOfFileUpdated(true)
 	{
@@ -21,12 +28,21 @@ namespace Nz::PlatformImpl
 
 	FileImpl::~FileImpl()
 	{
+		if (m_mappedPointer)
+			UnmapViewOfFile(m_mappedPointer);
+
+		if (m_mappingHandle)
+			CloseHandle(m_mappingHandle);
+
 		if (m_handle)
 			CloseHandle(m_handle);
 	}
 
 	bool FileImpl::EndOfFile() const
 	{
+		if (m_mappedPointer)
+			return m_mappedCursor >= m_mappedSize;
+
 		if (!m_endOfFileUpdated)
 		{
 			LARGE_INTEGER fileSize;
@@ -48,6 +64,9 @@ namespace Nz::PlatformImpl
 
 	UInt64 FileImpl::GetCursorPos() const
 	{
+		if (m_mappedPointer)
+			return m_mappedCursor;
+
 		LARGE_INTEGER zero;
 		zero.QuadPart = 0;
 
@@ -57,6 +76,50 @@ namespace Nz::PlatformImpl
 		return position.QuadPart;
 	}
 
+	bool FileImpl::Map()
+	{
+		NazaraAssertMsg(!m_mappedPointer, "file is already mapped");
+
+		LARGE_INTEGER fileSize;
+		if (!GetFileSizeEx(m_handle, &fileSize))
+		{
+			NazaraError("failed to retrieve file size: {0}", Error::GetLastSystemError());
+			return false;
+		}
+
+		// Empty files can't be mapped
+		if (fileSize.QuadPart <= 0)
+			return false;
+
+		if (static_cast<UInt64>(fileSize.QuadPart) > std::numeric_limits<std::size_t>::max())
+			return false;
+
+		HANDLE mappingHandle = CreateFileMappingW(m_handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (!mappingHandle)
+		{
+			NazaraError("failed to create file mapping: {0}", Error::GetLastSystemError());
+			return false;
+		}
+
+		CallOnExit closeOnError([&] { CloseHandle(mappingHandle); });
+
+		void* mappedPointer = MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+		if (!mappedPointer)
+		{
+			NazaraError("failed to map file view: {0}", Error::GetLastSystemError());
+			return false;
+		}
+
+		closeOnError.Reset();
+
+		m_mappedCursor = GetCursorPos();
+		m_mappedPointer = mappedPointer;
+		m_mappedSize = static_cast<UInt64>(fileSize.QuadPart);
+		m_mappingHandle = mappingHandle;
+
+		return true;
+	}
+
 	bool FileImpl::Open(const std::filesystem::path& filePath, OpenModeFlags mode)
 	{
 		DWORD access = 0;
@@ -96,6 +159,16 @@ namespace Nz::PlatformImpl
 
 	std::size_t FileImpl::Read(void* buffer, std::size_t size)
 	{
+		if (m_mappedPointer)
+		{
+			std::size_t readSize = (m_mappedCursor < m_mappedSize) ? static_cast<std::size_t>(std::min<UInt64>(size, m_mappedSize - m_mappedCursor)) : 0;
+			if (buffer && readSize > 0)
+				std::memcpy(buffer, static_cast<const UInt8*>(m_mappedPointer) + m_mappedCursor, readSize);
+
+			m_mappedCursor += readSize;
+			return readSize;
+		}
+
 		//UInt64 oldCursorPos = GetCursorPos();
 
 		DWORD read = 0;
@@ -134,6 +207,27 @@ namespace Nz::PlatformImpl
 
 	bool FileImpl::SetCursorPos(CursorPosition pos, Int64 offset)
 	{
+		if (m_mappedPointer)
+		{
+			Int64 origin;
+			switch (pos)
+			{
+				case CursorPosition::AtBegin:   origin = 0; break;
+				case CursorPosition::AtCurrent: origin = static_cast<Int64>(m_mappedCursor); break;
+				case CursorPosition::AtEnd:     origin = static_cast<Int64>(m_mappedSize); break;
+
+				default:
+					NazaraInternalError("cursor position not handled ({0:#x})", UnderlyingCast(pos));
+					return false;
+			}
+
+			if (origin + offset < 0)
+				return false;
+
+			m_mappedCursor = static_cast<UInt64>(origin + offset);
+			return true;
+		}
+
 		DWORD moveMethod;
 		switch (pos)
 		{
@@ -25,6 +25,8 @@ namespace Nz::PlatformImpl
 			bool EndOfFile() const;
 			void Flush();
 			UInt64 GetCursorPos() const;
+			inline const void* GetMappedPointer() const;
+			bool Map();
 			bool Open(const std::filesystem::path& filePath, OpenModeFlags mode);
 			std::size_t Read(void* buffer, std::size_t size);
 			bool SetCursorPos(CursorPosition pos, Int64 offset);
@@ -36,9 +38,18 @@ namespace Nz::PlatformImpl
 
 		private:
 			HANDLE m_handle;
+			HANDLE m_mappingHandle;
+			UInt64 m_mappedCursor;
+			UInt64 m_mappedSize;
+			void* m_mappedPointer;
 			mutable bool m_endOfFile;
 			mutable bool m_endOfFileUpdated;
 	};
+
+	inline const void* FileImpl::GetMappedPointer() const
+	{
+		return m_mappedPointer;
+	}
 }
 
 #endif // NAZARA_CORE_WIN32_FILEIMPL_HPP
@@ -3,18 +3,22 @@
 // For conditions of distribution and use, see copyright notice in Export.hpp
 
 #include <Nazara/Graphics/DefaultFramePipeline.hpp>
+#include <Nazara/Core/ParallelAlgorithm.hpp>
 #include <Nazara/Graphics/FrameGraph.hpp>
 #include <Nazara/Graphics/Graphics.hpp>
 #include <Nazara/Graphics/InstancedRenderable.hpp>
 #include <Nazara/Graphics/MaterialInstance.hpp>
 #include <Nazara/Graphics/PipelineViewer.hpp>
+#include <Nazara/Graphics/PointLight.hpp>
 #include <Nazara/Graphics/PredefinedShaderStructs.hpp>
 #include <Nazara/Graphics/RenderQueue.hpp>
 #include <Nazara/Graphics/RenderTarget.hpp>
 #include <Nazara/Graphics/TextureAsset.hpp>
+#include <Nazara/Graphics/ViewerInstance.hpp>
 #include <Nazara/Math/Frustum.hpp>
 #include <Nazara/Renderer/GpuCommandBufferBuilder.hpp>
 #include <NazaraUtils/StackVector.hpp>
+#include <algorithm>
 
 namespace Nz
 {
@@ -32,8 +36,10 @@ namespace Nz
 	m_materialInstancePool(256),
 	m_skeletonInstancePool(1024),
 	m_viewerPool(8),
+	m_taskScheduler(nullptr),
 	m_generationCounter(0),
 	m_invalidateSceneBindings(false),
+	m_parallelViewerPreparation(false),
 	m_rebuildFrameGraph(true)
 	{
 		// OnBufferInvalidated
@@ -393,6 +399,7 @@ namespace Nz
 		};
 
 		viewerData.passes = viewerInstance->BuildPasses(passData);
+		viewerData.requiresLightClusters = std::any_of(viewerData.passes.begin(), viewerData.passes.end(), [](const auto& passPtr) { return passPtr->RequiresLightClusters(); });
 
 		m_transferSet.insert(&viewerInstance->GetViewerInstance());
 
@@ -476,28 +483,26 @@ namespace Nz
 			m_invalidateSceneBindings = false;
 		}
 
-		// Find active lights (i.e. visible in any frustum)
-		m_activeLights.Clear();
-		for (ViewerData* viewerData : m_orderedViewers)
+		// Per-viewer visibility and sorting, viewers only write to their own frame data so they can be prepared in parallel
+		if (m_parallelViewerPreparation && m_taskScheduler && m_orderedViewers.size() > 1)
 		{
-			// Extract frustum from viewproj matrix
-			const Matrix4f& viewProjMatrix = viewerData->viewer->GetViewerInstance().GetViewProjMatrix();
-			viewerData->frame.frustum = Frustumf::Extract(viewProjMatrix, viewerData->viewer->IsZReversed());
-
-			viewerData->frame.visibleLights.Clear();
-			for (auto it = m_lightPool.begin(); it != m_lightPool.end(); ++it)
+			ParallelFor(*m_taskScheduler, 0, m_orderedViewers.size(), 1, [&](std::size_t viewerBegin, std::size_t viewerEnd)
 			{
-				const LightData& lightData = *it;
-				std::size_t lightIndex = it.GetIndex();
-
-				if ((lightData.renderMask & viewerData->renderMask) == 0)
-					continue;
-
-				m_activeLights.UnboundedSet(lightIndex);
-				viewerData->frame.visibleLights.UnboundedSet(lightIndex);
-			}
+				for (std::size_t i = viewerBegin; i < viewerEnd; ++i)
+					PrepareViewer(*m_orderedViewers[i]);
+			});
+		}
+		else
+		{
+			for (ViewerData* viewerData : m_orderedViewers)
+				PrepareViewer(*viewerData);
 		}
 
+		// Find active lights (i.e. visible in any frustum), merged in viewer order
+		m_activeLights.Clear();
+		for (ViewerData* viewerData : m_orderedViewers)
+			m_activeLights.PerformsOR(m_activeLights, viewerData->frame.visibleLights);
+
 		m_visibleShadowCastingLights.PerformsAND(m_activeLights, m_shadowCastingLights);
 
 		// Shadow map handling (for active lights)
@@ -545,7 +550,8 @@ namespace Nz
 			FramePipelinePass::FrameData passData = {
 				&viewerData->frame.visibleLights,
 				viewerData->frame.frustum,
-				gpuResources
+				gpuResources,
+				(viewerData->requiresLightClusters) ? &viewerData->frame.lightClusters : nullptr
 			};
 
 			for (auto& passPtr : viewerData->passes)
@@ -896,25 +902,16 @@ namespace Nz
 						}
 					}
 
-					// Sort render queues depending on viewer position
-					Vector3f camPos = viewer->GetViewerInstance().GetEyePosition();
-					for (auto& renderQueuePtr : m_renderQueues)
+					// Apply the render queue order computed for this viewer (see PrepareViewer)
+					for (std::size_t renderQueueIndex = 0; renderQueueIndex < m_renderQueues.size(); ++renderQueueIndex)
 					{
-						if (renderQueuePtr && renderQueuePtr->GetFlags() & RenderQueueFlag::SortByDistance)
+						auto& renderQueuePtr = m_renderQueues[renderQueueIndex];
+						if (renderQueuePtr && renderQueuePtr->IsSortedPerViewer())
 						{
-							renderQueuePtr->SortRenderQueue([this, camPos](std::vector<const RenderElement*>& elements)
+							renderQueuePtr->SortRenderQueue([&](std::vector<const RenderElement*>& elements)
 							{
-								std::sort(elements.begin(), elements.end(), [this, camPos](const RenderElement* lhs, const RenderElement* rhs)
-								{
-									const UInt8* lhsData = m_instanceBuffer.GetEntryData(lhs->GetInstanceIndex());
-									const UInt8* rhsData = m_instanceBuffer.GetEntryData(rhs->GetInstanceIndex());
-
-									Vector3f lhsPos = AccessByOffset<const Matrix4f&>(lhsData, PredefinedInstanceOffsets.worldMatrixOffset).GetTranslation();
-									Vector3f rhsPos = AccessByOffset<const Matrix4f&>(rhsData, PredefinedInstanceOffsets.worldMatrixOffset).GetTranslation();
-
-									// Sort by greater distance so rendering is done back to front
-									return camPos.SquaredDistance(lhsPos) > camPos.SquaredDistance(rhsPos);
-								});
+								const std::vector<const RenderElement*>& sortedElements = viewerData->frame.sortedRenderQueues[renderQueueIndex];
+								elements.assign(sortedElements.begin(), sortedElements.end());
 							});
 						}
 					}
@@ -977,7 +974,7 @@ namespace Nz
 
 	void DefaultFramePipeline::BuildRenderQueues()
 	{
-		RegisterRenderQueue("DepthOpaque", "DepthPass");
+		RegisterRenderQueue("DepthOpaque", "DepthPass", RenderQueueFlag::SortFrontToBack);
 		RegisterRenderQueue("ForwardOpaque", "ForwardPass");
 		RegisterRenderQueue("ForwardTransparent", "ForwardPass", RenderQueueFlag::SortByDistance);
 		RegisterRenderQueue("Shadow", "ShadowPass");
@@ -1091,6 +1088,86 @@ namespace Nz
 		return viewerUploadAttachment;
 	}
 
+	void DefaultFramePipeline::PrepareViewer(ViewerData& viewerData)
+	{
+		// Extract frustum from viewproj matrix
+		const ViewerInstance& viewerInstance = viewerData.viewer->GetViewerInstance();
+		viewerData.frame.frustum = Frustumf::Extract(viewerInstance.GetViewProjMatrix(), viewerData.viewer->IsZReversed());
+
+		viewerData.frame.clusteredLights.clear();
+		viewerData.frame.visibleLights.Clear();
+		for (auto it = m_lightPool.begin(); it != m_lightPool.end(); ++it)
+		{
+			const LightData& lightData = *it;
+			std::size_t lightIndex = it.GetIndex();
+
+			if ((lightData.renderMask & viewerData.renderMask) == 0)
+				continue;
+
+			if (!lightData.light->FrustumCull(viewerData.frame.frustum))
+				continue;
+
+			viewerData.frame.visibleLights.UnboundedSet(lightIndex);
+
+			if (!viewerData.requiresLightClusters)
+				continue;
+
+			// Lights with a finite volume are assigned to clusters, others (such as directional lights) affect everything
+			const BoundingVolumef& boundingVolume = lightData.light->GetBoundingVolume();
+			if (boundingVolume.extent != Extent::Finite)
+				continue;
+
+			Spheref boundingSphere;
+			if (lightData.light->GetLightType() == SafeCast<UInt8>(BasicLightType::Point))
+			{
+				const PointLight* pointLight = SafeCast<const PointLight*>(lightData.light);
+				boundingSphere = Spheref(pointLight->GetPosition(), pointLight->GetRadius());
+			}
+			else
+				boundingSphere = Spheref(boundingVolume.aabb.GetCenter(), boundingVolume.aabb.GetLengths().GetLength() * 0.5f);
+
+			viewerData.frame.clusteredLights.push_back({ boundingSphere, SafeCast<UInt32>(lightIndex) });
+		}
+
+		// Only build clusters when a pass reads them
+		if (viewerData.requiresLightClusters)
+			viewerData.frame.lightClusters.Build(viewerInstance.GetViewMatrix(), viewerInstance.GetProjectionMatrix(), viewerData.viewer->GetZNear(), viewerData.viewer->GetZFar(), viewerData.frame.clusteredLights, m_taskScheduler);
+
+		// Compute the order of render queues sorted by distance, it will be applied when rendering this viewer
+		Vector3f eyePosition = viewerInstance.GetEyePosition();
+
+		viewerData.frame.sortedRenderQueues.resize(m_renderQueues.size());
+		for (std::size_t renderQueueIndex = 0; renderQueueIndex < m_renderQueues.size(); ++renderQueueIndex)
+		{
+			const auto& renderQueuePtr = m_renderQueues[renderQueueIndex];
+			if (!renderQueuePtr || !renderQueuePtr->IsSortedPerViewer())
+				continue;
+
+			bool backToFront = renderQueuePtr->GetFlags().Test(RenderQueueFlag::SortByDistance);
+
+			auto& sortEntries = viewerData.frame.sortEntries;
+			sortEntries.clear();
+			for (const RenderElement* renderElement : renderQueuePtr->GetOrderedRenderElements())
+			{
+				const UInt8* instanceData = m_instanceBuffer.GetEntryData(renderElement->GetInstanceIndex());
+				Vector3f position = AccessByOffset<const Matrix4f&>(instanceData, PredefinedInstanceOffsets.worldMatrixOffset).GetTranslation();
+
+				// Distance is computed once per element and packed in the sort key along with render states
+				float squaredDistance = eyePosition.SquaredDistance(position);
+				UInt64 sortKey = (backToFront) ? RenderQueue::ComputeBackToFrontSortKey(*renderElement, squaredDistance) : RenderQueue::ComputeFrontToBackSortKey(*renderElement, squaredDistance);
+
+				sortEntries.push_back({ sortKey, renderElement });
+			}
+
+			RenderQueue::SortEntries(sortEntries, viewerData.frame.sortBuffer);
+
+			std::vector<const RenderElement*>& sortedRenderQueue = viewerData.frame.sortedRenderQueues[renderQueueIndex];
+			sortedRenderQueue.clear();
+			for (const RenderQueue::SortEntry& sortEntry : sortEntries)
+				sortedRenderQueue.push_back(sortEntry.element);
+		}
+	}
+
 	void DefaultFramePipeline::ProcesRemovedData(GpuResources& gpuResources)
 	{
 			for (std::size_t lightIndex : m_removedLightInstances.IterBits())
@@ -15,4 +15,12 @@ namespace Nz
 	void FramePipelinePass::Prepare(FrameData& /*frameData*/)
 	{
 	}
+
+	/*!
+	* \brief Tells the pipeline this pass reads FrameData::lightClusters, which are not built otherwise
+	*/
+	bool FramePipelinePass::RequiresLightClusters() const
+	{
+		return false;
+	}
 }
@@ -0,0 +1,292 @@
+// Copyright (C) 2026 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Graphics module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#include <Nazara/Graphics/LightClusterGrid.hpp>
+#include <Nazara/Core/ParallelAlgorithm.hpp>
+#include <Nazara/Math/Vector4.hpp>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace Nz
+{
+	/*!
+	* \brief Assigns lights to the clusters (froxels) of a view frustum
+	*
+	* The view frustum is split in a grid of tiles in screen-space and in exponential depth slices between the near plane and min(zFar, maxDepth),
+	* lights farther than the last slice are assigned to it.
+	* Orthographic projections and non-positive near planes (which can't be sliced exponentially) use linear depth slices.
+	* Tile (0, 0) matches the (-1, -1) corner in normalized device coordinates.
+	*
+	* \param viewMatrix World to view space matrix
+	* \param projectionMatrix View to clip space matrix (may be perspective or orthographic)
+	* \param zNear Distance of the near plane
+	* \param zFar Distance of the far plane (may be infinite)
+	* \param lights Bounding sphere of lights, light indices are stored in the clusters they touch
+	* \param taskScheduler Optional task scheduler used to process depth slices in parallel
+	*/
+	void LightClusterGrid::Build(const Matrix4f& viewMatrix, const Matrix4f& projectionMatrix, float zNear, float zFar, std::span<const LightSphere> lights, TaskScheduler* taskScheduler)
+	{
+		m_projectionMatrix = projectionMatrix;
+		m_depthNear = zNear;
+
+		// Perspective projections have a zero bottom-right element, orthographic ones don't
+		m_linearDepthSlices = (projectionMatrix.m44 != 0.f || zNear <= 0.f);
+		if (m_linearDepthSlices)
+		{
+			m_depthFar = std::max(std::min(zFar, m_maxDepth), zNear + 0.001f);
+			m_invDepthRange = 1.f / (m_depthFar - m_depthNear);
+		}
+		else
+		{
+			m_depthFar = std::max(std::min(zFar, m_maxDepth), zNear * 1.001f);
+			m_invDepthRange = 1.f / std::log(m_depthFar / m_depthNear);
+		}
+
+		// Compute the view-space line going through each tile corner
+		Matrix4f invProjectionMatrix;
+		if (!projectionMatrix.GetInverse(&invProjectionMatrix))
+		{
+			Clear();
+			return;
+		}
+
+		auto Unproject = [&](float x, float y, float z)
+		{
+			Vector4f position = invProjectionMatrix.Transform(Vector4f(x, y, z, 1.f));
+			return Vector3f(position.x, position.y, position.z) / position.w;
+		};
+
+		for (UInt32 y = 0; y <= m_clusterCount.y; ++y)
+		{
+			float ndcY = -1.f + 2.f * y / m_clusterCount.y;
+			for (UInt32 x = 0; x <= m_clusterCount.x; ++x)
+			{
+				float ndcX = -1.f + 2.f * x / m_clusterCount.x;
+
+				// Depth values are chosen to stay finite with reversed and infinite projections
+				Vector3f first = Unproject(ndcX, ndcY, 0.25f);
+				Vector3f second = Unproject(ndcX, ndcY, 0.5f);
+
+				TileRay& tileRay = m_tileRays[y * (m_clusterCount.x + 1) + x];
+				tileRay.origin = first;
+				tileRay.direction = second - first;
+			}
+		}
+
+		// Transform lights to view space and compute the range of clusters they may touch
+		m_lastSliceFar = m_depthFar;
+		m_viewLights.clear();
+		for (const LightSphere& light : lights)
+		{
+			ViewLight& viewLight = m_viewLights.emplace_back();
+			viewLight.center = viewMatrix.Transform(light.sphere.GetPosition());
+			viewLight.radius = light.sphere.radius;
+			viewLight.lightIndex = light.lightIndex;
+
+			// View space looks toward -Z
+			float minDepth = -viewLight.center.z - viewLight.radius;
+			float maxDepth = -viewLight.center.z + viewLight.radius;
+			if (maxDepth < m_depthNear)
+			{
+				// Behind the near plane
+				m_viewLights.pop_back();
+				continue;
+			}
+
+			m_lastSliceFar = std::max(m_lastSliceFar, maxDepth);
+
+			viewLight.firstSlice = ComputeDepthSlice(minDepth);
+			viewLight.lastSlice = ComputeDepthSlice(maxDepth);
+
+			viewLight.firstTile = Vector2ui::Zero();
+			viewLight.lastTile = Vector2ui(m_clusterCount.x - 1, m_clusterCount.y - 1);
+
+			// Project the view-space bounding box corners to restrict the tile range, unless the light crosses the camera plane of a perspective projection
+			if (m_linearDepthSlices || minDepth > 0.f)
+			{
+				Vector2f ndcMin(std::numeric_limits<float>::infinity());
+				Vector2f ndcMax(-std::numeric_limits<float>::infinity());
+				for (unsigned int i = 0; i < 8; ++i)
+				{
+					Vector3f corner = viewLight.center + Vector3f((i & 1) ? viewLight.radius : -viewLight.radius, (i & 2) ? viewLight.radius : -viewLight.radius, (i & 4) ? viewLight.radius : -viewLight.radius);
+					Vector4f clipPosition = projectionMatrix.Transform(Vector4f(corner.x, corner.y, corner.z, 1.f));
+
+					Vector2f ndcPosition(clipPosition.x / clipPosition.w, clipPosition.y / clipPosition.w);
+					ndcMin.Minimize(ndcPosition);
+					ndcMax.Maximize(ndcPosition);
+				}
+
+				if (ndcMax.x < -1.f || ndcMax.y < -1.f || ndcMin.x > 1.f || ndcMin.y > 1.f)
+				{
+					// Outside of the screen
+					m_viewLights.pop_back();
+					continue;
+				}
+
+				auto ToTile = [](float ndc, UInt32 tileCount)
+				{
+					float tile = (ndc * 0.5f + 0.5f) * tileCount;
+					return static_cast<UInt32>(std::clamp(tile, 0.f, float(tileCount - 1)));
+				};
+
+				viewLight.firstTile = Vector2ui(ToTile(ndcMin.x, m_clusterCount.x), ToTile(ndcMin.y, m_clusterCount.y));
+				viewLight.lastTile = Vector2ui(ToTile(ndcMax.x, m_clusterCount.x), ToTile(ndcMax.y, m_clusterCount.y));
+			}
+		}
+
+		// Depth slices are independent, assign them in parallel
+		if (taskScheduler)
+		{
+			ParallelFor(*taskScheduler, 0, m_clusterCount.z, 1, [&](std::size_t sliceBegin, std::size_t sliceEnd)
+			{
+				for (std::size_t z = sliceBegin; z < sliceEnd; ++z)
+					AssignSlice(static_cast<UInt32>(z));
+			});
+		}
+		else
+		{
+			for (UInt32 z = 0; z < m_clusterCount.z; ++z)
+				AssignSlice(z);
+		}
+
+		// Merge slice lists, clusters are ordered by slice so each slice fills a contiguous range
+		m_lightIndices.clear();
+
+		UInt32 tileCount = m_clusterCount.x * m_clusterCount.y;
+		for (UInt32 z = 0; z < m_clusterCount.z; ++z)
+		{
+			Cluster* sliceClusters = &m_clusters[ComputeClusterIndex(0, 0, z)];
+			for (UInt32 tileIndex = 0; tileIndex < tileCount; ++tileIndex)
+				sliceClusters[tileIndex].lightCount = 0;
+
+			const std::vector<LightAssignment>& assignments = m_sliceAssignments[z];
+			for (const LightAssignment& assignment : assignments)
+				sliceClusters[assignment.tileIndex].lightCount++;
+
+			UInt32 offset = static_cast<UInt32>(m_lightIndices.size());
+			for (UInt32 tileIndex = 0; tileIndex < tileCount; ++tileIndex)
+			{
+				sliceClusters[tileIndex].firstLightIndex = offset;
+				offset += sliceClusters[tileIndex].lightCount;
+			}
+
+			m_lightIndices.resize(offset);
+
+			// Reuse light count as insertion cursor
+			for (UInt32 tileIndex = 0; tileIndex < tileCount; ++tileIndex)
+				sliceClusters[tileIndex].lightCount = 0;
+
+			for (const LightAssignment& assignment : assignments)
+			{
+				Cluster& cluster = sliceClusters[assignment.tileIndex];
+				m_lightIndices[cluster.firstLightIndex + cluster.lightCount++] = assignment.lightIndex;
+			}
+		}
+	}
+
+	/*!
+	* \brief Computes the depth slice containing a view-space depth (distance along the view direction)
+	* \return Depth slice index, clamped to the slice count
+	*
+	* \param viewDepth Distance from the camera plane
+	*/
+	UInt32 LightClusterGrid::ComputeDepthSlice(float viewDepth) const
+	{
+		if (!(viewDepth > m_depthNear)) //< also handles NaN
+			return 0;
+
+		float slice;
+		if (m_linearDepthSlices)
+			slice = (viewDepth - m_depthNear) * m_invDepthRange * m_clusterCount.z;
+		else
+			slice = std::log(viewDepth / m_depthNear) * m_invDepthRange * m_clusterCount.z;
+
+		return static_cast<UInt32>(std::min(slice, float(m_clusterCount.z - 1)));
+	}
+
+	void LightClusterGrid::AssignSlice(UInt32 z)
+	{
+		ComputeSliceBounds(z);
+
+		std::vector<LightAssignment>& assignments = m_sliceAssignments[z];
+		assignments.clear();
+
+		const Boxf* sliceBounds = &m_clusterBounds[ComputeClusterIndex(0, 0, z)];
+		for (const ViewLight& viewLight : m_viewLights)
+		{
+			if (z < viewLight.firstSlice || z > viewLight.lastSlice)
+				continue;
+
+			float squaredRadius = viewLight.radius * viewLight.radius;
+			for (UInt32 y = viewLight.firstTile.y; y <= viewLight.lastTile.y; ++y)
+			{
+				for (UInt32 x = viewLight.firstTile.x; x <= viewLight.lastTile.x; ++x)
+				{
+					UInt32 tileIndex = y * m_clusterCount.x + x;
+					const Boxf& bounds = sliceBounds[tileIndex];
+
+					// Squared distance between the sphere center and the cluster box
+					Vector3f closestPoint(std::clamp(viewLight.center.x, bounds.x, bounds.x + bounds.width),
+					                      std::clamp(viewLight.center.y, bounds.y, bounds.y + bounds.height),
+					                      std::clamp(viewLight.center.z, bounds.z, bounds.z + bounds.depth));
+
+					if (closestPoint.SquaredDistance(viewLight.center) <= squaredRadius)
+						assignments.push_back({ tileIndex, viewLight.lightIndex });
+				}
+			}
+		}
+	}
+
+	void LightClusterGrid::ComputeSliceBounds(UInt32 z)
+	{
+		float sliceNear = GetSliceDepth(z);
+		float sliceFar = GetSliceDepth(z + 1);
+
+		auto ComputePoint = [&](const TileRay& tileRay, float depth)
+		{
+			// Intersect the tile ray with the z = -depth plane
+			float t = (-depth - tileRay.origin.z) / tileRay.direction.z;
+			return tileRay.origin + tileRay.direction * t;
+		};
+
+		Boxf* sliceBounds = &m_clusterBounds[ComputeClusterIndex(0, 0, z)];
+		for (UInt32 y = 0; y < m_clusterCount.y; ++y)
+		{
+			for (UInt32 x = 0; x < m_clusterCount.x; ++x)
+			{
+				Vector3f corners[8];
+				for (unsigned int i = 0; i < 4; ++i)
+				{
+					UInt32 cornerX = x + (i & 1);
+					UInt32 cornerY = y + ((i & 2) >> 1);
+
+					const TileRay& tileRay = m_tileRays[cornerY * (m_clusterCount.x + 1) + cornerX];
+					corners[i * 2 + 0] = ComputePoint(tileRay, sliceNear);
+					corners[i * 2 + 1] = ComputePoint(tileRay, sliceFar);
+				}
+
+				Boxf& bounds = sliceBounds[y * m_clusterCount.x + x];
+				bounds = Boxf::FromExtents(corners[0], corners[1]);
+				for (unsigned int i = 2; i < 8; ++i)
+					bounds.ExtendTo(corners[i]);
+			}
+		}
+	}
+
+	float LightClusterGrid::GetSliceDepth(UInt32 z) const
+	{
+		if (z == 0)
+			return m_depthNear;
+
+		// The last slice extends to the farthest light, so lights beyond max depth are still assigned
+		if (z >= m_clusterCount.z)
+			return m_lastSliceFar;
+
+		if (m_linearDepthSlices)
+			return m_depthNear + (m_depthFar - m_depthNear) * float(z) / m_clusterCount.z;
+
+		return m_depthNear * std::pow(m_depthFar / m_depthNear, float(z) / m_clusterCount.z);
+	}
+}
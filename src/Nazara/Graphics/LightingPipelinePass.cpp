@@ -11,6 +11,7 @@
 #include <Nazara/Graphics/FrameGraph.hpp>
 #include <Nazara/Graphics/FramePipeline.hpp>
 #include <Nazara/Graphics/Graphics.hpp>
+#include <Nazara/Graphics/LightClusterGrid.hpp>
 #include <Nazara/Graphics/PointLight.hpp>
 #include <Nazara/Graphics/PredefinedShaderStructs.hpp>
 #include <Nazara/Graphics/ShaderTransfer.hpp>
@@ -77,9 +78,21 @@ namespace Nz
 			const auto& defaultSampler = graphics->GetSamplerCache().Get({});
 			const auto& depthSampler = graphics->GetSamplerCache().Get({ .depthCompare = true });
 
+			// Lights assigned to at least one cluster of the view volume
+			m_clusteredLights.Clear();
+			if (frameData.lightClusters)
+			{
+				for (UInt32 lightIndex : frameData.lightClusters->GetLightIndices())
+					m_clusteredLights.UnboundedSet(lightIndex);
+			}
+
 			for (std::size_t lightIndex : frameData.visibleLights->IterBits())
 			{
 				const Light* light = m_pipeline.RetrieveLight(lightIndex);
+
+				// Finite lights in no cluster intersect the frustum but none of the cluster boxes, they don't light anything visible
+				if (frameData.lightClusters && light->GetBoundingVolume().extent == Extent::Finite && !m_clusteredLights.UnboundedTest(lightIndex))
+					continue;
 				const Texture* shadowMap = nullptr;// m_pipeline.RetrieveLightShadowmap(lightIndex, m_viewer);
 
 				constexpr UInt8 DirectionalLightType = static_cast<UInt8>(BasicLightType::Directional);
@@ -387,6 +400,12 @@ namespace Nz
 		return lightingPass;
 	}
 
+	bool LightingPipelinePass::RequiresLightClusters() const
+	{
+		// Used to skip lights which don't touch any cluster of the view volume
+		return true;
+	}
+
 	std::string LightingPipelinePass::GetShaderName(const ParameterList& parameters)
 	{
 		Result<std::string, ParameterList::Error> shaderResult = parameters.GetStringParameter("Shader");
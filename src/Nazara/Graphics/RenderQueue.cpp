@@ -5,6 +5,10 @@
 #include <Nazara/Graphics/RenderQueue.hpp>
 #include <Nazara/Graphics/RenderElement.hpp>
 #include <Nazara/Renderer/GpuResources.hpp>
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
 
 namespace Nz
 {
@@ -138,17 +142,19 @@ namespace Nz
 
 		if (m_shouldSortRenderQueue)
 		{
-			if (!m_flags.Test(RenderQueueFlag::SortByDistance))
+			// Queues sorted per viewer are ordered by the pipeline before rendering each viewer
+			if (!IsSortedPerViewer())
 			{
-				SortRenderQueue([](std::vector<const RenderElement*>& elements)
+				SortRenderQueue([this](std::vector<const RenderElement*>& elements)
 				{
-					std::sort(elements.begin(), elements.end(), [&](const RenderElement* lhs, const RenderElement* rhs)
-					{
-						// Render layer has priority and only in case of equality we want to order by the sort key
-						bool orderedBefore = lhs->GetRenderLayer() < rhs->GetRenderLayer();
-						orderedBefore |= lhs->GetRenderLayer() == rhs->GetRenderLayer() && lhs->GetSortKey() < rhs->GetSortKey();
-						return orderedBefore;
-					});
+					m_sortEntries.clear();
+					for (const RenderElement* element : elements)
+						m_sortEntries.push_back({ element->GetSortKey(), element });
+
+					SortEntries(m_sortEntries, m_sortBuffer);
+
+					for (std::size_t i = 0; i < elements.size(); ++i)
+						elements[i] = m_sortEntries[i].element;
 				});
 			}
 		}
@@ -157,6 +163,25 @@ namespace Nz
 	void RenderQueue::RecomputeContentHash()
 	{
 		m_contentHash = 0;
+
+		// Front-to-back order only reduces overdraw, hashing it would invalidate command buffers each time the viewer moves
+		// so only the set of elements is hashed (using a commutative combination), recorded commands keep their previous order
+		if (m_flags.Test(RenderQueueFlag::SortFrontToBack))
+		{
+			for (const RenderElement* renderElement : m_orderedRenderElements)
+			{
+				// Mix pointer bits (murmur3 finalizer) before summing them
+				UInt64 hash = static_cast<UInt64>(reinterpret_cast<std::uintptr_t>(renderElement));
+				hash ^= hash >> 33;
+				hash *= 0xFF51AFD7ED558CCDull;
+				hash ^= hash >> 33;
+
+				m_contentHash += static_cast<std::size_t>(hash);
+			}
+
+			return;
+		}
+
 		for (const RenderElement* renderElement : m_orderedRenderElements)
 		{
 			// https://softwareengineering.stackexchange.com/a/402543
@@ -164,4 +189,130 @@ namespace Nz
 			m_contentHash ^= hash + 0x9e3779b9 + (m_contentHash << 6) + (m_contentHash >> 2);
 		}
 	}
+
+	/*!
+	* \brief Computes a sort key ordering elements from the farthest to the nearest, then by pipeline and material
+	*
+	* \param element Element to compute the sort key of
+	* \param squaredDistance Squared distance between the element and the viewer
+	*/
+	UInt64 RenderQueue::ComputeBackToFrontSortKey(const RenderElement& element, float squaredDistance)
+	{
+		// Positive floats keep their order when compared as integers, invert them to sort from the farthest
+		UInt64 depth = ~std::bit_cast<UInt32>(std::max(squaredDistance, 0.f));
+
+		// - Depth (32bits)
+		// - Pipeline (16bits)
+		// - MaterialPass (16bits)
+		return depth << 32 | ((element.GetSortKey() >> 19) & 0xFFFFFFFF);
+	}
+
+	/*!
+	* \brief Computes a sort key ordering elements from the nearest to the farthest, then by render states
+	*
+	* Depth is quantized (8bits of exponent and 4bits of mantissa of the squared distance) so elements at similar depths are still grouped by render states
+	*
+	* \param element Element to compute the sort key of
+	* \param squaredDistance Squared distance between the element and the viewer
+	*/
+	UInt64 RenderQueue::ComputeFrontToBackSortKey(const RenderElement& element, float squaredDistance)
+	{
+		UInt64 depth = std::bit_cast<UInt32>(std::max(squaredDistance, 0.f)) >> 19;
+
+		// - Depth (12bits)
+		// - Element type (4bits)
+		// - Pipeline (16bits)
+		// - MaterialPass (16bits)
+		// - VertexBuffer/VertexDeclaration (8bits)
+		// - Skeleton (8bits)
+		return depth << 52 | ((element.GetSortKey() >> 3) & 0xFFFFFFFFFFFFF);
+	}
+
+	/*!
+	* \brief Sorts entries by ascending keys using a stable least significant digit radix sort
+	*
+	* Bytes shared by every key are skipped, making the sort cheaper for keys using only a few bits
+	*
+	* \param entries Entries to sort
+	* \param buffer Scratch buffer, resized to the entry count (its content is lost)
+	*/
+	void RenderQueue::RadixSort(std::vector<SortEntry>& entries, std::vector<SortEntry>& buffer)
+	{
+		constexpr std::size_t PassCount = sizeof(UInt64);
+
+		std::size_t entryCount = entries.size();
+		if (entryCount < 2)
+			return;
+
+		std::array<std::array<UInt32, 256>, PassCount> histograms = {};
+		for (const SortEntry& entry : entries)
+		{
+			for (std::size_t pass = 0; pass < PassCount; ++pass)
+				histograms[pass][(entry.key >> (pass * 8)) & 0xFF]++;
+		}
+
+		buffer.resize(entryCount);
+
+		bool swapped = false;
+		for (std::size_t pass = 0; pass < PassCount; ++pass)
+		{
+			std::vector<SortEntry>& source = (swapped) ? buffer : entries;
+			std::vector<SortEntry>& destination = (swapped) ? entries : buffer;
+
+			unsigned int shift = SafeCast<unsigned int>(pass * 8);
+
+			auto& histogram = histograms[pass];
+			if (histogram[(source[0].key >> shift) & 0xFF] == entryCount)
+				continue; //< every key has the same byte
+
+			UInt32 offset = 0;
+			for (UInt32& count : histogram)
+			{
+				UInt32 bucketSize = count;
+				count = offset;
+				offset += bucketSize;
+			}
+
+			for (const SortEntry& entry : source)
+				destination[histogram[(entry.key >> shift) & 0xFF]++] = entry;
+
+			swapped = !swapped;
+		}
+
+		if (swapped)
+			std::swap(entries, buffer);
+	}
+
+	/*!
+	* \brief Sorts entries by render layer and then by key
+	*
+	* \param entries Entries to sort
+	* \param buffer Scratch buffer, resized to the entry count (its content is lost)
+	*
+	* \remark Entry keys are overwritten when elements are on different render layers
+	*/
+	void RenderQueue::SortEntries(std::vector<SortEntry>& entries, std::vector<SortEntry>& buffer)
+	{
+		if (entries.empty())
+			return;
+
+		RadixSort(entries, buffer);
+
+		// Render layer has priority, since radix sort is stable we can sort a second time by layer when they are not all the same
+		Int32 minLayer = entries.front().element->GetRenderLayer();
+		Int32 maxLayer = minLayer;
+		for (const SortEntry& entry : entries)
+		{
+			minLayer = std::min(minLayer, entry.element->GetRenderLayer());
+			maxLayer = std::max(maxLayer, entry.element->GetRenderLayer());
+		}
+
+		if (minLayer == maxLayer)
+			return;
+
+		for (SortEntry& entry : entries)
+			entry.key = static_cast<UInt64>(static_cast<Int64>(entry.element->GetRenderLayer()) - minLayer);
+
+		RadixSort(entries, buffer);
+	}
 }
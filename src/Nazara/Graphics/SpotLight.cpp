@@ -20,11 +20,11 @@ namespace Nz
 		// Tangent = Opposite/Adjacent <=> Opposite = Adjacent * Tangent
 		float opposite = m_radius * m_outerAngleTan;
 
-		Vector3f base = Vector3f::Forward() * m_radius;
-		Vector3f lExtend = Vector3f::Left() * opposite;
-		Vector3f uExtend = Vector3f::Up() * opposite;
+		Vector3f base = m_position + m_rotation * (Vector3f::Forward() * m_radius);
+		Vector3f lExtend = m_rotation * (Vector3f::Left() * opposite);
+		Vector3f uExtend = m_rotation * (Vector3f::Up() * opposite);
 
-		// Test five points against frustum
+		// Test the pyramid enclosing the cone against frustum, the light is culled only if all five points are outside of the same plane
 		std::array<Vector3f, 5> points = {
 			m_position,
 			base + lExtend + uExtend,
@@ -33,7 +33,7 @@ namespace Nz
 			base - lExtend - uExtend,
 		};
 
-		return viewerFrustum.Contains(points.data(), points.size());
+		return viewerFrustum.Intersect(points.data(), points.size()) != IntersectionSide::Outside;
 	}
 
 	std::unique_ptr<LightShadowData> SpotLight::InstanciateShadowData(FramePipeline& pipeline) const
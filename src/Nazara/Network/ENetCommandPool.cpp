@@ -0,0 +1,62 @@
+// Copyright (C) 2026 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#include <Nazara/Network/ENetCommandPool.hpp>
+#include <NazaraUtils/MathUtils.hpp>
+#include <algorithm>
+
+namespace Nz
+{
+	void* ENetCommandPool::Allocate(std::size_t size)
+	{
+		SizeClass& sizeClass = GetSizeClass(size);
+		if (!sizeClass.freeList)
+		{
+			// Carve a new block into nodes and chain them in the free list
+			std::size_t blockSize = sizeClass.nodeSize * m_nodesPerBlock;
+			std::byte* block = m_blocks.emplace_back(std::make_unique<std::byte[]>(blockSize)).get();
+
+			for (std::size_t i = m_nodesPerBlock; i > 0; --i)
+			{
+				FreeNode* node = reinterpret_cast<FreeNode*>(block + (i - 1) * sizeClass.nodeSize);
+				node->next = sizeClass.freeList;
+				sizeClass.freeList = node;
+			}
+		}
+
+		FreeNode* node = sizeClass.freeList;
+		sizeClass.freeList = node->next;
+
+		return node;
+	}
+
+	void ENetCommandPool::Free(void* ptr, std::size_t size)
+	{
+		if (!ptr)
+			return;
+
+		SizeClass& sizeClass = GetSizeClass(size);
+
+		FreeNode* node = static_cast<FreeNode*>(ptr);
+		node->next = sizeClass.freeList;
+		sizeClass.freeList = node;
+	}
+
+	auto ENetCommandPool::GetSizeClass(std::size_t size) -> SizeClass&
+	{
+		std::size_t nodeSize = AlignPow2(std::max(size, sizeof(FreeNode)), NodeAlignment);
+
+		// There's only a handful of node types (one per command list type), a linear search is fine
+		for (SizeClass& sizeClass : m_sizeClasses)
+		{
+			if (sizeClass.nodeSize == nodeSize)
+				return sizeClass;
+		}
+
+		SizeClass& sizeClass = m_sizeClasses.emplace_back();
+		sizeClass.nodeSize = nodeSize;
+
+		return sizeClass;
+	}
+}
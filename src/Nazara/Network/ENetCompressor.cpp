@@ -3,8 +3,47 @@
 // For conditions of distribution and use, see copyright notice in Export.hpp
 
 #include <Nazara/Network/ENetCompressor.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <NazaraUtils/Algorithm.hpp>
+#include <zdict.h>
+#include <vector>
 
 namespace Nz
 {
 	ENetCompressor::~ENetCompressor() = default;
+
+	/*!
+	* \brief Trains a compression dictionary from captured packets
+	* \return Dictionary content, empty if training failed
+	*
+	* \param samples Packets representative of the traffic, the more the better (a few thousands are usually needed)
+	* \param maxDictionarySize Maximum size of the dictionary, LZ4 only uses its last 64KiB
+	*
+	* \remark The resulting dictionary can be used by both ENetLz4Compressor and ENetZstdCompressor, and has to be shared by both ends of the connection
+	*/
+	ByteArray ENetCompressor::TrainDictionary(std::span<const ByteArray> samples, std::size_t maxDictionarySize)
+	{
+		ByteArray sampleData;
+		std::vector<std::size_t> sampleSizes;
+		sampleSizes.reserve(samples.size());
+		for (const ByteArray& sample : samples)
+		{
+			if (sample.IsEmpty())
+				continue;
+
+			sampleData.Append(sample.GetConstBuffer(), sample.GetSize());
+			sampleSizes.push_back(sample.GetSize());
+		}
+
+		ByteArray dictionary(maxDictionarySize);
+		std::size_t dictionarySize = ZDICT_trainFromBuffer(dictionary.GetBuffer(), dictionary.GetSize(), sampleData.GetConstBuffer(), sampleSizes.data(), SafeCast<unsigned int>(sampleSizes.size()));
+		if (ZDICT_isError(dictionarySize))
+		{
+			NazaraError("failed to train dictionary: {0}", ZDICT_getErrorName(dictionarySize));
+			return {};
+		}
+
+		dictionary.Resize(dictionarySize);
+		return dictionary;
+	}
 }
@@ -60,8 +60,9 @@ namespace Nz
 	{
 		ENetPacketRef enetPacket = AllocatePacket(flags, std::move(packet));
 
-		for (ENetPeer& peer : m_peers)
+		for (std::size_t peerId : m_activePeers.IterBits())
 		{
+			ENetPeer& peer = m_peers[peerId];
 			if (peer.GetState() != ENetPeerState::Connected)
 				continue;
 
@@ -192,8 +193,21 @@ namespace Nz
 		m_receivedData = nullptr;
 		m_receivedDataLength = 0;
 
+		constexpr std::size_t batchDataSize = ENetConstants::ENetHost_DatagramBatchSize * ENetConstants::ENetProtocol_MaximumMTU;
+		m_receiveBatch.count = 0;
+		m_receiveBatch.data.resize(batchDataSize);
+		m_receiveBatchIndex = 0;
+		m_sendBatch.count = 0;
+		m_sendBatch.data.resize(batchDataSize);
+
+		m_compressionTime = Time::Zero();
+		m_decompressionTime = Time::Zero();
+		m_totalCompressedReceivedData = 0;
+		m_totalCompressedSentData = 0;
 		m_totalSentData = 0;
 		m_totalSentPackets = 0;
+		m_totalUncompressedReceivedData = 0;
+		m_totalUncompressedSentData = 0;
 		m_totalReceivedData = 0;
 		m_totalReceivedPackets = 0;
 
@@ -203,6 +217,15 @@ namespace Nz
 		m_maximumPacketSize = ENetConstants::ENetHost_DefaultMaximumPacketSize;
 		m_maximumWaitingData = ENetConstants::ENetHost_DefaultMaximumWaitingData;
 
+		m_activePeers.Clear();
+		m_dispatchQueue.Clear();
+		m_sendQueue.Clear();
+
+		UpdateServiceTime();
+		m_timerWheelTime = m_serviceTime;
+		for (auto& slot : m_timerWheel)
+			slot.clear();
+
 		m_peers.reserve(peerCount);
 		for (std::size_t i = 0; i < peerCount; ++i)
 			m_peers.emplace_back(this, UInt16(i));
@@ -333,6 +356,12 @@ namespace Nz
 		m_socket.SetReceiveBufferSize(ENetConstants::ENetHost_ReceiveBufferSize);
 		m_socket.SetSendBufferSize(ENetConstants::ENetHost_SendBufferSize);
 
+		if (m_isUsingPortReuse && !m_socket.EnablePortReuse(true))
+		{
+			NazaraError("failed to enable port reuse: {0}", ErrorToString(m_socket.GetLastError()));
+			return false;
+		}
+
 		if (address.IsValid() && !address.IsLoopback())
 		{
 			if (m_socket.Bind(address) != SocketState::Bound)
@@ -352,6 +381,11 @@ namespace Nz
 		m_dispatchQueue.UnboundedSet(peer->GetPeerId());
 	}
 
+	void ENetHost::AddToSendQueue(ENetPeer* peer)
+	{
+		m_sendQueue.UnboundedSet(peer->GetPeerId());
+	}
+
 	void ENetHost::RemoveFromDispatchQueue(ENetPeer* peer)
 	{
 		m_dispatchQueue.UnboundedReset(peer->GetPeerId());
@@ -415,6 +449,51 @@ namespace Nz
 		return false;
 	}
 
+	int ENetHost::FlushSendBatch(ENetEvent* event)
+	{
+		std::size_t datagramIndex = 0;
+		while (datagramIndex < m_sendBatch.count)
+		{
+			std::size_t sentCount;
+			if (!m_socket.SendBatch(&m_sendBatch.datagrams[datagramIndex], m_sendBatch.count - datagramIndex, &sentCount))
+			{
+				ENetPeer* peer = m_sendBatchPeers[datagramIndex];
+				m_sendBatch.count = 0;
+
+				switch (m_socket.GetLastError())
+				{
+					case SocketError::NetworkError:
+					case SocketError::UnreachableHost:
+					{
+						if (!peer->IsConnected())
+						{
+							//< Network is down or unreachable (ex: IPv6 address when not supported), fails peer connection immediately
+							NotifyDisconnect(peer, event, true);
+							return 1;
+						}
+
+						[[fallthrough]];
+					}
+
+					default:
+						return -1;
+				}
+			}
+
+			// Socket buffer is full, remaining datagrams are dropped as they would have been without batching
+			if (sentCount == 0)
+				break;
+
+			for (std::size_t i = datagramIndex; i < datagramIndex + sentCount; ++i)
+				m_totalSentData += m_sendBatch.datagrams[i].size;
+
+			datagramIndex += sentCount;
+		}
+
+		m_sendBatch.count = 0;
+		return 0;
+	}
+
 	ENetPeer* ENetHost::HandleConnect(ENetProtocolHeader* /*header*/, ENetProtocol* command)
 	{
 		if (!m_allowsIncomingConnections)
@@ -531,14 +610,23 @@ namespace Nz
 			if (!m_compressor)
 				return false;
 
+			Time decompressionStart = GetElapsedNanoseconds();
 			std::size_t newSize = m_compressor->Decompress(peer, m_receivedData + headerSize, m_receivedDataLength - headerSize, m_packetData[1].data() + headerSize, m_packetData[1].size() - headerSize);
 			if (newSize == 0 || newSize > m_packetData[1].size() - headerSize)
 				return false;
 
+			RecordDecompression(peer, m_receivedDataLength - headerSize, newSize, GetElapsedNanoseconds() - decompressionStart);
+
 			std::memcpy(m_packetData[1].data(), header, headerSize);
 			m_receivedData = m_packetData[1].data();
 			m_receivedDataLength = headerSize + newSize;
 		}
+		else if (m_compressor)
+		{
+			// Count datagrams the remote compressor declined, as outgoing ones are
+			std::size_t dataSize = m_receivedDataLength - headerSize;
+			RecordDecompression(peer, dataSize, dataSize, Time::Zero());
+		}
 
 		// Checksum
 
@@ -547,6 +635,9 @@ namespace Nz
 			peer->m_address = m_receivedAddress;
 			peer->m_incomingDataTotal += SafeCast<UInt32>(m_receivedDataLength);
 			peer->m_totalByteReceived += SafeCast<UInt32>(m_receivedDataLength);
+
+			// Incoming commands may move the peer timeout and ping deadlines, reevaluate them on next send
+			AddToSendQueue(peer);
 		}
 
 		auto commandError = [&]() -> bool
@@ -705,6 +796,7 @@ namespace Nz
 		{
 			bool shouldReceive = true;
 			std::size_t receivedLength;
+			UInt8* receivedData = m_packetData[0].data();
 
 			if (m_isSimulationEnabled)
 			{
@@ -726,11 +818,37 @@ namespace Nz
 
 			if (shouldReceive)
 			{
-				if (!m_socket.Receive(m_packetData[0].data(), m_packetData[0].size(), &m_receivedAddress, &receivedLength))
-					return -1; //< Error
+				if (m_receiveBatchIndex >= m_receiveBatch.count)
+				{
+					// Drain as many datagrams as we can from the socket at once, the remaining ones will be handled by the next calls
+					for (std::size_t j = 0; j < m_receiveBatch.datagrams.size(); ++j)
+					{
+						NetBuffer& buffer = m_receiveBatch.buffers[j];
+						buffer.data = &m_receiveBatch.data[j * ENetConstants::ENetProtocol_MaximumMTU];
+						buffer.dataLength = ENetConstants::ENetProtocol_MaximumMTU;
 
-				if (receivedLength == 0)
-					return 0;
+						NetDatagram& datagram = m_receiveBatch.datagrams[j];
+						datagram.buffers = &buffer;
+						datagram.bufferCount = 1;
+					}
+
+					m_receiveBatchIndex = 0;
+					if (!m_socket.ReceiveBatch(m_receiveBatch.datagrams.data(), m_receiveBatch.datagrams.size(), &m_receiveBatch.count))
+					{
+						m_receiveBatch.count = 0;
+						return -1; //< Error
+					}
+
+					if (m_receiveBatch.count == 0)
+						return 0;
+				}
+
+				const NetDatagram& datagram = m_receiveBatch.datagrams[m_receiveBatchIndex];
+				m_receivedAddress = datagram.address;
+				receivedData = &m_receiveBatch.data[m_receiveBatchIndex * ENetConstants::ENetProtocol_MaximumMTU];
+				receivedLength = datagram.size;
+
+				m_receiveBatchIndex++;
 
 				if (m_isSimulationEnabled)
 				{
@@ -743,7 +861,7 @@ namespace Nz
 						PendingIncomingPacket pendingPacket;
 						pendingPacket.deliveryTime = m_serviceTime + delay;
 						pendingPacket.from = m_receivedAddress;
-						pendingPacket.data = ByteArray(m_packetData[0].data(), receivedLength);
+						pendingPacket.data = ByteArray(receivedData, receivedLength);
 
 						auto it = std::upper_bound(m_pendingIncomingPackets.begin(), m_pendingIncomingPackets.end(), pendingPacket, [] (const PendingIncomingPacket& first, const PendingIncomingPacket& second)
 						{
@@ -756,7 +874,7 @@ namespace Nz
 				}
 			}
 
-			m_receivedData = m_packetData[0].data();
+			m_receivedData = receivedData;
 			m_receivedDataLength = receivedLength;
 
 			m_totalReceivedData += receivedLength;
@@ -810,6 +928,83 @@ namespace Nz
 		}
 	}
 
+	void ENetHost::QueueDatagram(ENetPeer* peer)
+	{
+		NazaraAssertMsg(m_sendBatch.count < m_sendBatch.datagrams.size(), "send batch is full");
+
+		// Temporary buffers are reused for the next peer, gather them into the batch storage
+		std::size_t datagramIndex = m_sendBatch.count++;
+		UInt8* datagramData = &m_sendBatch.data[datagramIndex * ENetConstants::ENetProtocol_MaximumMTU];
+
+		std::size_t datagramSize = 0;
+		for (std::size_t i = 0; i < m_bufferCount; ++i)
+		{
+			const NetBuffer& buffer = m_buffers[i];
+			NazaraAssertMsg(datagramSize + buffer.dataLength <= ENetConstants::ENetProtocol_MaximumMTU, "datagram exceeds maximum MTU");
+
+			std::memcpy(datagramData + datagramSize, buffer.data, buffer.dataLength);
+			datagramSize += buffer.dataLength;
+		}
+
+		NetBuffer& batchBuffer = m_sendBatch.buffers[datagramIndex];
+		batchBuffer.data = datagramData;
+		batchBuffer.dataLength = datagramSize;
+
+		NetDatagram& datagram = m_sendBatch.datagrams[datagramIndex];
+		datagram.address = peer->GetAddress();
+		datagram.buffers = &batchBuffer;
+		datagram.bufferCount = 1;
+		datagram.size = 0;
+
+		m_sendBatchPeers[datagramIndex] = peer;
+	}
+
+	void ENetHost::RecordCompression(ENetPeer* peer, std::size_t uncompressedSize, std::size_t compressedSize, Time duration)
+	{
+		m_compressionTime += duration;
+		m_totalCompressedSentData += compressedSize;
+		m_totalUncompressedSentData += uncompressedSize;
+
+		if (peer)
+		{
+			peer->m_compressionTime += duration;
+			peer->m_totalCompressedSentData += compressedSize;
+			peer->m_totalUncompressedSentData += uncompressedSize;
+		}
+	}
+
+	void ENetHost::RecordDecompression(ENetPeer* peer, std::size_t compressedSize, std::size_t uncompressedSize, Time duration)
+	{
+		m_decompressionTime += duration;
+		m_totalCompressedReceivedData += compressedSize;
+		m_totalUncompressedReceivedData += uncompressedSize;
+
+		if (peer)
+		{
+			peer->m_decompressionTime += duration;
+			peer->m_totalCompressedReceivedData += compressedSize;
+			peer->m_totalUncompressedReceivedData += uncompressedSize;
+		}
+	}
+
+	void ENetHost::SchedulePeer(ENetPeer* peer, UInt32 serviceTime)
+	{
+		// Deadlines out of the wheel range are clamped, peers woken up too early will be rescheduled after being serviced
+		if (ENetTimeLess(serviceTime, m_timerWheelTime))
+			serviceTime = m_timerWheelTime;
+		else if (ENetTimeDifference(serviceTime, m_timerWheelTime) >= ENetConstants::ENetHost_TimerWheelSize)
+			serviceTime = m_timerWheelTime + ENetConstants::ENetHost_TimerWheelSize - 1;
+
+		// Previous entries are left in the wheel and ignored when their slot expires
+		if (peer->m_isServiceScheduled && ENetTimeLessEqual(peer->m_nextServiceTime, serviceTime))
+			return;
+
+		peer->m_isServiceScheduled = true;
+		peer->m_nextServiceTime = serviceTime;
+
+		m_timerWheel[serviceTime % ENetConstants::ENetHost_TimerWheelSize].push_back(peer->GetPeerId());
+	}
+
 	void ENetHost::SendAcknowledgements(ENetPeer* peer)
 	{
 		auto it = peer->m_acknowledgements.begin();
@@ -923,11 +1118,8 @@ namespace Nz
 			if (peer->m_sentReliableCommands.empty())
 				peer->m_nextTimeout = m_serviceTime + outgoingCommand->roundTripTimeout;
 
-			peer->m_sentReliableCommands.emplace_back(std::move(*outgoingCommand));
-
-			peer->m_outgoingReliableCommands.erase(outgoingCommand);
-			outgoingCommand = peer->m_sentReliableCommands.end();
-			--outgoingCommand;
+			// Splicing keeps the iterator valid, it now belongs to the sent list
+			peer->m_sentReliableCommands.splice(peer->m_sentReliableCommands.end(), peer->m_outgoingReliableCommands, outgoingCommand);
 
 			outgoingCommand->sentTime = m_serviceTime;
 
@@ -969,13 +1161,16 @@ namespace Nz
 		std::array<UInt8, sizeof(ENetProtocolHeader) + sizeof(UInt32)> headerData;
 		ENetProtocolHeader* header = reinterpret_cast<ENetProtocolHeader*>(headerData.data());
 
+		// Wake up peers whose retransmission timeout or ping interval has elapsed
+		UpdateTimerWheel();
+
 		m_continueSending = true;
 
 		while (m_continueSending)
 		{
 			m_continueSending = false;
 
-			for (std::size_t peer = 0; peer < m_peerCount; ++peer)
+			for (std::size_t peer = m_sendQueue.FindFirst(); peer != m_sendQueue.npos; peer = m_sendQueue.FindNext(peer))
 			{
 				ENetPeer* currentPeer = &m_peers[peer];
 				if (currentPeer->GetState() == ENetPeerState::Disconnected || currentPeer->GetState() == ENetPeerState::Zombie)
@@ -992,7 +1187,13 @@ namespace Nz
 				if (checkForTimeouts && currentPeer->m_canTimeout && !currentPeer->m_sentReliableCommands.empty() && ENetTimeGreaterEqual(m_serviceTime, currentPeer->m_nextTimeout) && currentPeer->CheckTimeouts(event))
 				{
 					if (event && event->type != ENetEventType::None)
+					{
+						// Don't hold the datagrams of previous peers until the next service
+						if (FlushSendBatch(nullptr) < 0)
+							return -1;
+
 						return 1;
+					}
 					else
 						continue;
 				}
@@ -1053,9 +1254,14 @@ namespace Nz
 				std::size_t compressedSize = 0;
 				if (m_compressor)
 				{
-					compressedSize = m_compressor->Compress(currentPeer, &m_buffers[1], m_bufferCount - 1, m_packetSize - sizeof(ENetProtocolHeader), m_packetData[1].data(), m_packetData[1].size());
+					std::size_t uncompressedSize = m_packetSize - sizeof(ENetProtocolHeader);
+
+					Time compressionStart = GetElapsedNanoseconds();
+					compressedSize = m_compressor->Compress(currentPeer, &m_buffers[1], m_bufferCount - 1, uncompressedSize, m_packetData[1].data(), m_packetData[1].size());
 					if (compressedSize > 0)
 						m_headerFlags |= ENetProtocolHeaderFlag_Compressed;
+
+					RecordCompression(currentPeer, uncompressedSize, (compressedSize > 0) ? compressedSize : uncompressedSize, GetElapsedNanoseconds() - compressionStart);
 				}
 
 				if (currentPeer->m_outgoingPeerID < ENetConstants::ENetProtocol_MaximumPeerId)
@@ -1110,31 +1316,13 @@ namespace Nz
 
 				if (sendNow)
 				{
-					std::size_t sentLength = 0;
-
-					if (!m_socket.SendMultiple(currentPeer->GetAddress(), m_buffers.data(), m_bufferCount, &sentLength))
+					if (m_sendBatch.count >= m_sendBatch.datagrams.size())
 					{
-						switch (m_socket.GetLastError())
-						{
-							case SocketError::NetworkError:
-							case SocketError::UnreachableHost:
-							{
-								if (!currentPeer->IsConnected())
-								{
-									//< Network is down or unreachable (ex: IPv6 address when not supported), fails peer connection immediately
-									NotifyDisconnect(currentPeer, event, true);
-									return 1;
-								}
-
-								[[fallthrough]];
-							}
-
-							default:
-								return -1;
-						}
+						if (int result = FlushSendBatch(event); result != 0)
+							return result;
 					}
 
-					m_totalSentData += sentLength;
+					QueueDatagram(currentPeer);
 				}
 
 				currentPeer->RemoveSentUnreliableCommands();
@@ -1142,6 +1330,27 @@ namespace Nz
 			}
 		}
 
+		for (std::size_t peer = m_sendQueue.FindFirst(); peer != m_sendQueue.npos; peer = m_sendQueue.FindNext(peer))
+		{
+			ENetPeer* currentPeer = &m_peers[peer];
+			if (currentPeer->GetState() != ENetPeerState::Disconnected && currentPeer->GetState() != ENetPeerState::Zombie)
+			{
+				// Peers with commands left (throttled by their window or the packet size) stay in the send queue
+				if (!currentPeer->m_acknowledgements.empty() || !currentPeer->m_outgoingReliableCommands.empty() || !currentPeer->m_outgoingUnreliableCommands.empty())
+					continue;
+
+				if (!currentPeer->m_sentReliableCommands.empty())
+					SchedulePeer(currentPeer, currentPeer->m_nextTimeout);
+				else
+					SchedulePeer(currentPeer, currentPeer->m_lastReceiveTime + currentPeer->m_pingInterval);
+			}
+
+			m_sendQueue.Reset(peer);
+		}
+
+		if (int result = FlushSendBatch(event); result != 0)
+			return result;
+
 		if (!m_pendingOutgoingPackets.empty())
 		{
 			auto it = m_pendingOutgoingPackets.begin();
@@ -1227,10 +1436,10 @@ namespace Nz
 				m_packetSize += packetBuffer.dataLength;
 
 				// In order to keep the packet buffer alive until we send it, place it into a temporary queue
-				peer->m_sentUnreliableCommands.emplace_back(std::move(*outgoingCommand));
+				peer->m_sentUnreliableCommands.splice(peer->m_sentUnreliableCommands.end(), peer->m_outgoingUnreliableCommands, outgoingCommand);
 			}
-
-			peer->m_outgoingUnreliableCommands.erase(outgoingCommand);
+			else
+				peer->m_outgoingUnreliableCommands.erase(outgoingCommand);
 
 			++m_bufferCount;
 			++m_commandCount;
@@ -1261,8 +1470,9 @@ namespace Nz
 			bandwidth = (m_outgoingBandwidth * elapsedTime) / 1000;
 
 			dataTotal = 0;
-			for (ENetPeer& peer : m_peers)
+			for (std::size_t peerId : m_activePeers.IterBits())
 			{
+				ENetPeer& peer = m_peers[peerId];
 				if (peer.IsConnected())
 					continue;
 
@@ -1284,8 +1494,9 @@ namespace Nz
 			else
 				throttle = (bandwidth * ENetConstants::ENetPeer_PacketThrottleScale) / dataTotal;
 
-			for (ENetPeer& peer : m_peers)
+			for (std::size_t peerId : m_activePeers.IterBits())
 			{
+				ENetPeer& peer = m_peers[peerId];
 				if (!peer.IsConnected() || peer.m_incomingBandwidth == 0 || peer.m_outgoingBandwidthThrottleEpoch == currentTime)
 					continue;
 
@@ -1313,8 +1524,9 @@ namespace Nz
 			else
 				throttle = (bandwidth * ENetConstants::ENetPeer_PacketThrottleScale) / dataTotal;
 
-			for (ENetPeer& peer : m_peers)
+			for (std::size_t peerId : m_activePeers.IterBits())
 			{
+				ENetPeer& peer = m_peers[peerId];
 				if (!peer.IsConnected() || peer.m_outgoingBandwidthThrottleEpoch == currentTime)
 					continue;
 
@@ -1343,8 +1555,9 @@ namespace Nz
 					needsAdjustment = false;
 					bandwidthLimit = bandwidth / peersRemaining;
 
-					for (ENetPeer& peer : m_peers)
+					for (std::size_t peerId : m_activePeers.IterBits())
 					{
+						ENetPeer& peer = m_peers[peerId];
 						if (!peer.IsConnected() || peer.m_incomingBandwidthThrottleEpoch == currentTime)
 							continue;
 
@@ -1360,8 +1573,9 @@ namespace Nz
 				}
 			}
 
-			for (ENetPeer& peer : m_peers)
+			for (std::size_t peerId : m_activePeers.IterBits())
 			{
+				ENetPeer& peer = m_peers[peerId];
 				if (!peer.IsConnected())
 					continue;
 
@@ -1378,6 +1592,37 @@ namespace Nz
 		}
 	}
 
+	void ENetHost::UpdateTimerWheel()
+	{
+		if (ENetTimeLess(m_serviceTime, m_timerWheelTime))
+			return;
+
+		// Every scheduled peer is due if a whole wheel revolution elapsed since the last update
+		UInt32 elapsedSlots = ENetTimeDifference(m_serviceTime, m_timerWheelTime) + 1;
+		bool expireAll = (elapsedSlots >= ENetConstants::ENetHost_TimerWheelSize);
+		UInt32 slotCount = std::min<UInt32>(elapsedSlots, ENetConstants::ENetHost_TimerWheelSize);
+
+		for (UInt32 i = 0; i < slotCount; ++i)
+		{
+			UInt32 slotTime = m_timerWheelTime + i;
+
+			std::vector<UInt16>& slot = m_timerWheel[slotTime % ENetConstants::ENetHost_TimerWheelSize];
+			for (UInt16 peerId : slot)
+			{
+				ENetPeer& peer = m_peers[peerId];
+				if (!peer.m_isServiceScheduled || (!expireAll && peer.m_nextServiceTime != slotTime))
+					continue;
+
+				peer.m_isServiceScheduled = false;
+				AddToSendQueue(&peer);
+			}
+
+			slot.clear();
+		}
+
+		m_timerWheelTime = m_serviceTime + 1;
+	}
+
 	std::size_t ENetHost::GetCommandSize(UInt8 commandNumber)
 	{
 		assert((commandNumber & UInt8(ENetProtocolCommand::Mask)) < UInt8(ENetProtocolCommand::Count));
@@ -0,0 +1,97 @@
+// Copyright (C) 2026 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#include <Nazara/Network/ENetLz4Compressor.hpp>
+#include <Nazara/Network/ENetProtocol.hpp>
+#include <NazaraUtils/Algorithm.hpp>
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+#define LZ4_STATIC_LINKING_ONLY
+#include <lz4.h>
+
+namespace Nz
+{
+	struct ENetLz4Compressor::Data
+	{
+		std::array<UInt8, ENetConstants::ENetProtocol_MaximumMTU> input;
+		ByteArray dictionary;
+		LZ4_stream_t dictionaryStream;
+		LZ4_stream_t stream;
+		int acceleration;
+	};
+
+	ENetLz4Compressor::ENetLz4Compressor(int acceleration) :
+	ENetLz4Compressor(ByteArray{}, acceleration)
+	{
+	}
+
+	ENetLz4Compressor::ENetLz4Compressor(ByteArray dictionary, int acceleration) :
+	m_data(std::make_unique<Data>())
+	{
+		// LZ4 only references the last 64KiB of its dictionary
+		constexpr std::size_t MaxDictionarySize = 64 * 1024;
+		if (dictionary.GetSize() > MaxDictionarySize)
+			dictionary.Erase(dictionary.begin(), dictionary.end() - MaxDictionarySize);
+
+		m_data->acceleration = acceleration;
+		m_data->dictionary = std::move(dictionary);
+
+		LZ4_initStream(&m_data->stream, sizeof(m_data->stream));
+		LZ4_initStream(&m_data->dictionaryStream, sizeof(m_data->dictionaryStream));
+		if (!m_data->dictionary.IsEmpty())
+			LZ4_loadDict(&m_data->dictionaryStream, reinterpret_cast<const char*>(m_data->dictionary.GetConstBuffer()), SafeCast<int>(m_data->dictionary.GetSize()));
+	}
+
+	ENetLz4Compressor::~ENetLz4Compressor() = default;
+
+	std::size_t ENetLz4Compressor::Compress(const ENetPeer* /*peer*/, const NetBuffer* buffers, std::size_t bufferCount, std::size_t totalInputSize, UInt8* output, std::size_t maxOutputSize)
+	{
+		if (totalInputSize > m_data->input.size())
+			return 0;
+
+		// Datagrams are compressed independently of each other as they may be lost or reordered
+		UInt8* inputPtr = m_data->input.data();
+		for (std::size_t i = 0; i < bufferCount; ++i)
+		{
+			std::memcpy(inputPtr, buffers[i].data, buffers[i].dataLength);
+			inputPtr += buffers[i].dataLength;
+		}
+
+		const char* input = reinterpret_cast<const char*>(m_data->input.data());
+		int outputCapacity = SafeCast<int>(std::min(maxOutputSize, totalInputSize));
+
+		int compressedSize;
+		if (!m_data->dictionary.IsEmpty())
+		{
+			// Reuse the hash table built from the dictionary instead of reloading it
+			LZ4_resetStream_fast(&m_data->stream);
+			LZ4_attach_dictionary(&m_data->stream, &m_data->dictionaryStream);
+			compressedSize = LZ4_compress_fast_continue(&m_data->stream, input, reinterpret_cast<char*>(output), SafeCast<int>(totalInputSize), outputCapacity, m_data->acceleration);
+		}
+		else
+			compressedSize = LZ4_compress_fast_extState_fastReset(&m_data->stream, input, reinterpret_cast<char*>(output), SafeCast<int>(totalInputSize), outputCapacity, m_data->acceleration);
+
+		// Don't bother sending compressed data if it doesn't save anything
+		if (compressedSize <= 0 || std::size_t(compressedSize) >= totalInputSize)
+			return 0;
+
+		return std::size_t(compressedSize);
+	}
+
+	std::size_t ENetLz4Compressor::Decompress(const ENetPeer* /*peer*/, const UInt8* input, std::size_t inputSize, UInt8* output, std::size_t maxOutputSize)
+	{
+		int decompressedSize;
+		if (!m_data->dictionary.IsEmpty())
+			decompressedSize = LZ4_decompress_safe_usingDict(reinterpret_cast<const char*>(input), reinterpret_cast<char*>(output), SafeCast<int>(inputSize), SafeCast<int>(maxOutputSize), reinterpret_cast<const char*>(m_data->dictionary.GetConstBuffer()), SafeCast<int>(m_data->dictionary.GetSize()));
+		else
+			decompressedSize = LZ4_decompress_safe(reinterpret_cast<const char*>(input), reinterpret_cast<char*>(output), SafeCast<int>(inputSize), SafeCast<int>(maxOutputSize));
+
+		if (decompressedSize < 0)
+			return 0;
+
+		return std::size_t(decompressedSize);
+	}
+}
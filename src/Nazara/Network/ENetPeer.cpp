@@ -18,6 +18,24 @@
 
 namespace Nz
 {
+	ENetPeer::ENetPeer(ENetHost* host, UInt16 peerId) :
+	m_host(host),
+	m_dispatchedCommands(host->m_commandPool.get()),
+	m_outgoingReliableCommands(host->m_commandPool.get()),
+	m_outgoingUnreliableCommands(host->m_commandPool.get()),
+	m_sentReliableCommands(host->m_commandPool.get()),
+	m_sentUnreliableCommands(host->m_commandPool.get()),
+	m_state(ENetPeerState::Disconnected),
+	m_incomingSessionID(0xFF),
+	m_outgoingSessionID(0xFF),
+	m_incomingPeerID(peerId),
+	m_canTimeout(true),
+	m_isServiceScheduled(false),
+	m_isSimulationEnabled(false)
+	{
+		Reset();
+	}
+
 	void ENetPeer::Disconnect(UInt32 data)
 	{
 		if (m_state == ENetPeerState::Disconnecting ||
@@ -122,7 +140,11 @@ namespace Nz
 
 		m_state = ENetPeerState::Disconnected;
 
+		m_host->m_activePeers.UnboundedReset(m_incomingPeerID);
+		m_host->m_sendQueue.UnboundedReset(m_incomingPeerID);
+
 		m_canTimeout = true;
+		m_isServiceScheduled = false;
 		m_incomingBandwidth = 0;
 		m_outgoingBandwidth = 0;
 		m_incomingBandwidthThrottleEpoch = 0;
@@ -131,6 +153,7 @@ namespace Nz
 		m_outgoingDataTotal = 0;
 		m_lastSendTime = 0;
 		m_lastReceiveTime = 0;
+		m_nextServiceTime = 0;
 		m_nextTimeout = 0;
 		m_earliestTimeout = 0;
 		m_packetLossEpoch = 0;
@@ -165,6 +188,12 @@ namespace Nz
 		m_timedOut = false;
 		m_totalByteReceived = 0;
 		m_totalByteSent = 0;
+		m_totalCompressedReceivedData = 0;
+		m_totalCompressedSentData = 0;
+		m_totalUncompressedReceivedData = 0;
+		m_totalUncompressedSentData = 0;
+		m_compressionTime = Time::Zero();
+		m_decompressionTime = Time::Zero();
 		m_totalPacketReceived = 0;
 		m_totalPacketLost = 0;
 		m_totalPacketSent = 0;
@@ -327,8 +356,10 @@ namespace Nz
 			command.roundTripTimeout = m_roundTripTime + 4 * m_roundTripTimeVariance;
 			command.roundTripTimeoutLimit = m_timeoutLimit * command.roundTripTimeout;
 
-			m_outgoingReliableCommands.insert(insertPosition, std::move(command));
-			it = m_sentReliableCommands.erase(it);
+			// Relink the node instead of reallocating it
+			auto nextIt = std::next(it);
+			m_outgoingReliableCommands.splice(insertPosition, m_sentReliableCommands, it);
+			it = nextIt;
 
 			if (it == m_sentReliableCommands.begin() && !m_sentReliableCommands.empty())
 			{
@@ -378,9 +409,9 @@ namespace Nz
 
 	void ENetPeer::DispatchIncomingUnreliableCommands(Channel& channel)
 	{
-		std::list<IncomingCommmand>::iterator currentCommand;
-		std::list<IncomingCommmand>::iterator droppedCommand;
-		std::list<IncomingCommmand>::iterator startCommand;
+		IncomingCommandList::iterator currentCommand;
+		IncomingCommandList::iterator droppedCommand;
+		IncomingCommandList::iterator startCommand;
 
 		for (droppedCommand = startCommand = currentCommand = channel.incomingUnreliableCommands.begin();
 		     currentCommand != channel.incomingUnreliableCommands.end();
@@ -884,7 +915,7 @@ namespace Nz
 		RemoveSentReliableCommand(1, 0xFF);
 
 		if (channelCount < m_channels.size())
-			m_channels.resize(channelCount);
+			ResizeChannels(channelCount);
 
 		m_outgoingPeerID = NetToHost(command->verifyConnect.outgoingPeerID);
 		m_incomingSessionID = command->verifyConnect.incomingSessionID;
@@ -905,7 +936,7 @@ namespace Nz
 
 	void ENetPeer::InitIncoming(std::size_t channelCount, const IpAddress& address, ENetProtocolConnect& incomingCommand)
 	{
-		m_channels.resize(channelCount);
+		ResizeChannels(channelCount);
 		m_address = address;
 
 		m_connectID = incomingCommand.connectID;
@@ -918,6 +949,8 @@ namespace Nz
 		m_outgoingPeerID = NetToHost(incomingCommand.outgoingPeerID);
 		m_state = ENetPeerState::AcknowledgingConnect;
 
+		m_host->m_activePeers.UnboundedSet(m_incomingPeerID);
+
 		UInt8 incomingSessionId, outgoingSessionId;
 
 		incomingSessionId = incomingCommand.incomingSessionID == 0xFF ? m_outgoingSessionID : incomingCommand.incomingSessionID;
@@ -946,12 +979,14 @@ namespace Nz
 
 	void ENetPeer::InitOutgoing(std::size_t channelCount, const IpAddress& address, UInt32 connectId, UInt32 windowSize)
 	{
-		m_channels.resize(channelCount);
+		ResizeChannels(channelCount);
 
 		m_address = address;
 		m_connectID = connectId;
 		m_state = ENetPeerState::Connecting;
 		m_windowSize = Clamp<UInt32>(windowSize, ENetConstants::ENetProtocol_MinimumWindowSize, ENetConstants::ENetProtocol_MaximumWindowSize);
+
+		m_host->m_activePeers.UnboundedSet(m_incomingPeerID);
 	}
 
 	void ENetPeer::OnConnect()
@@ -978,7 +1013,7 @@ namespace Nz
 
 	ENetProtocolCommand ENetPeer::RemoveSentReliableCommand(UInt16 reliableSequenceNumber, UInt8 channelId)
 	{
-		std::list<OutgoingCommand>* commandList = nullptr;
+		OutgoingCommandList* commandList = nullptr;
 
 		bool found = false;
 		auto currentCommand = m_sentReliableCommands.begin();
@@ -1078,6 +1113,19 @@ namespace Nz
 		m_channels.clear();
 	}
 
+	void ENetPeer::ResizeChannels(std::size_t channelCount)
+	{
+		if (channelCount < m_channels.size())
+			m_channels.erase(m_channels.begin() + channelCount, m_channels.end());
+		else
+		{
+			// Channels queues share the host command pool, so they can't be default-constructed
+			m_channels.reserve(channelCount);
+			while (m_channels.size() < channelCount)
+				m_channels.emplace_back(m_host->m_commandPool.get());
+		}
+	}
+
 	bool ENetPeer::QueueAcknowledgement(ENetProtocol*command, UInt16 sentTime)
 	{
 		if (command->header.channelID < m_channels.size())
@@ -1102,6 +1150,7 @@ namespace Nz
 		m_totalByteSent += sizeof(Acknowledgement);
 
 		m_acknowledgements.emplace_back(acknowledgment);
+		m_host->AddToSendQueue(this);
 
 		return true;
 	}
@@ -1141,8 +1190,8 @@ namespace Nz
 				return discardCommand();
 		}
 
-		std::list<IncomingCommmand>* commandList = nullptr;
-		std::list<IncomingCommmand>::reverse_iterator currentCommand;
+		IncomingCommandList* commandList = nullptr;
+		IncomingCommandList::reverse_iterator currentCommand;
 
 		switch (static_cast<ENetProtocolCommand>(command.header.command & UInt8(ENetProtocolCommand::Mask)))
 		{
@@ -1347,6 +1396,8 @@ namespace Nz
 			m_outgoingReliableCommands.emplace_back(outgoingCommand);
 		else
 			m_outgoingUnreliableCommands.emplace_back(outgoingCommand);
+
+		m_host->AddToSendQueue(this);
 	}
 
 	int ENetPeer::Throttle(UInt32 rtt)
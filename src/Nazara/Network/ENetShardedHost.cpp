@@ -0,0 +1,305 @@
+// Copyright (C) 2026 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#include <Nazara/Network/ENetShardedHost.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/ThreadExt.hpp>
+#include <Nazara/Network/ENetHost.hpp>
+#include <Nazara/Network/ENetPeer.hpp>
+#include <Nazara/Network/UdpSocket.hpp>
+#include <NazaraUtils/Algorithm.hpp>
+#include <concurrentqueue.h>
+#include <fmt/format.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace Nz
+{
+	namespace NAZARA_ANONYMOUS_NAMESPACE
+	{
+		// Bounds the latency of commands issued from the game thread, as shards wait for incoming datagrams between them
+		constexpr UInt32 ShardServiceTimeout = 1;
+	}
+
+	struct ENetShardedHost::Shard
+	{
+		enum class CommandType
+		{
+			Broadcast,
+			Disconnect,
+			Send
+		};
+
+		struct Command
+		{
+			ByteArray data;
+			CommandType type;
+			ENetPacketFlags flags;
+			UInt32 disconnectData;
+			UInt32 generation;
+			UInt16 peerIndex;
+			UInt8 channelId;
+		};
+
+		struct PeerSlot
+		{
+			ENetPeer* peer = nullptr;
+			UInt32 generation = 0; //< incremented on each connection, to recognize commands sent to a previous peer
+		};
+
+		// Returns nullptr if the peer disconnected, even if another one took its slot since
+		ENetPeer* GetPeer(std::size_t peerIndex, UInt32 generation) const
+		{
+			if (peerIndex >= peers.size())
+				return nullptr;
+
+			const PeerSlot& slot = peers[peerIndex];
+			return (slot.generation == generation) ? slot.peer : nullptr;
+		}
+
+		ENetHost host;
+		moodycamel::ConcurrentQueue<Command> commands;
+		std::size_t shardIndex;
+		std::thread thread;
+		std::vector<PeerSlot> peers; //< indexed by peer id, only accessed by the shard thread
+	};
+
+	struct ENetShardedHost::Data
+	{
+		moodycamel::ConcurrentQueue<Event> events;
+		std::atomic_bool running = false;
+		std::vector<std::unique_ptr<Shard>> shards;
+		IpAddress boundAddress;
+	};
+
+	ENetShardedHost::ENetShardedHost() :
+	m_data(std::make_unique<Data>())
+	{
+	}
+
+	ENetShardedHost::~ENetShardedHost()
+	{
+		Destroy();
+	}
+
+	void ENetShardedHost::Broadcast(UInt8 channelId, ENetPacketFlags flags, ByteArray&& packet)
+	{
+		for (std::size_t i = 0; i < m_data->shards.size(); ++i)
+		{
+			Shard::Command command;
+			command.type = Shard::CommandType::Broadcast;
+			command.channelId = channelId;
+			command.flags = flags;
+			command.data = (i == m_data->shards.size() - 1) ? std::move(packet) : packet;
+
+			m_data->shards[i]->commands.enqueue(std::move(command));
+		}
+	}
+
+	bool ENetShardedHost::Create(const IpAddress& listenAddress, std::size_t shardCount, std::size_t peerCountPerShard, std::size_t channelCount)
+	{
+		NazaraAssertMsg(listenAddress.IsValid() && !listenAddress.IsLoopback(), "sharded hosts must listen on a valid non-loopback address");
+		NazaraAssertMsg(shardCount > 0, "shard count must be over zero");
+		NazaraAssertMsg(shardCount <= 0xFFFF, "too many shards");
+
+		Destroy();
+
+		if (shardCount > 1 && !UdpSocket::IsPortReuseSupported())
+		{
+			NazaraWarning("port reuse is not supported on this platform, falling back to a single shard");
+			shardCount = 1;
+		}
+
+		IpAddress shardAddress = listenAddress;
+		for (std::size_t i = 0; i < shardCount; ++i)
+		{
+			auto shard = std::make_unique<Shard>();
+			shard->shardIndex = i;
+			shard->host.EnablePortReuse(shardCount > 1);
+
+			if (!shard->host.Create(shardAddress, peerCountPerShard, channelCount))
+			{
+				NazaraError("failed to create shard #{0}", i);
+				m_data->shards.clear();
+				return false;
+			}
+
+			// Next shards have to bind the same port, even if the system chose it
+			if (i == 0)
+			{
+				m_data->boundAddress = shard->host.GetBoundAddress();
+				shardAddress.SetPort(m_data->boundAddress.GetPort());
+			}
+
+			m_data->shards.push_back(std::move(shard));
+		}
+
+		m_data->running = true;
+		for (auto& shardPtr : m_data->shards)
+		{
+			Shard& shard = *shardPtr;
+			shard.thread = std::thread([this, &shard]
+			{
+				SetCurrentThreadName(fmt::format("NzENetShard #{0}", shard.shardIndex).c_str());
+				RunShard(shard);
+			});
+		}
+
+		return true;
+	}
+
+	void ENetShardedHost::Destroy()
+	{
+		m_data->running = false;
+		for (auto& shardPtr : m_data->shards)
+		{
+			if (shardPtr->thread.joinable())
+				shardPtr->thread.join();
+		}
+
+		m_data->shards.clear();
+		m_data->boundAddress = IpAddress::Invalid;
+
+		Event event;
+		while (m_data->events.try_dequeue(event));
+	}
+
+	void ENetShardedHost::Disconnect(UInt64 peerId, UInt32 data)
+	{
+		std::size_t shardIndex = GetShardIndex(peerId);
+		NazaraAssertMsg(shardIndex < m_data->shards.size(), "invalid peer id");
+
+		Shard::Command command;
+		command.type = Shard::CommandType::Disconnect;
+		command.peerIndex = SafeCast<UInt16>(GetPeerIndex(peerId));
+		command.generation = GetGeneration(peerId);
+		command.disconnectData = data;
+
+		m_data->shards[shardIndex]->commands.enqueue(std::move(command));
+	}
+
+	IpAddress ENetShardedHost::GetBoundAddress() const
+	{
+		return m_data->boundAddress;
+	}
+
+	std::size_t ENetShardedHost::GetShardCount() const
+	{
+		return m_data->shards.size();
+	}
+
+	bool ENetShardedHost::PollEvent(Event* event)
+	{
+		NazaraAssertMsg(event, "invalid event");
+		return m_data->events.try_dequeue(*event);
+	}
+
+	void ENetShardedHost::Send(UInt64 peerId, UInt8 channelId, ENetPacketFlags flags, ByteArray&& packet)
+	{
+		std::size_t shardIndex = GetShardIndex(peerId);
+		NazaraAssertMsg(shardIndex < m_data->shards.size(), "invalid peer id");
+
+		Shard::Command command;
+		command.type = Shard::CommandType::Send;
+		command.peerIndex = SafeCast<UInt16>(GetPeerIndex(peerId));
+		command.generation = GetGeneration(peerId);
+		command.channelId = channelId;
+		command.flags = flags;
+		command.data = std::move(packet);
+
+		m_data->shards[shardIndex]->commands.enqueue(std::move(command));
+	}
+
+	void ENetShardedHost::RunShard(Shard& shard)
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		Shard::Command command;
+		ENetEvent event;
+
+		auto ForwardEvent = [&]
+		{
+			ENetPeer* peer = event.peer;
+
+			UInt16 peerIndex = peer->GetPeerId();
+			if (peerIndex >= shard.peers.size())
+				shard.peers.resize(peerIndex + 1);
+
+			Shard::PeerSlot& peerSlot = shard.peers[peerIndex];
+			if (event.type == ENetEventType::IncomingConnect || event.type == ENetEventType::OutgoingConnect)
+			{
+				peerSlot.peer = peer;
+				peerSlot.generation++;
+			}
+
+			Event forwardedEvent;
+			forwardedEvent.type = event.type;
+			forwardedEvent.peerId = BuildPeerId(shard.shardIndex, peerIndex, peerSlot.generation);
+			forwardedEvent.eventData = event.data;
+			forwardedEvent.channelId = event.channelId;
+
+			switch (event.type)
+			{
+				case ENetEventType::Disconnect:
+				case ENetEventType::DisconnectTimeout:
+					peerSlot.peer = nullptr;
+					break;
+
+				case ENetEventType::Receive:
+				{
+					// Packets are reference-counted without synchronization, only their content can leave the shard thread
+					if (event.packet->referenceCount == 1)
+						forwardedEvent.data = std::move(event.packet->data);
+					else
+						forwardedEvent.data = event.packet->data;
+
+					event.packet.Reset();
+					break;
+				}
+
+				case ENetEventType::IncomingConnect:
+				case ENetEventType::OutgoingConnect:
+				case ENetEventType::None:
+					break;
+			}
+
+			m_data->events.enqueue(std::move(forwardedEvent));
+		};
+
+		while (m_data->running.load(std::memory_order_relaxed))
+		{
+			while (shard.commands.try_dequeue(command))
+			{
+				switch (command.type)
+				{
+					case Shard::CommandType::Broadcast:
+						shard.host.Broadcast(command.channelId, command.flags, std::move(command.data));
+						break;
+
+					case Shard::CommandType::Disconnect:
+					{
+						if (ENetPeer* peer = shard.GetPeer(command.peerIndex, command.generation))
+							peer->Disconnect(command.disconnectData);
+						break;
+					}
+
+					case Shard::CommandType::Send:
+					{
+						if (ENetPeer* peer = shard.GetPeer(command.peerIndex, command.generation))
+							peer->Send(command.channelId, command.flags, std::move(command.data));
+						break;
+					}
+				}
+			}
+
+			int result = shard.host.Service(&event, ShardServiceTimeout);
+			while (result > 0)
+			{
+				ForwardEvent();
+				result = shard.host.Service(&event, 0);
+			}
+		}
+	}
+}
@@ -0,0 +1,95 @@
+// Copyright (C) 2026 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#include <Nazara/Network/ENetZstdCompressor.hpp>
+#include <Nazara/Network/ENetProtocol.hpp>
+#include <array>
+#include <cstring>
+#include <stdexcept>
+#include <zstd.h>
+
+namespace Nz
+{
+	struct ENetZstdCompressor::Data
+	{
+		struct ZstdDeleter
+		{
+			void operator()(ZSTD_CCtx* context) const { ZSTD_freeCCtx(context); }
+			void operator()(ZSTD_CDict* dictionary) const { ZSTD_freeCDict(dictionary); }
+			void operator()(ZSTD_DCtx* context) const { ZSTD_freeDCtx(context); }
+			void operator()(ZSTD_DDict* dictionary) const { ZSTD_freeDDict(dictionary); }
+		};
+
+		std::array<UInt8, ENetConstants::ENetProtocol_MaximumMTU> input;
+		std::unique_ptr<ZSTD_CCtx, ZstdDeleter> compressionContext;
+		std::unique_ptr<ZSTD_CDict, ZstdDeleter> compressionDictionary;
+		std::unique_ptr<ZSTD_DCtx, ZstdDeleter> decompressionContext;
+		std::unique_ptr<ZSTD_DDict, ZstdDeleter> decompressionDictionary;
+	};
+
+	ENetZstdCompressor::ENetZstdCompressor(int compressionLevel) :
+	ENetZstdCompressor(ByteArray{}, compressionLevel)
+	{
+	}
+
+	ENetZstdCompressor::ENetZstdCompressor(ByteArray dictionary, int compressionLevel) :
+	m_data(std::make_unique<Data>())
+	{
+		m_data->compressionContext.reset(ZSTD_createCCtx());
+		m_data->decompressionContext.reset(ZSTD_createDCtx());
+		if (!m_data->compressionContext || !m_data->decompressionContext)
+			throw std::runtime_error("failed to create zstd contexts");
+
+		ZSTD_CCtx_setParameter(m_data->compressionContext.get(), ZSTD_c_compressionLevel, compressionLevel);
+
+		// Every byte counts in a datagram, skip optional frame fields
+		ZSTD_CCtx_setParameter(m_data->compressionContext.get(), ZSTD_c_checksumFlag, 0);
+		ZSTD_CCtx_setParameter(m_data->compressionContext.get(), ZSTD_c_dictIDFlag, 0);
+
+		if (!dictionary.IsEmpty())
+		{
+			// Digested dictionaries are built once and referenced by every frame
+			m_data->compressionDictionary.reset(ZSTD_createCDict(dictionary.GetConstBuffer(), dictionary.GetSize(), compressionLevel));
+			m_data->decompressionDictionary.reset(ZSTD_createDDict(dictionary.GetConstBuffer(), dictionary.GetSize()));
+			if (!m_data->compressionDictionary || !m_data->decompressionDictionary)
+				throw std::runtime_error("failed to load zstd dictionary");
+
+			ZSTD_CCtx_refCDict(m_data->compressionContext.get(), m_data->compressionDictionary.get());
+			ZSTD_DCtx_refDDict(m_data->decompressionContext.get(), m_data->decompressionDictionary.get());
+		}
+	}
+
+	ENetZstdCompressor::~ENetZstdCompressor() = default;
+
+	std::size_t ENetZstdCompressor::Compress(const ENetPeer* /*peer*/, const NetBuffer* buffers, std::size_t bufferCount, std::size_t totalInputSize, UInt8* output, std::size_t maxOutputSize)
+	{
+		if (totalInputSize > m_data->input.size())
+			return 0;
+
+		// Datagrams are compressed independently of each other as they may be lost or reordered
+		UInt8* inputPtr = m_data->input.data();
+		for (std::size_t i = 0; i < bufferCount; ++i)
+		{
+			std::memcpy(inputPtr, buffers[i].data, buffers[i].dataLength);
+			inputPtr += buffers[i].dataLength;
+		}
+
+		std::size_t compressedSize = ZSTD_compress2(m_data->compressionContext.get(), output, maxOutputSize, m_data->input.data(), totalInputSize);
+
+		// Don't bother sending compressed data if it doesn't save anything
+		if (ZSTD_isError(compressedSize) || compressedSize >= totalInputSize)
+			return 0;
+
+		return compressedSize;
+	}
+
+	std::size_t ENetZstdCompressor::Decompress(const ENetPeer* /*peer*/, const UInt8* input, std::size_t inputSize, UInt8* output, std::size_t maxOutputSize)
+	{
+		std::size_t decompressedSize = ZSTD_decompressDCtx(m_data->decompressionContext.get(), output, maxOutputSize, input, inputSize);
+		if (ZSTD_isError(decompressedSize))
+			return 0;
+
+		return decompressedSize;
+	}
+}
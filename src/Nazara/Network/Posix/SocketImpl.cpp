@@ -7,6 +7,7 @@
 #include <Nazara/Core/StringExt.hpp>
 #include <Nazara/Network/Algorithm.hpp>
 #include <Nazara/Network/NetBuffer.hpp>
+#include <Nazara/Network/NetDatagram.hpp>
 #include <Nazara/Network/Posix/IpAddressImpl.hpp>
 #include <NazaraUtils/Algorithm.hpp>
 #include <NazaraUtils/EnumArray.hpp>
@@ -150,6 +151,15 @@ namespace Nz
 		return true;
 	}
 
+	bool SocketImpl::IsReusePortSupported()
+	{
+#if defined(NAZARA_PLATFORM_LINUX) && defined(SO_REUSEPORT)
+		return true;
+#else
+		return false;
+#endif
+	}
+
 	SocketError SocketImpl::GetLastError(SocketHandle handle, SocketError* error)
 	{
 		int code = GetLastErrorCode(handle, error);
@@ -497,6 +507,88 @@ namespace Nz
 		return true;
 	}
 
+#if NAZARA_NETWORK_BATCH_SUPPORT
+	bool SocketImpl::ReceiveBatch(SocketHandle handle, NetDatagram* datagrams, std::size_t datagramCount, std::size_t* receivedCount, SocketError* error)
+	{
+		NazaraAssertMsg(handle != InvalidHandle, "Invalid handle");
+		NazaraAssertMsg(datagrams && datagramCount > 0, "Invalid datagrams");
+
+		std::size_t totalBufferCount = 0;
+		for (std::size_t i = 0; i < datagramCount; ++i)
+			totalBufferCount += datagrams[i].bufferCount;
+
+		StackArray<iovec> sysBuffers = NazaraStackArray(iovec, totalBufferCount);
+		StackArray<IpAddressImpl::SockAddrBuffer> nameBuffers = NazaraStackArray(IpAddressImpl::SockAddrBuffer, datagramCount);
+		StackArray<mmsghdr> msgHdrs = NazaraStackArray(mmsghdr, datagramCount);
+
+		std::size_t bufferOffset = 0;
+		for (std::size_t i = 0; i < datagramCount; ++i)
+		{
+			NetDatagram& datagram = datagrams[i];
+			NazaraAssertMsg(datagram.buffers && datagram.bufferCount > 0, "Invalid datagram buffers");
+
+			for (std::size_t j = 0; j < datagram.bufferCount; ++j)
+			{
+				sysBuffers[bufferOffset + j].iov_base = datagram.buffers[j].data;
+				sysBuffers[bufferOffset + j].iov_len = datagram.buffers[j].dataLength;
+			}
+
+			nameBuffers[i].fill(0);
+
+			mmsghdr& msgHdr = msgHdrs[i];
+			std::memset(&msgHdr, 0, sizeof(msgHdr));
+
+			msgHdr.msg_hdr.msg_iov = &sysBuffers[bufferOffset];
+			msgHdr.msg_hdr.msg_iovlen = datagram.bufferCount;
+			msgHdr.msg_hdr.msg_name = nameBuffers[i].data();
+			msgHdr.msg_hdr.msg_namelen = static_cast<socklen_t>(nameBuffers[i].size());
+
+			bufferOffset += datagram.bufferCount;
+		}
+
+		// MSG_WAITFORONE prevents blocking sockets from waiting until the whole batch is filled
+		int messageCount = recvmmsg(handle, msgHdrs.data(), static_cast<unsigned int>(datagramCount), MSG_WAITFORONE, nullptr);
+		if (messageCount == -1)
+		{
+			int errorCode = errno;
+			if (errorCode == EAGAIN)
+				errorCode = EWOULDBLOCK;
+
+			switch (errorCode)
+			{
+				case EWOULDBLOCK:
+				{
+					// If we have no data and are not blocking, return true with no datagram read
+					messageCount = 0;
+					break;
+				}
+
+				default:
+				{
+					if (error)
+						*error = TranslateErrorToSocketError(errorCode);
+
+					return false; //< Error
+				}
+			}
+		}
+
+		for (int i = 0; i < messageCount; ++i)
+		{
+			datagrams[i].address = IpAddressImpl::FromSockAddr(reinterpret_cast<const sockaddr*>(nameBuffers[i].data()));
+			datagrams[i].size = msgHdrs[i].msg_len;
+		}
+
+		if (receivedCount)
+			*receivedCount = static_cast<std::size_t>(messageCount);
+
+		if (error)
+			*error = SocketError::NoError;
+
+		return true;
+	}
+#endif
+
 	bool SocketImpl::ReceiveFrom(SocketHandle handle, void* buffer, int length, IpAddress* from, int* read, SocketError* error)
 	{
 		NazaraAssertMsg(handle != InvalidHandle, "Invalid handle");
@@ -684,6 +776,84 @@ namespace Nz
 		return true;
 	}
 
+#if NAZARA_NETWORK_BATCH_SUPPORT
+	bool SocketImpl::SendBatch(SocketHandle handle, NetDatagram* datagrams, std::size_t datagramCount, std::size_t* sentCount, SocketError* error)
+	{
+		NazaraAssertMsg(handle != InvalidHandle, "Invalid handle");
+		NazaraAssertMsg(datagrams && datagramCount > 0, "Invalid datagrams");
+
+		std::size_t totalBufferCount = 0;
+		for (std::size_t i = 0; i < datagramCount; ++i)
+			totalBufferCount += datagrams[i].bufferCount;
+
+		StackArray<iovec> sysBuffers = NazaraStackArray(iovec, totalBufferCount);
+		StackArray<IpAddressImpl::SockAddrBuffer> nameBuffers = NazaraStackArray(IpAddressImpl::SockAddrBuffer, datagramCount);
+		StackArray<mmsghdr> msgHdrs = NazaraStackArray(mmsghdr, datagramCount);
+
+		std::size_t bufferOffset = 0;
+		for (std::size_t i = 0; i < datagramCount; ++i)
+		{
+			NetDatagram& datagram = datagrams[i];
+			NazaraAssertMsg(datagram.buffers && datagram.bufferCount > 0, "Invalid datagram buffers");
+
+			for (std::size_t j = 0; j < datagram.bufferCount; ++j)
+			{
+				sysBuffers[bufferOffset + j].iov_base = datagram.buffers[j].data;
+				sysBuffers[bufferOffset + j].iov_len = datagram.buffers[j].dataLength;
+			}
+
+			mmsghdr& msgHdr = msgHdrs[i];
+			std::memset(&msgHdr, 0, sizeof(msgHdr));
+
+			msgHdr.msg_hdr.msg_iov = &sysBuffers[bufferOffset];
+			msgHdr.msg_hdr.msg_iovlen = datagram.bufferCount;
+			msgHdr.msg_hdr.msg_name = nameBuffers[i].data();
+			msgHdr.msg_hdr.msg_namelen = IpAddressImpl::ToSockAddr(datagram.address, nameBuffers[i].data());
+
+			bufferOffset += datagram.bufferCount;
+		}
+
+#if defined(MSG_NOSIGNAL)
+		int messageCount = sendmmsg(handle, msgHdrs.data(), static_cast<unsigned int>(datagramCount), MSG_NOSIGNAL);
+#else
+		int messageCount = sendmmsg(handle, msgHdrs.data(), static_cast<unsigned int>(datagramCount), 0);
+#endif
+
+		if (messageCount == -1)
+		{
+			int errorCode = errno;
+			if (errorCode == EAGAIN)
+				errorCode = EWOULDBLOCK;
+
+			switch (errorCode)
+			{
+				case EWOULDBLOCK:
+					messageCount = 0;
+					break;
+
+				default:
+				{
+					if (error)
+						*error = TranslateErrorToSocketError(errorCode);
+
+					return false; //< Error
+				}
+			}
+		}
+
+		for (int i = 0; i < messageCount; ++i)
+			datagrams[i].size = msgHdrs[i].msg_len;
+
+		if (sentCount)
+			*sentCount = static_cast<std::size_t>(messageCount);
+
+		if (error)
+			*error = SocketError::NoError;
+
+		return true;
+	}
+#endif
+
 	bool SocketImpl::SendMultiple(SocketHandle handle, const NetBuffer* buffers, std::size_t bufferCount, const IpAddress& to, int* sent, SocketError* error)
 	{
 		NazaraAssertMsg(handle != InvalidHandle, "Invalid handle");
@@ -927,6 +1097,36 @@ namespace Nz
 		return true;
 	}
 
+	bool SocketImpl::SetReusePort(SocketHandle handle, bool reusePort, SocketError* error)
+	{
+		NazaraAssertMsg(handle != InvalidHandle, "Invalid handle");
+
+#if defined(NAZARA_PLATFORM_LINUX) && defined(SO_REUSEPORT)
+		// On Linux, datagrams are load-balanced between sockets sharing a port (using a hash of the source address)
+		int option = reusePort;
+		if (setsockopt(handle, SOL_SOCKET, SO_REUSEPORT, reinterpret_cast<const char*>(&option), sizeof(option)) == -1)
+		{
+			if (error)
+				*error = TranslateErrorToSocketError(errno);
+
+			return false; //< Error
+		}
+
+		if (error)
+			*error = SocketError::NoError;
+
+		return true;
+#else
+		NazaraUnused(reusePort);
+
+		// Other platforms either don't support it or don't balance datagrams between sockets
+		if (error)
+			*error = SocketError::NotSupported;
+
+		return false;
+#endif
+	}
+
 	bool SocketImpl::SetSendBufferSize(SocketHandle handle, std::size_t size, SocketError* error)
 	{
 		NazaraAssertMsg(handle != InvalidHandle, "Invalid handle");
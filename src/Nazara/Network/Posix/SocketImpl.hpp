@@ -13,9 +13,16 @@
 
 #define NAZARA_NETWORK_POLL_SUPPORT 1
 
+#ifdef NAZARA_PLATFORM_LINUX
+#define NAZARA_NETWORK_BATCH_SUPPORT 1 // recvmmsg/sendmmsg
+#else
+#define NAZARA_NETWORK_BATCH_SUPPORT 0
+#endif
+
 namespace Nz
 {
 	struct NetBuffer;
+	struct NetDatagram;
 
 	struct PollSocket
 	{
@@ -43,6 +50,8 @@ namespace Nz
 
 			static bool Initialize();
 
+			static bool IsReusePortSupported();
+
 			static SocketError GetLastError(SocketHandle handle, SocketError* error = nullptr);
 			static int GetLastErrorCode(SocketHandle handle, SocketError* error = nullptr);
 
@@ -62,10 +71,16 @@ namespace Nz
 			static SocketState PollConnection(SocketHandle handle, const IpAddress& address, UInt64 msTimeout, SocketError* error);
 
 			static bool Receive(SocketHandle handle, void* buffer, int length, int* read, SocketError* error);
+#if NAZARA_NETWORK_BATCH_SUPPORT
+			static bool ReceiveBatch(SocketHandle handle, NetDatagram* datagrams, std::size_t datagramCount, std::size_t* receivedCount, SocketError* error);
+#endif
 			static bool ReceiveFrom(SocketHandle handle, void* buffer, int length, IpAddress* from, int* read, SocketError* error);
 			static bool ReceiveMultiple(SocketHandle handle, NetBuffer* buffers, std::size_t bufferCount, IpAddress* from, int* read, SocketError* error);
 
 			static bool Send(SocketHandle handle, const void* buffer, int length, int* sent, SocketError* error);
+#if NAZARA_NETWORK_BATCH_SUPPORT
+			static bool SendBatch(SocketHandle handle, NetDatagram* datagrams, std::size_t datagramCount, std::size_t* sentCount, SocketError* error);
+#endif
 			static bool SendMultiple(SocketHandle handle, const NetBuffer* buffers, std::size_t bufferCount, const IpAddress& to, int* sent, SocketError* error);
 			static bool SendTo(SocketHandle handle, const void* buffer, int length, const IpAddress& to, int* sent, SocketError* error);
 
@@ -75,6 +90,7 @@ namespace Nz
 			static bool SetKeepAlive(SocketHandle handle, bool enabled, UInt64 msTime, UInt64 msInterval, SocketError* error = nullptr);
 			static bool SetNoDelay(SocketHandle handle, bool nodelay, SocketError* error = nullptr);
 			static bool SetReceiveBufferSize(SocketHandle handle, std::size_t size, SocketError* error = nullptr);
+			static bool SetReusePort(SocketHandle handle, bool reusePort, SocketError* error = nullptr);
 			static bool SetSendBufferSize(SocketHandle handle, std::size_t size, SocketError* error = nullptr);
 
 			static SocketError TranslateErrorToSocketError(int error);
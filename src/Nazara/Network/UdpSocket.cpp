@@ -5,6 +5,7 @@
 #include <Nazara/Network/UdpSocket.hpp>
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/StringExt.hpp>
+#include <Nazara/Network/NetDatagram.hpp>
 
 #if defined(NAZARA_PLATFORM_WINDOWS)
 #include <Nazara/Network/Win32/SocketImpl.hpp>
@@ -65,6 +66,32 @@ namespace Nz
 		}
 	}
 
+	/*!
+	* \brief Allows multiple sockets to bind the same address and port, incoming datagrams being balanced between them
+	* \return true If the option was applied
+	*
+	* \param reusePort Should the port be shared
+	*
+	* \remark This must be enabled on every socket before binding them
+	* \remark Only supported on Linux (SO_REUSEPORT), fails with SocketError::NotSupported on other platforms
+	* \remark Produces a NazaraAssert if socket is invalid
+	*/
+	bool UdpSocket::EnablePortReuse(bool reusePort)
+	{
+		NazaraAssertMsg(m_handle != SocketImpl::InvalidHandle, "Invalid handle");
+
+		return SocketImpl::SetReusePort(m_handle, reusePort, &m_lastError);
+	}
+
+	/*!
+	* \brief Checks if sockets can share a port (see EnablePortReuse) on this platform
+	* \return true If port reuse is supported
+	*/
+	bool UdpSocket::IsPortReuseSupported()
+	{
+		return SocketImpl::IsReusePortSupported();
+	}
+
 	/*!
 	* \brief Gets the maximum datagram size allowed
 	* \return Number of bytes
@@ -118,6 +145,60 @@ namespace Nz
 		return true;
 	}
 
+	/*!
+	* \brief Receives multiple datagrams, possibly from different peers
+	* \return true If no error occurred
+	*
+	* \param datagrams A pointer to an array of NetDatagram, whose buffers will be filled, address and size will be set for each received datagram
+	* \param datagramCount Maximum number of datagrams to receive
+	* \param receivedCount Optional argument to get the number of datagrams received
+	*
+	* \remark On Linux this is done using a single system call (recvmmsg), other platforms receive datagrams one by one
+	* \remark A blocking socket only waits for the first datagram
+	*/
+	bool UdpSocket::ReceiveBatch(NetDatagram* datagrams, std::size_t datagramCount, std::size_t* receivedCount)
+	{
+		NazaraAssertMsg(m_handle != SocketImpl::InvalidHandle, "Socket hasn't been created");
+		NazaraAssertMsg(datagrams && datagramCount > 0, "Invalid datagrams");
+
+#if NAZARA_NETWORK_BATCH_SUPPORT
+		return SocketImpl::ReceiveBatch(m_handle, datagrams, datagramCount, receivedCount, &m_lastError);
+#else
+		std::size_t datagramIndex = 0;
+		for (; datagramIndex < datagramCount; ++datagramIndex)
+		{
+			NetDatagram& datagram = datagrams[datagramIndex];
+
+			std::size_t received;
+			if (!ReceiveMultiple(datagram.buffers, datagram.bufferCount, &datagram.address, &received))
+			{
+				if (datagramIndex == 0)
+					return false;
+
+				// Report the datagrams we already received, the error will be raised again by the next call
+				break;
+			}
+
+			if (received == 0)
+				break;
+
+			datagram.size = received;
+
+			// Don't wait for more than one datagram
+			if (IsBlockingEnabled())
+			{
+				++datagramIndex;
+				break;
+			}
+		}
+
+		if (receivedCount)
+			*receivedCount = datagramIndex;
+
+		return true;
+#endif
+	}
+
 	/*!
 	* \brief Receive multiple datagram from one peer
 	* \return true If data were sent
@@ -184,6 +265,52 @@ namespace Nz
 		return true;
 	}
 
+	/*!
+	* \brief Sends multiple datagrams, possibly to different peers
+	* \return true If no error occurred
+	*
+	* \param datagrams A pointer to an array of NetDatagram, with their destination address and buffers, size will be set for each sent datagram
+	* \param datagramCount Number of datagrams to send
+	* \param sentCount Optional argument to get the number of datagrams sent, which may be less than datagramCount
+	*
+	* \remark On Linux this is done using a single system call (sendmmsg), other platforms send datagrams one by one
+	* \remark If an error occurs after some datagrams were sent, this returns true and the error will be reported by the next call
+	*/
+	bool UdpSocket::SendBatch(NetDatagram* datagrams, std::size_t datagramCount, std::size_t* sentCount)
+	{
+		NazaraAssertMsg(m_handle != SocketImpl::InvalidHandle, "Socket hasn't been created");
+		NazaraAssertMsg(datagrams && datagramCount > 0, "Invalid datagrams");
+
+#if NAZARA_NETWORK_BATCH_SUPPORT
+		return SocketImpl::SendBatch(m_handle, datagrams, datagramCount, sentCount, &m_lastError);
+#else
+		std::size_t datagramIndex = 0;
+		for (; datagramIndex < datagramCount; ++datagramIndex)
+		{
+			NetDatagram& datagram = datagrams[datagramIndex];
+
+			std::size_t sent;
+			if (!SendMultiple(datagram.address, datagram.buffers, datagram.bufferCount, &sent))
+			{
+				if (datagramIndex == 0)
+					return false;
+
+				break;
+			}
+
+			if (sent == 0)
+				break;
+
+			datagram.size = sent;
+		}
+
+		if (sentCount)
+			*sentCount = datagramIndex;
+
+		return true;
+#endif
+	}
+
 	/*!
 	* \brief Sends multiple buffers as one datagram
 	* \return true If data were sent
@@ -173,6 +173,11 @@ namespace Nz
 		return true;
 	}
 
+	bool SocketImpl::IsReusePortSupported()
+	{
+		return false;
+	}
+
 	SocketError SocketImpl::GetLastError(SocketHandle handle, SocketError* error)
 	{
 		int code = GetLastErrorCode(handle, error);
@@ -942,6 +947,18 @@ namespace Nz
 		return true;
 	}
 
+	bool SocketImpl::SetReusePort(SocketHandle handle, bool reusePort, SocketError* error)
+	{
+		NazaraAssertMsg(handle != InvalidHandle, "Invalid handle");
+		NazaraUnused(reusePort);
+
+		// Windows has no equivalent to SO_REUSEPORT (SO_REUSEADDR doesn't balance datagrams between sockets)
+		if (error)
+			*error = SocketError::NotSupported;
+
+		return false;
+	}
+
 	bool SocketImpl::SetSendBufferSize(SocketHandle handle, std::size_t size, SocketError* error)
 	{
 		NazaraAssertMsg(handle != InvalidHandle, "Invalid handle");
@@ -14,6 +14,7 @@
 #include <WinSock2.h>
 
 #define NAZARA_NETWORK_POLL_SUPPORT NAZARAUTILS_WINDOWS_NT6
+#define NAZARA_NETWORK_BATCH_SUPPORT 0
 
 namespace Nz
 {
@@ -43,6 +44,8 @@ namespace Nz
 
 			static bool Initialize();
 
+			static bool IsReusePortSupported();
+
 			static SocketError GetLastError(SocketHandle handle, SocketError* error = nullptr);
 			static int GetLastErrorCode(SocketHandle handle, SocketError* error = nullptr);
 
@@ -75,6 +78,7 @@ namespace Nz
 			static bool SetKeepAlive(SocketHandle handle, bool enabled, UInt64 msTime, UInt64 msInterval, SocketError* error = nullptr);
 			static bool SetNoDelay(SocketHandle handle, bool nodelay, SocketError* error = nullptr);
 			static bool SetReceiveBufferSize(SocketHandle handle, std::size_t size, SocketError* error = nullptr);
+			static bool SetReusePort(SocketHandle handle, bool reusePort, SocketError* error = nullptr);
 			static bool SetSendBufferSize(SocketHandle handle, std::size_t size, SocketError* error = nullptr);
 
 			static SocketError TranslateWSAErrorToSocketError(int error);
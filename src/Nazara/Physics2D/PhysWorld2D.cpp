@@ -3,9 +3,13 @@
 // For conditions of distribution and use, see copyright notice in Export.hpp
 
 #include <Nazara/Physics2D/PhysWorld2D.hpp>
+#include <Nazara/Core/ParallelAlgorithm.hpp>
 #include <Nazara/Physics2D/PhysArbiter2D.hpp>
 #include <NazaraUtils/StackArray.hpp>
 #include <chipmunk/chipmunk.h>
+#include <chipmunk/chipmunk_private.h>
+#include <chipmunk/cpHastySpace.h>
+#include <functional>
 
 namespace Nz
 {
@@ -78,20 +82,36 @@ namespace Nz
 			else
 				return cpSpaceDebugColor{1.f, 0.f, 0.f, 1.f};
 		}
+
+		// Splits a batch of queries across the task scheduler (if any), returns the sum of what queryRange returned
+		template<typename F>
+		std::size_t RunQueryBatch(TaskScheduler* taskScheduler, std::size_t queryCount, F&& queryRange)
+		{
+			constexpr std::size_t QueryGrainSize = 64;
+
+			if (!taskScheduler || queryCount <= QueryGrainSize)
+				return queryRange(0, queryCount);
+
+			return ParallelReduce(*taskScheduler, 0, queryCount, QueryGrainSize, std::size_t(0), queryRange, std::plus<>{});
+		}
 	}
 
 	PhysWorld2D::PhysWorld2D() :
 	m_maxStepCount(50),
+	m_solverThreadCount(1),
+	m_taskScheduler(nullptr),
 	m_stepSize(Time::TickDuration(120)),
-	m_timestepAccumulator(Time::Zero())
+	m_timestepAccumulator(Time::Zero()),
+	m_usesSpatialHash(false)
 	{
-		m_handle = cpSpaceNew();
+		// A hasty space behaves like a regular space until more than one solver thread is requested
+		m_handle = cpHastySpaceNew();
 		cpSpaceSetUserData(m_handle, this);
 	}
 
 	PhysWorld2D::~PhysWorld2D()
 	{
-		cpSpaceFree(m_handle);
+		cpHastySpaceFree(m_handle);
 	}
 
 	void PhysWorld2D::DebugDraw(const DebugDrawOptions& options, bool drawShapes, bool drawConstraints, bool drawCollisions) const
@@ -156,11 +176,26 @@ namespace Nz
 		return m_maxStepCount;
 	}
 
+	std::size_t PhysWorld2D::GetSolverThreadCount() const
+	{
+		return m_solverThreadCount;
+	}
+
 	Time PhysWorld2D::GetStepSize() const
 	{
 		return m_stepSize;
 	}
 
+	TaskScheduler* PhysWorld2D::GetTaskScheduler() const
+	{
+		return m_taskScheduler;
+	}
+
+	Time PhysWorld2D::GetTimestepAccumulator() const
+	{
+		return m_timestepAccumulator;
+	}
+
 	bool PhysWorld2D::NearestBodyQuery(const Vector2f & from, float maxDistance, UInt32 collisionGroup, UInt32 categoryMask, UInt32 collisionMask, RigidBody2D** nearestBody)
 	{
 		cpShapeFilter filter = cpShapeFilterNew(collisionGroup, categoryMask, collisionMask);
@@ -205,6 +240,39 @@ namespace Nz
 		}
 	}
 
+	std::size_t PhysWorld2D::NearestBodyQueryBatch(std::span<const Vector2f> positions, float maxDistance, UInt32 collisionGroup, UInt32 categoryMask, UInt32 collisionMask, std::span<NearestQueryResult> results) const
+	{
+		NazaraAssertMsg(results.size() >= positions.size(), "result array is too small (%zu results for %zu positions)", results.size(), positions.size());
+
+		cpShapeFilter filter = cpShapeFilterNew(collisionGroup, categoryMask, collisionMask);
+
+		// Nearest point queries don't lock the space, they can run concurrently as long as the spatial index doesn't write while querying
+		return RunQueryBatch((m_usesSpatialHash) ? nullptr : m_taskScheduler, positions.size(), [&](std::size_t begin, std::size_t end)
+		{
+			std::size_t hitCount = 0;
+			for (std::size_t i = begin; i < end; ++i)
+			{
+				const Vector2f& position = positions[i];
+				NearestQueryResult& result = results[i];
+
+				cpPointQueryInfo queryInfo;
+				if (cpSpacePointQueryNearest(m_handle, { position.x, position.y }, maxDistance, filter, &queryInfo))
+				{
+					result.closestPoint = Vector2f(Vector2<cpFloat>(queryInfo.point.x, queryInfo.point.y));
+					result.distance = float(queryInfo.distance);
+					result.fraction = Vector2f(Vector2<cpFloat>(queryInfo.gradient.x, queryInfo.gradient.y));
+					result.nearestBody = static_cast<RigidBody2D*>(cpShapeGetUserData(queryInfo.shape));
+
+					hitCount++;
+				}
+				else
+					result.nearestBody = nullptr;
+			}
+
+			return hitCount;
+		});
+	}
+
 	void PhysWorld2D::RaycastQuery(const Vector2f& from, const Vector2f& to, float radius, UInt32 collisionGroup, UInt32 categoryMask, UInt32 collisionMask, const FunctionRef<void(const RaycastHit&)>& callback)
 	{
 		using CallbackType = std::remove_reference_t<decltype(callback)>;
@@ -280,6 +348,39 @@ namespace Nz
 		}
 	}
 
+	std::size_t PhysWorld2D::RaycastQueryFirstBatch(std::span<const Raycast> raycasts, UInt32 collisionGroup, UInt32 categoryMask, UInt32 collisionMask, std::span<RaycastHit> hits) const
+	{
+		NazaraAssertMsg(hits.size() >= raycasts.size(), "hit array is too small (%zu hits for %zu raycasts)", hits.size(), raycasts.size());
+
+		cpShapeFilter filter = cpShapeFilterNew(collisionGroup, categoryMask, collisionMask);
+
+		// First hit segment queries don't lock the space, they can run concurrently as long as the spatial index doesn't write while querying
+		return RunQueryBatch((m_usesSpatialHash) ? nullptr : m_taskScheduler, raycasts.size(), [&](std::size_t begin, std::size_t end)
+		{
+			std::size_t hitCount = 0;
+			for (std::size_t i = begin; i < end; ++i)
+			{
+				const Raycast& raycast = raycasts[i];
+				RaycastHit& hitInfo = hits[i];
+
+				cpSegmentQueryInfo queryInfo;
+				if (cpSpaceSegmentQueryFirst(m_handle, { raycast.from.x, raycast.from.y }, { raycast.to.x, raycast.to.y }, raycast.radius, filter, &queryInfo))
+				{
+					hitInfo.fraction = float(queryInfo.alpha);
+					hitInfo.hitNormal = Vector2f(Vector2<cpFloat>(queryInfo.normal.x, queryInfo.normal.y));
+					hitInfo.hitPos = Vector2f(Vector2<cpFloat>(queryInfo.point.x, queryInfo.point.y));
+					hitInfo.nearestBody = static_cast<RigidBody2D*>(cpShapeGetUserData(queryInfo.shape));
+
+					hitCount++;
+				}
+				else
+					hitInfo.nearestBody = nullptr;
+			}
+
+			return hitCount;
+		});
+	}
+
 	void PhysWorld2D::RegionQuery(const Rectf& boundingBox, UInt32 collisionGroup, UInt32 categoryMask, UInt32 collisionMask, const FunctionRef<void(RigidBody2D*)>& callback)
 	{
 		using CallbackType = std::remove_reference_t<decltype(callback)>;
@@ -308,6 +409,59 @@ namespace Nz
 		cpSpaceBBQuery(m_handle, cpBBNew(boundingBox.x, boundingBox.y, boundingBox.x + boundingBox.width, boundingBox.y + boundingBox.height), filter, callback, bodies);
 	}
 
+	std::size_t PhysWorld2D::RegionQueryBatch(std::span<const Rectf> boundingBoxes, UInt32 collisionGroup, UInt32 categoryMask, UInt32 collisionMask, std::span<RigidBody2D*> bodies, std::size_t maxBodiesPerQuery, std::span<std::size_t> bodyCounts) const
+	{
+		NazaraAssertMsg(bodies.size() >= boundingBoxes.size() * maxBodiesPerQuery, "body array is too small (%zu bodies for %zu regions of %zu bodies)", bodies.size(), boundingBoxes.size(), maxBodiesPerQuery);
+		NazaraAssertMsg(bodyCounts.size() >= boundingBoxes.size(), "body count array is too small (%zu counts for %zu regions)", bodyCounts.size(), boundingBoxes.size());
+
+		struct QueryContext
+		{
+			cpBB bb;
+			cpShapeFilter filter;
+			RigidBody2D** bodies;
+			std::size_t bodyCount;
+			std::size_t maxBodyCount;
+		};
+
+		// cpSpaceBBQuery locks the space (which isn't thread-safe), query spatial indices directly as it would
+		auto callback = [](void* data, void* object, cpCollisionID id, void* /*userdata*/) -> cpCollisionID
+		{
+			QueryContext& context = *static_cast<QueryContext*>(data);
+			cpShape* shape = static_cast<cpShape*>(object);
+
+			if (context.bodyCount < context.maxBodyCount && !cpShapeFilterReject(shape->filter, context.filter) && cpBBIntersects(context.bb, shape->bb))
+				context.bodies[context.bodyCount++] = static_cast<RigidBody2D*>(cpShapeGetUserData(shape));
+
+			return id;
+		};
+
+		cpShapeFilter filter = cpShapeFilterNew(collisionGroup, categoryMask, collisionMask);
+
+		return RunQueryBatch((m_usesSpatialHash) ? nullptr : m_taskScheduler, boundingBoxes.size(), [&](std::size_t begin, std::size_t end)
+		{
+			std::size_t bodyCount = 0;
+			for (std::size_t i = begin; i < end; ++i)
+			{
+				const Rectf& boundingBox = boundingBoxes[i];
+
+				QueryContext context;
+				context.bb = cpBBNew(boundingBox.x, boundingBox.y, boundingBox.x + boundingBox.width, boundingBox.y + boundingBox.height);
+				context.bodies = bodies.data() + i * maxBodiesPerQuery; //< bodies may be empty if maxBodiesPerQuery is zero
+				context.bodyCount = 0;
+				context.filter = filter;
+				context.maxBodyCount = maxBodiesPerQuery;
+
+				cpSpatialIndexQuery(m_handle->staticShapes, &context, context.bb, callback, nullptr);
+				cpSpatialIndexQuery(m_handle->dynamicShapes, &context, context.bb, callback, nullptr);
+
+				bodyCounts[i] = context.bodyCount;
+				bodyCount += context.bodyCount;
+			}
+
+			return bodyCount;
+		});
+	}
+
 	void PhysWorld2D::RegisterCallbacks(unsigned int collisionId, ContactCallbacks callbacks)
 	{
 		InitCallbacks(cpSpaceAddWildcardHandler(m_handle, collisionId), std::move(callbacks));
@@ -346,11 +500,23 @@ namespace Nz
 			cpSpaceSetSleepTimeThreshold(m_handle, std::numeric_limits<cpFloat>::infinity());
 	}
 
+	void PhysWorld2D::SetSolverThreadCount(std::size_t threadCount)
+	{
+		// 0 lets Chipmunk pick the thread count
+		cpHastySpaceSetThreads(m_handle, SafeCast<unsigned long>(threadCount));
+		m_solverThreadCount = cpHastySpaceGetThreads(m_handle);
+	}
+
 	void PhysWorld2D::SetStepSize(Time stepSize)
 	{
 		m_stepSize = stepSize;
 	}
 
+	void PhysWorld2D::SetTaskScheduler(TaskScheduler* taskScheduler)
+	{
+		m_taskScheduler = taskScheduler;
+	}
+
 	void PhysWorld2D::Step(Time timestep)
 	{
 		m_timestepAccumulator += timestep;
@@ -363,7 +529,10 @@ namespace Nz
 		{
 			OnPhysWorld2DPreStep(this, invStepCount);
 
-			cpSpaceStep(m_handle, dt);
+			if (m_solverThreadCount > 1)
+				cpHastySpaceStep(m_handle, dt);
+			else
+				cpSpaceStep(m_handle, dt);
 
 			OnPhysWorld2DPostStep(this, invStepCount);
 			if (!m_rigidBodyPostSteps.empty())
@@ -387,6 +556,9 @@ namespace Nz
 	void PhysWorld2D::UseSpatialHash(float cellSize, std::size_t entityCount)
 	{
 		cpSpaceUseSpatialHash(m_handle, cpFloat(cellSize), int(entityCount));
+
+		// Spatial hash queries write to the hash, preventing them from running concurrently
+		m_usesSpatialHash = true;
 	}
 
 	void PhysWorld2D::InitCallbacks(cpCollisionHandler* handler, ContactCallbacks callbacks)
@@ -5,6 +5,7 @@
 #include <Nazara/Physics2D/Systems/Physics2DSystem.hpp>
 #include <Nazara/Core/Components/DisabledComponent.hpp>
 #include <Nazara/Core/Components/NodeComponent.hpp>
+#include <algorithm>
 
 namespace Nz
 {
@@ -21,7 +22,9 @@ namespace Nz
 
 	Physics2DSystem::Physics2DSystem(entt::registry& registry) :
 	m_registry(registry),
-	m_physicsObserver(m_registry)
+	m_physicsObserver(m_registry),
+	m_hasStepped(false),
+	m_transformInterpolation(false)
 	{
 		m_bodyConstructConnection = registry.on_construct<RigidBody2DComponent>().connect<&Physics2DSystem::OnBodyConstruct>(this);
 		m_bodyDestructConnection = registry.on_destroy<RigidBody2DComponent>().connect<&Physics2DSystem::OnBodyDestruct>(this);
@@ -46,23 +49,119 @@ namespace Nz
 			rigidBodyComponent.Destroy();
 	}
 
+	/*!
+	* \brief Enables or disables interpolation of replicated transforms
+	*
+	* When enabled, nodes are placed between the poses of their body at the two last physics steps, depending on the time accumulated toward the next step.
+	* This removes jittering when rendering happens at a different rate than physics steps, at the cost of displaying bodies one step late.
+	*
+	* \param enable Whether transforms should be interpolated
+	*/
+	void Physics2DSystem::EnableTransformInterpolation(bool enable)
+	{
+		if (m_transformInterpolation == enable)
+			return;
+
+		m_transformInterpolation = enable;
+		if (enable)
+		{
+			m_onPreStep.Connect(m_physWorld.OnPhysWorld2DPreStep, [this](const PhysWorld2D* /*physWorld*/, float /*invStepCount*/)
+			{
+				CapturePreviousTransforms();
+			});
+		}
+		else
+		{
+			m_onPreStep.Disconnect();
+
+			m_interpolation.capturedBodies.Clear();
+			m_interpolation.interpolatedBodies.Clear();
+			m_interpolation.movingBodies.Clear();
+		}
+	}
+
 	void Physics2DSystem::Update(Time elapsedTime)
 	{
+		m_hasStepped = false;
 		m_physWorld.Step(elapsedTime);
 
+		float interpolation = 1.f;
+		if (m_transformInterpolation)
+		{
+			// Time left in the accumulator tells how far we are between the last step and the next one
+			interpolation = m_physWorld.GetTimestepAccumulator().AsSeconds<float>() / m_physWorld.GetStepSize().AsSeconds<float>();
+			interpolation = std::clamp(interpolation, 0.f, 1.f);
+		}
+
 		// Replicate rigid body position to their node components
 		for (entt::entity entity : m_physicsObserver)
 		{
-			auto& node = m_registry.get<NodeComponent>(entity);
 			auto& rigidBody = m_registry.get<const RigidBody2DComponent>(entity);
 
+			UInt32 bodyIndex = rigidBody.GetBodyIndex();
+			if (m_transformInterpolation && m_interpolation.capturedBodies.UnboundedTest(bodyIndex))
+			{
+				if (m_hasStepped)
+				{
+					Vector2f position = rigidBody.GetPosition();
+					float rotation = rigidBody.GetRotation().value;
+
+					bool hasMoved = m_interpolation.movingBodies.UnboundedTest(bodyIndex);
+					bool isMoving = position != m_interpolation.previousPositions[bodyIndex] || rotation != m_interpolation.previousRotations[bodyIndex];
+
+					// Keep replicating for one more step after the body stopped, so its final pose gets written
+					m_interpolation.interpolatedBodies.UnboundedSet(bodyIndex, isMoving || hasMoved);
+					m_interpolation.movingBodies.UnboundedSet(bodyIndex, isMoving);
+
+					m_interpolation.currentPositions[bodyIndex] = position;
+					m_interpolation.currentRotations[bodyIndex] = rotation;
+				}
+
+				if (!m_interpolation.interpolatedBodies.UnboundedTest(bodyIndex))
+					continue;
+
+				// Body angles aren't wrapped, which makes them safe to interpolate linearly
+				Vector2f position = Vector2f::Lerp(m_interpolation.previousPositions[bodyIndex], m_interpolation.currentPositions[bodyIndex], interpolation);
+				float rotation = Lerp(m_interpolation.previousRotations[bodyIndex], m_interpolation.currentRotations[bodyIndex], interpolation);
+
+				auto& node = m_registry.get<NodeComponent>(entity);
+				node.SetTransform(position, RadianAnglef(rotation));
+				continue;
+			}
+
 			if (rigidBody.IsSleeping())
 				continue;
 
+			auto& node = m_registry.get<NodeComponent>(entity);
 			node.SetTransform(rigidBody.GetPosition(), rigidBody.GetRotation());
 		}
 	}
 
+	void Physics2DSystem::CapturePreviousTransforms()
+	{
+		m_hasStepped = true;
+
+		// Poses before the last step of an update are the starting point of transform interpolation
+		for (entt::entity entity : m_physicsObserver)
+		{
+			auto& rigidBody = m_registry.get<const RigidBody2DComponent>(entity);
+
+			UInt32 bodyIndex = rigidBody.GetBodyIndex();
+			if (bodyIndex >= m_interpolation.previousPositions.size())
+			{
+				std::size_t bodyCount = bodyIndex + 1;
+				m_interpolation.currentPositions.resize(bodyCount);
+				m_interpolation.currentRotations.resize(bodyCount);
+				m_interpolation.previousPositions.resize(bodyCount);
+				m_interpolation.previousRotations.resize(bodyCount);
+			}
+
+			m_interpolation.previousPositions[bodyIndex] = rigidBody.GetPosition();
+			m_interpolation.previousRotations[bodyIndex] = rigidBody.GetRotation().value;
+			m_interpolation.capturedBodies.UnboundedSet(bodyIndex);
+		}
+	}
+
 	PhysWorld2D::ContactCallbacks Physics2DSystem::SetupContactCallbacks(ContactCallbacks callbacks)
 	{
 		PhysWorld2D::ContactCallbacks trampolineCallbacks;
@@ -123,5 +222,9 @@ namespace Nz
 		assert(uniqueIndex <= m_bodyIndicesToEntity.size());
 
 		m_bodyIndicesToEntity[uniqueIndex] = entt::null;
+
+		m_interpolation.capturedBodies.UnboundedReset(uniqueIndex);
+		m_interpolation.interpolatedBodies.UnboundedReset(uniqueIndex);
+		m_interpolation.movingBodies.UnboundedReset(uniqueIndex);
 	}
 }
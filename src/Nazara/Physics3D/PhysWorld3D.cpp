@@ -11,6 +11,8 @@
 #include <NazaraUtils/MemoryPool.hpp>
 #include <NazaraUtils/StackVector.hpp>
 #include <Jolt/Jolt.h>
+#include <Jolt/Core/Color.h>
+#include <Jolt/Core/JobSystem.h>
 #include <Jolt/Core/Profiler.h>
 #include <Jolt/Core/TempAllocator.h>
 #include <Jolt/Physics/PhysicsSettings.h>
@@ -23,9 +25,11 @@
 #include <Jolt/Physics/Collision/CollisionCollectorImpl.h>
 #include <Jolt/Physics/Collision/ObjectLayer.h>
 #include <Jolt/Physics/Collision/RayCast.h>
+#include <Jolt/Physics/Collision/ShapeCast.h>
 #include <Jolt/Physics/Collision/BroadPhase/BroadPhaseLayer.h>
 #include <Jolt/Physics/Collision/Shape/SphereShape.h>
 #include <tsl/ordered_set.h>
+#include <algorithm>
 #include <cassert>
 
 namespace Nz
@@ -237,6 +241,40 @@ namespace Nz
 				Vector3f m_to;
 				bool m_didHit;
 		};
+
+		// Splits a batch of queries in ranges run as jobs on the physics job system, returns the number of hits
+		template<typename F>
+		std::size_t RunQueryBatch(std::size_t queryCount, F&& queryRange)
+		{
+			constexpr std::size_t MinQueriesPerJob = 32;
+
+			JPH::JobSystem& jobSystem = Physics3D::Instance()->GetThreadPool();
+
+			// Don't flood the job system with tiny jobs, a few jobs per worker are enough to balance load
+			std::size_t maxJobCount = std::max(jobSystem.GetMaxConcurrency(), 1) * 4;
+			std::size_t queriesPerJob = std::max(MinQueriesPerJob, (queryCount + maxJobCount - 1) / maxJobCount);
+			if (queryCount <= queriesPerJob)
+				return queryRange(0, queryCount);
+
+			std::atomic_size_t hitCount = 0;
+
+			JPH::JobSystem::Barrier* barrier = jobSystem.CreateBarrier();
+			for (std::size_t begin = 0; begin < queryCount; begin += queriesPerJob)
+			{
+				std::size_t end = std::min(begin + queriesPerJob, queryCount);
+				JPH::JobHandle job = jobSystem.CreateJob("QueryBatch", JPH::Color::sCyan, [&, begin, end]
+				{
+					hitCount += queryRange(begin, end);
+				});
+
+				barrier->AddJob(job);
+			}
+
+			jobSystem.WaitForJobs(barrier);
+			jobSystem.DestroyBarrier(barrier);
+
+			return hitCount;
+		}
 	}
 
 	class PhysWorld3D::BodyActivationListener : public JPH::BodyActivationListener
@@ -552,6 +590,30 @@ namespace Nz
 		return m_world->physicsSystem.GetNumActiveBodies(JPH::EBodyType::RigidBody);
 	}
 
+	void PhysWorld3D::GetActiveBodyTransforms(std::vector<UInt32>& bodyIndices, std::vector<Vector3f>& positions, std::vector<Quaternionf>& rotations) const
+	{
+		// Bodies are read without locking, this must not be called while the world is being stepped
+		JPH::PhysicsSystem& physicsSystem = m_world->physicsSystem;
+
+		UInt32 activeBodyCount = physicsSystem.GetNumActiveBodies(JPH::EBodyType::RigidBody);
+		const JPH::BodyID* activeBodies = physicsSystem.GetActiveBodiesUnsafe(JPH::EBodyType::RigidBody);
+
+		bodyIndices.resize(activeBodyCount);
+		positions.resize(activeBodyCount);
+		rotations.resize(activeBodyCount);
+
+		const JPH::BodyLockInterfaceNoLock& bodyLockInterface = physicsSystem.GetBodyLockInterfaceNoLock();
+		for (UInt32 i = 0; i < activeBodyCount; ++i)
+		{
+			const JPH::Body* body = bodyLockInterface.TryGetBody(activeBodies[i]);
+			assert(body);
+
+			bodyIndices[i] = activeBodies[i].GetIndex();
+			positions[i] = FromJolt(body->GetPosition());
+			rotations[i] = FromJolt(body->GetRotation());
+		}
+	}
+
 	Boxf PhysWorld3D::GetBoundingBox() const
 	{
 		JPH::AABox bounds = m_world->physicsSystem.GetBounds();
@@ -636,6 +698,69 @@ namespace Nz
 		return true;
 	}
 
+	std::size_t PhysWorld3D::RaycastQueryFirstBatch(std::span<const Raycast> raycasts, std::span<RaycastHit> hits, const PhysBroadphaseLayerFilter3D* broadphaseFilter, const PhysObjectLayerFilter3D* objectLayerFilter, const PhysBodyFilter3D* bodyFilter)
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		NazaraAssertMsg(hits.size() >= raycasts.size(), "hit array is too small (%zu hits for %zu raycasts)", hits.size(), raycasts.size());
+
+		// Filters are shared by all queries of the batch, user filters must be thread-safe
+		JPH::BodyFilter defaultBodyFilter;
+		JPH::BroadPhaseLayerFilter defaultBroadphaseFilter;
+		JPH::ObjectLayerFilter defaultObjectFilter;
+
+		BodyFilterBridge bodyFilterBridge(bodyFilter);
+		BroadphaseLayerFilterBridge broadphaseLayerFilterBridge(broadphaseFilter);
+		ObjectLayerFilterBridge objectLayerFilterBridge(objectLayerFilter);
+
+		const JPH::BodyFilter& joltBodyFilter = (bodyFilter) ? bodyFilterBridge : defaultBodyFilter;
+		const JPH::BroadPhaseLayerFilter& joltBroadphaseFilter = (broadphaseFilter) ? broadphaseLayerFilterBridge : defaultBroadphaseFilter;
+		const JPH::ObjectLayerFilter& joltObjectFilter = (objectLayerFilter) ? objectLayerFilterBridge : defaultObjectFilter;
+
+		const JPH::BodyLockInterface& bodyLockInterface = m_world->physicsSystem.GetBodyLockInterface();
+		const JPH::NarrowPhaseQuery& narrowPhaseQuery = m_world->physicsSystem.GetNarrowPhaseQuery();
+
+		return RunQueryBatch(raycasts.size(), [&](std::size_t begin, std::size_t end)
+		{
+			JPH::RayCastSettings rayCastSettings;
+
+			std::size_t hitCount = 0;
+			for (std::size_t i = begin; i < end; ++i)
+			{
+				const Raycast& raycast = raycasts[i];
+
+				RaycastHit& hitInfo = hits[i];
+				hitInfo.hitBody = nullptr;
+
+				JPH::RRayCast rayCast;
+				rayCast.mDirection = ToJolt(raycast.to - raycast.from);
+				rayCast.mOrigin = ToJolt(raycast.from);
+
+				JPH::ClosestHitCollisionCollector<JPH::CastRayCollector> collector;
+				narrowPhaseQuery.CastRay(rayCast, rayCastSettings, collector, joltBroadphaseFilter, joltObjectFilter, joltBodyFilter);
+
+				if (!collector.HadHit())
+					continue;
+
+				JPH::BodyLockRead lock(bodyLockInterface, collector.mHit.mBodyID);
+				if (!lock.Succeeded())
+					continue; //< body was destroyed before lock
+
+				const JPH::Body& body = lock.GetBody();
+
+				hitInfo.fraction = collector.mHit.GetEarlyOutFraction();
+				hitInfo.hitPosition = Lerp(raycast.from, raycast.to, hitInfo.fraction);
+				hitInfo.hitBody = IntegerToPointer<PhysBody3D*>(body.GetUserData());
+				hitInfo.hitNormal = FromJolt(body.GetWorldSpaceSurfaceNormal(collector.mHit.mSubShapeID2, rayCast.GetPointOnRay(hitInfo.fraction)));
+				hitInfo.subShapeID = collector.mHit.mSubShapeID2.GetValue();
+
+				hitCount++;
+			}
+
+			return hitCount;
+		});
+	}
+
 	void PhysWorld3D::RefreshBodies()
 	{
 		// Batch add bodies (keeps the broadphase efficient)
@@ -699,6 +824,71 @@ namespace Nz
 		m_stepSize = stepSize;
 	}
 
+	std::size_t PhysWorld3D::ShapecastQueryFirstBatch(const Collider3D& collider, std::span<const Shapecast> shapecasts, std::span<ShapecastHit> hits, const PhysBroadphaseLayerFilter3D* broadphaseFilter, const PhysObjectLayerFilter3D* objectLayerFilter, const PhysBodyFilter3D* bodyFilter)
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		NazaraAssertMsg(hits.size() >= shapecasts.size(), "hit array is too small (%zu hits for %zu shapecasts)", hits.size(), shapecasts.size());
+
+		// Filters are shared by all queries of the batch, user filters must be thread-safe
+		JPH::BodyFilter defaultBodyFilter;
+		JPH::BroadPhaseLayerFilter defaultBroadphaseFilter;
+		JPH::ObjectLayerFilter defaultObjectFilter;
+
+		BodyFilterBridge bodyFilterBridge(bodyFilter);
+		BroadphaseLayerFilterBridge broadphaseLayerFilterBridge(broadphaseFilter);
+		ObjectLayerFilterBridge objectLayerFilterBridge(objectLayerFilter);
+
+		const JPH::BodyFilter& joltBodyFilter = (bodyFilter) ? bodyFilterBridge : defaultBodyFilter;
+		const JPH::BroadPhaseLayerFilter& joltBroadphaseFilter = (broadphaseFilter) ? broadphaseLayerFilterBridge : defaultBroadphaseFilter;
+		const JPH::ObjectLayerFilter& joltObjectFilter = (objectLayerFilter) ? objectLayerFilterBridge : defaultObjectFilter;
+
+		const JPH::BodyLockInterface& bodyLockInterface = m_world->physicsSystem.GetBodyLockInterface();
+		const JPH::NarrowPhaseQuery& narrowPhaseQuery = m_world->physicsSystem.GetNarrowPhaseQuery();
+
+		// Shape is created once for the whole batch
+		const JPH::Shape* shape = collider.GetShapeSettings()->Create().Get();
+
+		return RunQueryBatch(shapecasts.size(), [&](std::size_t begin, std::size_t end)
+		{
+			JPH::ShapeCastSettings shapeCastSettings;
+
+			std::size_t hitCount = 0;
+			for (std::size_t i = begin; i < end; ++i)
+			{
+				const Shapecast& shapecast = shapecasts[i];
+
+				ShapecastHit& hitInfo = hits[i];
+				hitInfo.hitBody = nullptr;
+
+				JPH::RShapeCast shapeCast = JPH::RShapeCast::sFromWorldTransform(shape, JPH::Vec3::sReplicate(1.f), ToJolt(shapecast.colliderTransform), ToJolt(shapecast.displacement));
+
+				JPH::ClosestHitCollisionCollector<JPH::CastShapeCollector> collector;
+				narrowPhaseQuery.CastShape(shapeCast, shapeCastSettings, JPH::Vec3::sZero(), collector, joltBroadphaseFilter, joltObjectFilter, joltBodyFilter);
+
+				if (!collector.HadHit())
+					continue;
+
+				JPH::BodyLockRead lock(bodyLockInterface, collector.mHit.mBodyID2);
+				if (!lock.Succeeded())
+					continue; //< body was destroyed before lock
+
+				const JPH::Body& body = lock.GetBody();
+
+				hitInfo.fraction = collector.mHit.mFraction;
+				hitInfo.hitBody = IntegerToPointer<PhysBody3D*>(body.GetUserData());
+				hitInfo.hitPosition = FromJolt(collector.mHit.mContactPointOn2);
+				hitInfo.penetrationAxis = FromJolt(collector.mHit.mPenetrationAxis);
+				hitInfo.penetrationDepth = collector.mHit.mPenetrationDepth;
+				hitInfo.subShapeID = collector.mHit.mSubShapeID2.GetValue();
+
+				hitCount++;
+			}
+
+			return hitCount;
+		});
+	}
+
 	bool PhysWorld3D::Step(Time timestep)
 	{
 		m_timestepAccumulator += timestep;
@@ -7,6 +7,7 @@
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/Log.hpp>
 #include <Nazara/Physics3D/Export.hpp>
+#include <Nazara/Physics3D/TaskSchedulerJobSystem.hpp>
 #include <Jolt/Jolt.h>
 #include <Jolt/RegisterTypes.h>
 #include <Jolt/Core/Factory.h>
@@ -30,7 +31,7 @@ static void TraceImpl(const char* inFMT, ...)
 
 namespace Nz
 {
-	Physics3D::Physics3D(Config /*config*/) :
+	Physics3D::Physics3D(Config config) :
 	ModuleBase("Physics3D", this)
 	{
 		JPH::RegisterDefaultAllocator();
@@ -38,12 +39,17 @@ namespace Nz
 		JPH::Factory::sInstance = new JPH::Factory;
 		JPH::RegisterTypes();
 
-		int threadCount = -1; //< system CPU core count
+		if (config.taskScheduler)
+			m_threadPool = std::make_unique<TaskSchedulerJobSystem>(*config.taskScheduler, JPH::cMaxPhysicsJobs, JPH::cMaxPhysicsBarriers);
+		else
+		{
+			int threadCount = -1; //< system CPU core count
 #ifdef NAZARA_PLATFORM_WEB
-		threadCount = 0; // no thread on web for now
+			threadCount = 0; // no thread on web for now
 #endif
 
-		m_threadPool = std::make_unique<JPH::JobSystemThreadPool>(JPH::cMaxPhysicsJobs, JPH::cMaxPhysicsBarriers, threadCount);
+			m_threadPool = std::make_unique<JPH::JobSystemThreadPool>(JPH::cMaxPhysicsJobs, JPH::cMaxPhysicsBarriers, threadCount);
+		}
 	}
 
 	Physics3D::~Physics3D()
@@ -5,15 +5,25 @@
 #include <Nazara/Physics3D/Systems/Physics3DSystem.hpp>
 #include <Nazara/Core/Components/DisabledComponent.hpp>
 #include <Nazara/Core/Components/NodeComponent.hpp>
+#include <Nazara/Core/ParallelAlgorithm.hpp>
 #include <Nazara/Physics3D/PhysBody3D.hpp>
+#include <algorithm>
+#include <tuple>
 
 namespace Nz
 {
+	namespace NAZARA_ANONYMOUS_NAMESPACE
+	{
+		constexpr std::size_t ReplicationGrainSize = 1024;
+	}
+
 	Physics3DSystem::Physics3DSystem(entt::registry& registry, Settings&& settings) :
 	m_registry(registry),
 	m_characterObserver(m_registry),
 	m_rigidBodyObserver(m_registry),
-	m_physWorld(std::move(settings))
+	m_physWorld(std::move(settings)),
+	m_taskScheduler(nullptr),
+	m_transformInterpolation(false)
 	{
 		m_bodyConstructConnection = registry.on_construct<RigidBody3DComponent>().connect<&Physics3DSystem::OnBodyConstruct>(this);
 		m_bodyDestructConnection = registry.on_destroy<RigidBody3DComponent>().connect<&Physics3DSystem::OnBodyDestruct>(this);
@@ -42,6 +52,9 @@ namespace Nz
 
 	Physics3DSystem::~Physics3DSystem()
 	{
+		if (m_transformInterpolation)
+			m_physWorld.UnregisterStepListener(this);
+
 		// Ensure every RigidBody3D is destroyed before world is
 		auto characterView = m_registry.view<PhysCharacter3DComponent>();
 		for (auto [entity, characterComponent] : characterView.each())
@@ -93,6 +106,32 @@ namespace Nz
 		}, broadphaseFilter, objectLayerFilter, bodyFilter);
 	}
 
+	/*!
+	* \brief Enables or disables interpolation of replicated transforms
+	*
+	* When enabled, entities using local or global replication are placed between their poses of the two last physics steps, depending on the time accumulated toward the next step.
+	* This removes jittering when rendering happens at a different rate than physics steps, at the cost of displaying bodies one step late.
+	*
+	* \param enable Whether transforms should be interpolated
+	*/
+	void Physics3DSystem::EnableTransformInterpolation(bool enable)
+	{
+		if (m_transformInterpolation == enable)
+			return;
+
+		m_transformInterpolation = enable;
+		if (enable)
+			m_physWorld.RegisterStepListener(this);
+		else
+		{
+			m_physWorld.UnregisterStepListener(this);
+
+			m_interpolation.capturedBodies.Clear();
+			m_interpolation.interpolatedBodies.Clear();
+			m_interpolation.movingBodies.Clear();
+		}
+	}
+
 	bool Physics3DSystem::RaycastQuery(const Vector3f& from, const Vector3f& to, const FunctionRef<std::optional<float>(const RaycastHit& hitInfo)>& callback, const PhysBroadphaseLayerFilter3D* broadphaseFilter, const PhysObjectLayerFilter3D* objectLayerFilter, const PhysBodyFilter3D* bodyFilter)
 	{
 		return m_physWorld.RaycastQuery(from, to, [&](const PhysWorld3D::RaycastHit& hitInfo)
@@ -129,6 +168,30 @@ namespace Nz
 		}, broadphaseFilter, objectLayerFilter, bodyFilter);
 	}
 
+	std::size_t Physics3DSystem::RaycastQueryFirstBatch(std::span<const Raycast> raycasts, std::span<RaycastHit> hits, const PhysBroadphaseLayerFilter3D* broadphaseFilter, const PhysObjectLayerFilter3D* objectLayerFilter, const PhysBodyFilter3D* bodyFilter)
+	{
+		NazaraAssertMsg(hits.size() >= raycasts.size(), "hit array is too small (%zu hits for %zu raycasts)", hits.size(), raycasts.size());
+
+		m_batchRaycastHits.resize(raycasts.size());
+		std::size_t hitCount = m_physWorld.RaycastQueryFirstBatch(raycasts, m_batchRaycastHits, broadphaseFilter, objectLayerFilter, bodyFilter);
+
+		for (std::size_t i = 0; i < raycasts.size(); ++i)
+		{
+			RaycastHit& extendedHitInfo = hits[i];
+			static_cast<PhysWorld3D::RaycastHit&>(extendedHitInfo) = m_batchRaycastHits[i];
+			extendedHitInfo.hitEntity = {};
+
+			if (extendedHitInfo.hitBody)
+			{
+				std::size_t bodyIndex = extendedHitInfo.hitBody->GetBodyIndex();
+				if (bodyIndex < m_bodyIndicesToEntity.size())
+					extendedHitInfo.hitEntity = entt::handle(m_registry, m_bodyIndicesToEntity[bodyIndex]);
+			}
+		}
+
+		return hitCount;
+	}
+
 	void Physics3DSystem::SetContactListener(std::unique_ptr<ContactListener> contactListener)
 	{
 		class ContactListenerBridge : public PhysWorld3D::ContactListener
@@ -177,14 +240,140 @@ namespace Nz
 		m_physWorld.SetContactListener(std::make_unique<ContactListenerBridge>(*this, std::move(contactListener)));
 	}
 
+	std::size_t Physics3DSystem::ShapecastQueryFirstBatch(const Collider3D& collider, std::span<const Shapecast> shapecasts, std::span<ShapecastHit> hits, const PhysBroadphaseLayerFilter3D* broadphaseFilter, const PhysObjectLayerFilter3D* objectLayerFilter, const PhysBodyFilter3D* bodyFilter)
+	{
+		NazaraAssertMsg(hits.size() >= shapecasts.size(), "hit array is too small (%zu hits for %zu shapecasts)", hits.size(), shapecasts.size());
+
+		m_batchShapecastHits.resize(shapecasts.size());
+		std::size_t hitCount = m_physWorld.ShapecastQueryFirstBatch(collider, shapecasts, m_batchShapecastHits, broadphaseFilter, objectLayerFilter, bodyFilter);
+
+		for (std::size_t i = 0; i < shapecasts.size(); ++i)
+		{
+			ShapecastHit& extendedHitInfo = hits[i];
+			static_cast<PhysWorld3D::ShapecastHit&>(extendedHitInfo) = m_batchShapecastHits[i];
+			extendedHitInfo.hitEntity = {};
+
+			if (extendedHitInfo.hitBody)
+			{
+				std::size_t bodyIndex = extendedHitInfo.hitBody->GetBodyIndex();
+				if (bodyIndex < m_bodyIndicesToEntity.size())
+					extendedHitInfo.hitEntity = entt::handle(m_registry, m_bodyIndicesToEntity[bodyIndex]);
+			}
+		}
+
+		return hitCount;
+	}
+
 	void Physics3DSystem::Update(Time elapsedTime)
 	{
 		// Update the physics world
-		if (!m_physWorld.Step(elapsedTime))
-			return; // No physics step took place
+		if (m_physWorld.Step(elapsedTime))
+			ReplicateEntities();
+
+		if (m_transformInterpolation)
+		{
+			// Time left in the accumulator tells how far we are between the last step and the next one
+			float interpolation = m_physWorld.GetTimestepAccumulator().AsSeconds<float>() / m_physWorld.GetStepSize().AsSeconds<float>();
+			interpolation = std::clamp(interpolation, 0.f, 1.f);
+
+			InterpolateEntities(interpolation);
+		}
+	}
+
+	void Physics3DSystem::ApplyNodeTransforms()
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		auto WriteTransforms = [&](std::size_t begin, std::size_t end)
+		{
+			for (std::size_t i = begin; i < end; ++i)
+				m_replication.nodes[i]->SetTransform(m_replication.nodePositions[i], m_replication.nodeRotations[i], Node::Invalidation::DontInvalidate);
+		};
+
+		// Writing local transforms only touches the node itself, which makes it safe to split across workers
+		std::size_t nodeCount = m_replication.nodes.size();
+		if (m_taskScheduler && nodeCount > ReplicationGrainSize)
+			ParallelFor(*m_taskScheduler, 0, nodeCount, ReplicationGrainSize, WriteTransforms);
+		else
+			WriteTransforms(0, nodeCount);
+
+		// Invalidation signals aren't thread-safe, fire them (along with children invalidation) once all transforms are written
+		for (NodeComponent* nodeComponent : m_replication.nodes)
+			nodeComponent->Invalidate();
+
+		// Global transforms of child nodes depend on their parent, which may have been updated above
+		for (const NodeGlobalTransform& globalTransform : m_replication.globalTransforms)
+			globalTransform.node->SetGlobalTransform(globalTransform.position, globalTransform.rotation);
+	}
+
+	template<typename T>
+	void Physics3DSystem::CapturePreviousTransforms()
+	{
+		auto view = m_registry.view<T>(entt::exclude<DisabledComponent>);
+		for (auto entity : view)
+		{
+			auto& bodyComponent = view.template get<T>(entity);
+
+			PhysicsReplication3D replicationMode = bodyComponent.GetReplicationMode();
+			if (replicationMode != PhysicsReplication3D::Global && replicationMode != PhysicsReplication3D::Local)
+				continue;
+
+			UInt32 bodyIndex = bodyComponent.GetBodyIndex();
+			if (bodyIndex >= m_interpolation.previousPositions.size())
+			{
+				std::size_t bodyCount = bodyIndex + 1;
+				m_interpolation.currentPositions.resize(bodyCount);
+				m_interpolation.currentRotations.resize(bodyCount);
+				m_interpolation.previousPositions.resize(bodyCount);
+				m_interpolation.previousRotations.resize(bodyCount);
+			}
+
+			std::tie(m_interpolation.previousPositions[bodyIndex], m_interpolation.previousRotations[bodyIndex]) = bodyComponent.GetPositionAndRotation();
+			m_interpolation.capturedBodies.UnboundedSet(bodyIndex);
+		}
+	}
+
+	void Physics3DSystem::InterpolateEntities(float interpolation)
+	{
+		m_replication.nodes.clear();
+		m_replication.nodePositions.clear();
+		m_replication.nodeRotations.clear();
+		m_replication.globalTransforms.clear();
+
+		for (std::size_t bodyIndex : m_interpolation.interpolatedBodies.IterBits())
+		{
+			entt::entity entity = m_bodyIndicesToEntity[bodyIndex];
+			if (m_registry.all_of<DisabledComponent>(entity))
+				continue;
+
+			NodeComponent* nodeComponent = m_registry.try_get<NodeComponent>(entity);
+			if (!nodeComponent)
+				continue;
+
+			PhysicsReplication3D replicationMode = PhysicsReplication3D::None;
+			VisitBodyComponent(SafeCast<UInt32>(bodyIndex), [&](auto& bodyComponent)
+			{
+				replicationMode = bodyComponent.GetReplicationMode();
+			});
+
+			// Replication mode may have changed since last step
+			if (replicationMode != PhysicsReplication3D::Global && replicationMode != PhysicsReplication3D::Local)
+				continue;
+
+			Vector3f position = Vector3f::Lerp(m_interpolation.previousPositions[bodyIndex], m_interpolation.currentPositions[bodyIndex], interpolation);
+			Quaternionf rotation = Quaternionf::Slerp(m_interpolation.previousRotations[bodyIndex], m_interpolation.currentRotations[bodyIndex], interpolation);
 
-		ReplicateEntities<PhysCharacter3DComponent>();
-		ReplicateEntities<RigidBody3DComponent>();
+			if (replicationMode == PhysicsReplication3D::Global && nodeComponent->GetParent())
+				m_replication.globalTransforms.push_back({ nodeComponent, rotation, position });
+			else
+			{
+				m_replication.nodes.push_back(nodeComponent);
+				m_replication.nodePositions.push_back(position);
+				m_replication.nodeRotations.push_back(rotation);
+			}
+		}
+
+		ApplyNodeTransforms();
 	}
 
 	void Physics3DSystem::OnBodyConstruct(entt::registry& registry, entt::entity entity)
@@ -195,7 +384,7 @@ namespace Nz
 
 		UInt32 uniqueIndex = rigidBody.GetBodyIndex();
 		if (uniqueIndex >= m_bodyIndicesToEntity.size())
-			m_bodyIndicesToEntity.resize(uniqueIndex + 1);
+			m_bodyIndicesToEntity.resize(uniqueIndex + 1, entt::null);
 
 		m_bodyIndicesToEntity[uniqueIndex] = entity;
 	}
@@ -208,6 +397,10 @@ namespace Nz
 		assert(uniqueIndex <= m_bodyIndicesToEntity.size());
 
 		m_bodyIndicesToEntity[uniqueIndex] = entt::null;
+
+		m_interpolation.capturedBodies.UnboundedReset(uniqueIndex);
+		m_interpolation.interpolatedBodies.UnboundedReset(uniqueIndex);
+		m_interpolation.movingBodies.UnboundedReset(uniqueIndex);
 	}
 
 	void Physics3DSystem::OnCharacterConstruct(entt::registry& registry, entt::entity entity)
@@ -217,7 +410,7 @@ namespace Nz
 
 		UInt32 uniqueIndex = character.GetBodyIndex();
 		if (uniqueIndex >= m_bodyIndicesToEntity.size())
-			m_bodyIndicesToEntity.resize(uniqueIndex + 1);
+			m_bodyIndicesToEntity.resize(uniqueIndex + 1, entt::null);
 
 		m_bodyIndicesToEntity[uniqueIndex] = entity;
 	}
@@ -230,63 +423,174 @@ namespace Nz
 		assert(uniqueIndex <= m_bodyIndicesToEntity.size());
 
 		m_bodyIndicesToEntity[uniqueIndex] = entt::null;
+
+		m_interpolation.capturedBodies.UnboundedReset(uniqueIndex);
+		m_interpolation.interpolatedBodies.UnboundedReset(uniqueIndex);
+		m_interpolation.movingBodies.UnboundedReset(uniqueIndex);
+	}
+
+	void Physics3DSystem::PreSimulate(float /*elapsedTime*/)
+	{
+		// Poses before the last step of an update are the starting point of transform interpolation
+		CapturePreviousTransforms<PhysCharacter3DComponent>();
+		CapturePreviousTransforms<RigidBody3DComponent>();
 	}
 
-	template<typename T>
 	void Physics3DSystem::ReplicateEntities()
 	{
-		auto view = m_registry.view<NodeComponent, T>(entt::exclude<DisabledComponent>);
-		for (auto entity : view)
+		m_physWorld.GetActiveBodyTransforms(m_replication.bodyIndices, m_replication.bodyPositions, m_replication.bodyRotations);
+
+		m_replication.customReplicationBodies.clear();
+		m_replication.globalTransforms.clear();
+		m_replication.nodes.clear();
+		m_replication.nodePositions.clear();
+		m_replication.nodeRotations.clear();
+
+		if (m_transformInterpolation)
+			m_interpolation.updatedBodies.Clear();
+
+		for (std::size_t i = 0; i < m_replication.bodyIndices.size(); ++i)
 		{
-			auto& bodyComponent = view.template get<T>(entity);
-			if (bodyComponent.GetReplicationMode() == PhysicsReplication3D::None || !m_physWorld.IsBodyActive(bodyComponent.GetBodyIndex()))
+			UInt32 bodyIndex = m_replication.bodyIndices[i];
+			if (bodyIndex >= m_bodyIndicesToEntity.size())
 				continue;
 
-			auto& nodeComponent = view.template get<NodeComponent>(entity);
-			auto [position, rotation] = bodyComponent.GetPositionAndRotation();
+			entt::entity entity = m_bodyIndicesToEntity[bodyIndex];
+			if (entity == entt::null || m_registry.all_of<DisabledComponent>(entity))
+				continue;
 
-			switch (bodyComponent.GetReplicationMode())
+			NodeComponent* nodeComponent = m_registry.try_get<NodeComponent>(entity);
+			if (!nodeComponent)
+				continue;
+
+			VisitBodyComponent(bodyIndex, [&](auto& bodyComponent)
+			{
+				ReplicateEntity(bodyComponent, *nodeComponent, m_replication.bodyPositions[i], m_replication.bodyRotations[i]);
+			});
+		}
+
+		if (m_transformInterpolation)
+		{
+			// Bodies which went to sleep during the step aren't active anymore but their last pose still has to be stored
+			for (std::size_t bodyIndex : m_interpolation.interpolatedBodies.IterBits())
 			{
-				case PhysicsReplication3D::Custom:
-				case PhysicsReplication3D::CustomOnce:
+				if (m_interpolation.updatedBodies.UnboundedTest(bodyIndex))
+					continue;
+
+				VisitBodyComponent(SafeCast<UInt32>(bodyIndex), [&](auto& bodyComponent)
 				{
-					const auto& replicationCallback = bodyComponent.GetReplicationCallback();
-					if NAZARA_LIKELY(replicationCallback)
-						replicationCallback(entt::handle(m_registry, entity), bodyComponent);
-					else
-						NazaraError("physics component has custom replication mode but no callback");
+					auto [position, rotation] = bodyComponent.GetPositionAndRotation();
+					StoreInterpolatedTransform(SafeCast<UInt32>(bodyIndex), position, rotation);
+				});
+			}
+		}
 
-					if (bodyComponent.GetReplicationMode() == PhysicsReplication3D::CustomOnce)
-						bodyComponent.SetReplicationMode(PhysicsReplication3D::None);
+		ApplyNodeTransforms();
 
-					break;
-				}
+		// Custom replication callbacks come last, so they can rely on up-to-date nodes
+		for (UInt32 bodyIndex : m_replication.customReplicationBodies)
+		{
+			// A previous callback may have destroyed the entity
+			entt::entity entity = m_bodyIndicesToEntity[bodyIndex];
+			if (entity == entt::null)
+				continue;
 
-				case PhysicsReplication3D::Global:
-				case PhysicsReplication3D::GlobalOnce:
-				{
-					nodeComponent.SetGlobalTransform(position, rotation);
-					if (bodyComponent.GetReplicationMode() == PhysicsReplication3D::GlobalOnce)
-						bodyComponent.SetReplicationMode(PhysicsReplication3D::None);
+			VisitBodyComponent(bodyIndex, [&](auto& bodyComponent)
+			{
+				const auto& replicationCallback = bodyComponent.GetReplicationCallback();
+				if NAZARA_LIKELY(replicationCallback)
+					replicationCallback(entt::handle(m_registry, entity), bodyComponent);
+				else
+					NazaraError("physics component has custom replication mode but no callback");
+
+				if (bodyComponent.GetReplicationMode() == PhysicsReplication3D::CustomOnce)
+					bodyComponent.SetReplicationMode(PhysicsReplication3D::None);
+			});
+		}
+	}
 
+	template<typename T>
+	void Physics3DSystem::ReplicateEntity(T& bodyComponent, NodeComponent& nodeComponent, const Vector3f& position, const Quaternionf& rotation)
+	{
+		UInt32 bodyIndex = bodyComponent.GetBodyIndex();
+
+		PhysicsReplication3D replicationMode = bodyComponent.GetReplicationMode();
+		switch (replicationMode)
+		{
+			case PhysicsReplication3D::Custom:
+			case PhysicsReplication3D::CustomOnce:
+				m_replication.customReplicationBodies.push_back(bodyIndex);
+				break;
+
+			case PhysicsReplication3D::Global:
+			case PhysicsReplication3D::GlobalOnce:
+			case PhysicsReplication3D::Local:
+			case PhysicsReplication3D::LocalOnce:
+			{
+				bool isGlobal = (replicationMode == PhysicsReplication3D::Global || replicationMode == PhysicsReplication3D::GlobalOnce);
+				bool isOnce = (replicationMode == PhysicsReplication3D::GlobalOnce || replicationMode == PhysicsReplication3D::LocalOnce);
+
+				if (m_transformInterpolation && !isOnce && m_interpolation.capturedBodies.UnboundedTest(bodyIndex))
+				{
+					// Nodes are updated by InterpolateEntities
+					StoreInterpolatedTransform(bodyIndex, position, rotation);
 					break;
 				}
 
-				case PhysicsReplication3D::Local:
-				case PhysicsReplication3D::LocalOnce:
+				if (isGlobal && nodeComponent.GetParent())
+					m_replication.globalTransforms.push_back({ &nodeComponent, rotation, position });
+				else
 				{
-					nodeComponent.SetTransform(position, rotation);
-					if (bodyComponent.GetReplicationMode() == PhysicsReplication3D::LocalOnce)
-						bodyComponent.SetReplicationMode(PhysicsReplication3D::None);
-
-					break;
+					m_replication.nodes.push_back(&nodeComponent);
+					m_replication.nodePositions.push_back(position);
+					m_replication.nodeRotations.push_back(rotation);
 				}
 
-				case PhysicsReplication3D::None:
-					NAZARA_UNREACHABLE();
+				if (isOnce)
+					bodyComponent.SetReplicationMode(PhysicsReplication3D::None);
+
+				break;
 			}
+
+			case PhysicsReplication3D::None:
+				break;
 		}
 	}
 
+	void Physics3DSystem::StoreInterpolatedTransform(UInt32 bodyIndex, const Vector3f& position, const Quaternionf& rotation)
+	{
+		bool hasMoved = m_interpolation.movingBodies.UnboundedTest(bodyIndex);
+		bool isMoving = position != m_interpolation.previousPositions[bodyIndex] || rotation != m_interpolation.previousRotations[bodyIndex];
+
+		// Keep replicating for one more step after the body stopped, so its final pose gets written
+		m_interpolation.interpolatedBodies.UnboundedSet(bodyIndex, isMoving || hasMoved);
+		m_interpolation.movingBodies.UnboundedSet(bodyIndex, isMoving);
+		m_interpolation.updatedBodies.UnboundedSet(bodyIndex);
+
+		m_interpolation.currentPositions[bodyIndex] = position;
+		m_interpolation.currentRotations[bodyIndex] = rotation;
+	}
+
+	template<typename F>
+	bool Physics3DSystem::VisitBodyComponent(UInt32 bodyIndex, F&& func)
+	{
+		entt::entity entity = m_bodyIndicesToEntity[bodyIndex];
+
+		// An entity may own both a rigid body and a character, pick the one owning this body
+		if (RigidBody3DComponent* rigidBody = m_registry.try_get<RigidBody3DComponent>(entity); rigidBody && rigidBody->GetBodyIndex() == bodyIndex)
+		{
+			func(*rigidBody);
+			return true;
+		}
+
+		if (PhysCharacter3DComponent* character = m_registry.try_get<PhysCharacter3DComponent>(entity); character && character->GetBodyIndex() == bodyIndex)
+		{
+			func(*character);
+			return true;
+		}
+
+		return false;
+	}
+
 	Physics3DSystem::ContactListener::~ContactListener() = default;
 }
@@ -0,0 +1,86 @@
+// Copyright (C) 2026 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Physics3D module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#include <Nazara/Physics3D/TaskSchedulerJobSystem.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <NazaraUtils/Algorithm.hpp>
+#include <thread>
+
+namespace Nz
+{
+	TaskSchedulerJobSystem::TaskSchedulerJobSystem(TaskScheduler& taskScheduler, JPH::uint maxJobs, JPH::uint maxBarriers) :
+	JobSystemWithBarrier(maxBarriers),
+	m_pendingTaskCount(0),
+	m_taskScheduler(taskScheduler)
+	{
+		m_jobs.Init(maxJobs, maxJobs);
+	}
+
+	TaskSchedulerJobSystem::~TaskSchedulerJobSystem()
+	{
+		// Barriers can run jobs inline and return before the tasks queued for them ran, wait for them as they release jobs from our free list
+		while (m_pendingTaskCount.load(std::memory_order_acquire) > 0)
+		{
+			if (!m_taskScheduler.TryRunTask())
+				std::this_thread::yield();
+		}
+	}
+
+	auto TaskSchedulerJobSystem::CreateJob(const char* jobName, JPH::ColorArg color, const JobFunction& jobFunction, JPH::uint32 dependencyCount) -> JobHandle
+	{
+		JPH::uint32 jobIndex;
+		for (;;)
+		{
+			jobIndex = m_jobs.ConstructObject(jobName, color, this, jobFunction, dependencyCount);
+			if (jobIndex != JPH::FixedSizeFreeList<Job>::cInvalidObjectIndex)
+				break;
+
+			// All jobs are in use (this shouldn't happen with the default job count), help running pending jobs so they free their slot
+			if (!m_taskScheduler.TryRunTask())
+				std::this_thread::yield();
+		}
+
+		Job* job = &m_jobs.Get(jobIndex);
+
+		// Keep a reference to the job before queuing it as it could be freed while we return
+		JobHandle jobHandle(job);
+
+		if (dependencyCount == 0)
+			QueueJob(job);
+
+		return jobHandle;
+	}
+
+	int TaskSchedulerJobSystem::GetMaxConcurrency() const
+	{
+		// Threads waiting on a barrier also run its jobs
+		return SafeCast<int>(m_taskScheduler.GetWorkerCount() + 1);
+	}
+
+	void TaskSchedulerJobSystem::FreeJob(Job* job)
+	{
+		m_jobs.DestructObject(job);
+	}
+
+	void TaskSchedulerJobSystem::QueueJob(Job* job)
+	{
+		// Jobs are reference counted, keep it alive until it has been executed (Execute does nothing if a barrier already ran it)
+		job->AddRef();
+		m_pendingTaskCount.fetch_add(1, std::memory_order_relaxed);
+		m_taskScheduler.AddTask([this, job]
+		{
+			job->Execute();
+			job->Release();
+
+			// Last access to this job system, it may be destroyed right after
+			m_pendingTaskCount.fetch_sub(1, std::memory_order_release);
+		});
+	}
+
+	void TaskSchedulerJobSystem::QueueJobs(Job** jobs, JPH::uint jobCount)
+	{
+		for (JPH::uint i = 0; i < jobCount; ++i)
+			QueueJob(jobs[i]);
+	}
+}
@@ -0,0 +1,48 @@
+// Copyright (C) 2026 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Physics3D module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#pragma once
+
+#ifndef NAZARA_PHYSICS3D_TASKSCHEDULERJOBSYSTEM_HPP
+#define NAZARA_PHYSICS3D_TASKSCHEDULERJOBSYSTEM_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <Jolt/Jolt.h>
+#include <Jolt/Core/FixedSizeFreeList.h>
+#include <Jolt/Core/JobSystemWithBarrier.h>
+#include <atomic>
+
+namespace Nz
+{
+	class TaskScheduler;
+
+	// Jolt job system running jobs on a TaskScheduler instead of its own threads
+	class TaskSchedulerJobSystem final : public JPH::JobSystemWithBarrier
+	{
+		public:
+			TaskSchedulerJobSystem(TaskScheduler& taskScheduler, JPH::uint maxJobs, JPH::uint maxBarriers);
+			TaskSchedulerJobSystem(const TaskSchedulerJobSystem&) = delete;
+			TaskSchedulerJobSystem(TaskSchedulerJobSystem&&) = delete;
+			~TaskSchedulerJobSystem();
+
+			JobHandle CreateJob(const char* jobName, JPH::ColorArg color, const JobFunction& jobFunction, JPH::uint32 dependencyCount = 0) override;
+
+			int GetMaxConcurrency() const override;
+
+			TaskSchedulerJobSystem& operator=(const TaskSchedulerJobSystem&) = delete;
+			TaskSchedulerJobSystem& operator=(TaskSchedulerJobSystem&&) = delete;
+
+		protected:
+			void FreeJob(Job* job) override;
+			void QueueJob(Job* job) override;
+			void QueueJobs(Job** jobs, JPH::uint jobCount) override;
+
+		private:
+			std::atomic_uint32_t m_pendingTaskCount; //< queued tasks which may still reference a job
+			JPH::FixedSizeFreeList<Job> m_jobs;
+			TaskScheduler& m_taskScheduler;
+	};
+}
+
+#endif // NAZARA_PHYSICS3D_TASKSCHEDULERJOBSYSTEM_HPP
@@ -0,0 +1,140 @@
+#include <Nazara/Core/Clock.hpp>
+#include <Nazara/Core/Modules.hpp>
+#include <Nazara/Network/ENetHost.hpp>
+#include <Nazara/Network/ENetPeer.hpp>
+#include <Nazara/Network/Network.hpp>
+#include <cstdlib>
+#include <iostream>
+
+constexpr std::size_t packetCount = 200'000;
+constexpr std::size_t packetSize = 64;
+constexpr std::size_t burstSize = 256;
+constexpr Nz::Time timeLimit = Nz::Time::Seconds(30);
+
+struct Stats
+{
+	std::size_t receivedPackets = 0;
+	std::size_t sentPackets = 0;
+	Nz::Time duration;
+};
+
+void ServiceAll(Nz::ENetHost& server, Nz::ENetHost& client, std::size_t* serverReceivedPackets)
+{
+	Nz::ENetEvent event;
+	while (client.Service(&event, 0) > 0);
+
+	while (server.Service(&event, 0) > 0)
+	{
+		if (event.type == Nz::ENetEventType::Receive && serverReceivedPackets)
+			(*serverReceivedPackets)++;
+	}
+}
+
+Stats RunThroughput(Nz::ENetHost& server, Nz::ENetHost& client, Nz::ENetPeer& peer, Nz::UInt8 channelId, Nz::ENetPacketFlags flags)
+{
+	Stats stats;
+
+	Nz::Time start = Nz::GetElapsedNanoseconds();
+	Nz::Time lastReceive = start;
+	for (;;)
+	{
+		Nz::Time now = Nz::GetElapsedNanoseconds();
+		if (now - start > timeLimit)
+			break;
+
+		if (stats.sentPackets < packetCount)
+		{
+			for (std::size_t i = 0; i < burstSize && stats.sentPackets < packetCount; ++i)
+			{
+				if (!peer.Send(channelId, flags, Nz::ByteArray(packetSize, Nz::UInt8(stats.sentPackets))))
+				{
+					std::cerr << "failed to send packet" << std::endl;
+					std::exit(EXIT_FAILURE);
+				}
+
+				stats.sentPackets++;
+			}
+		}
+
+		std::size_t receivedPackets = stats.receivedPackets;
+		ServiceAll(server, client, &stats.receivedPackets);
+		if (receivedPackets != stats.receivedPackets)
+			lastReceive = now;
+
+		if (stats.receivedPackets >= packetCount)
+			break;
+
+		// Unreliable packets may be dropped by the throttle, stop once nothing comes in anymore
+		if (stats.sentPackets >= packetCount && now - lastReceive > Nz::Time::Milliseconds(500))
+			break;
+	}
+
+	stats.duration = Nz::GetElapsedNanoseconds() - start;
+	return stats;
+}
+
+void PrintStats(const char* name, const Stats& stats)
+{
+	double seconds = stats.duration.AsSeconds<double>();
+	std::cout << name << ": " << stats.receivedPackets << "/" << stats.sentPackets << " packets in " << stats.duration;
+	std::cout << " (" << static_cast<Nz::UInt64>(stats.receivedPackets / seconds) << " packets/s, " << (stats.receivedPackets * packetSize) / (seconds * 1024.0 * 1024.0) << " MiB/s)" << std::endl;
+}
+
+int main()
+{
+	Nz::Modules<Nz::Network> nazara;
+
+	Nz::ENetHost server;
+	if (!server.Create(Nz::NetProtocol::IPv4, 0, 1, 2))
+	{
+		std::cerr << "failed to create server host" << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	Nz::IpAddress serverAddress = Nz::IpAddress::LoopbackIpV4;
+	serverAddress.SetPort(server.GetBoundAddress().GetPort());
+
+	Nz::ENetHost client;
+	if (!client.Create(Nz::IpAddress::LoopbackIpV4, 1, 2))
+	{
+		std::cerr << "failed to create client host" << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	Nz::ENetPeer* peer = client.Connect(serverAddress, 2);
+	if (!peer)
+	{
+		std::cerr << "failed to connect to server" << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	Nz::Time connectStart = Nz::GetElapsedNanoseconds();
+	while (peer->GetState() != Nz::ENetPeerState::Connected)
+	{
+		if (Nz::GetElapsedNanoseconds() - connectStart > Nz::Time::Seconds(5))
+		{
+			std::cerr << "connection timed out" << std::endl;
+			return EXIT_FAILURE;
+		}
+
+		ServiceAll(server, client, nullptr);
+	}
+
+	std::cout << "sending " << packetCount << " packets of " << packetSize << " bytes over loopback" << std::endl;
+
+	Stats reliableStats = RunThroughput(server, client, *peer, 0, Nz::ENetPacketFlag::Reliable);
+	PrintStats("reliable", reliableStats);
+
+	Stats unreliableStats = RunThroughput(server, client, *peer, 1, Nz::ENetPacketFlag_Unreliable);
+	PrintStats("unreliable", unreliableStats);
+
+	peer->DisconnectNow(0);
+
+	if (reliableStats.receivedPackets != packetCount)
+	{
+		std::cerr << "some reliable packets were not received" << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,3 @@
+target("ENetHostBenchmark")
+	add_deps("NazaraNetwork")
+	add_files("main.cpp")
@@ -0,0 +1,144 @@
+#include <Nazara/Core/Clock.hpp>
+#include <Nazara/Core/Modules.hpp>
+#include <Nazara/Network/ENetHost.hpp>
+#include <Nazara/Network/ENetPeer.hpp>
+#include <Nazara/Network/Network.hpp>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+constexpr std::size_t connectedPeerCount = 50;
+constexpr std::size_t packetSize = 32;
+constexpr Nz::Time sendInterval = Nz::Time::Milliseconds(16);
+constexpr Nz::Time testDuration = Nz::Time::Seconds(5);
+
+struct Stats
+{
+	std::size_t receivedPackets = 0;
+	std::size_t serviceCalls = 0;
+	Nz::Time serviceDuration = Nz::Time::Zero();
+};
+
+// Services the server a single time, timing only the server side
+void ServiceAll(Nz::ENetHost& server, Nz::ENetHost& client, Stats* stats)
+{
+	Nz::ENetEvent event;
+	while (client.Service(&event, 0) > 0);
+
+	Nz::Time start = Nz::GetElapsedNanoseconds();
+	while (server.Service(&event, 0) > 0)
+	{
+		if (event.type == Nz::ENetEventType::Receive && stats)
+			stats->receivedPackets++;
+	}
+
+	if (stats)
+	{
+		stats->serviceDuration += Nz::GetElapsedNanoseconds() - start;
+		stats->serviceCalls++;
+	}
+}
+
+bool RunBenchmark(std::size_t peerSlotCount)
+{
+	Nz::ENetHost server;
+	if (!server.Create(Nz::NetProtocol::IPv4, 0, peerSlotCount, 1))
+	{
+		std::cerr << "failed to create server host" << std::endl;
+		return false;
+	}
+
+	Nz::IpAddress serverAddress = Nz::IpAddress::LoopbackIpV4;
+	serverAddress.SetPort(server.GetBoundAddress().GetPort());
+
+	Nz::ENetHost client;
+	if (!client.Create(Nz::IpAddress::LoopbackIpV4, connectedPeerCount, 1))
+	{
+		std::cerr << "failed to create client host" << std::endl;
+		return false;
+	}
+
+	std::vector<Nz::ENetPeer*> peers;
+	for (std::size_t i = 0; i < connectedPeerCount; ++i)
+	{
+		Nz::ENetPeer* peer = client.Connect(serverAddress, 1);
+		if (!peer)
+		{
+			std::cerr << "failed to connect to server" << std::endl;
+			return false;
+		}
+
+		peers.push_back(peer);
+	}
+
+	Nz::Time connectStart = Nz::GetElapsedNanoseconds();
+	for (;;)
+	{
+		std::size_t connectedPeers = 0;
+		for (Nz::ENetPeer* peer : peers)
+		{
+			if (peer->GetState() == Nz::ENetPeerState::Connected)
+				connectedPeers++;
+		}
+
+		if (connectedPeers == connectedPeerCount)
+			break;
+
+		if (Nz::GetElapsedNanoseconds() - connectStart > Nz::Time::Seconds(5))
+		{
+			std::cerr << "connection timed out" << std::endl;
+			return false;
+		}
+
+		ServiceAll(server, client, nullptr);
+	}
+
+	Stats stats;
+	std::size_t sentPackets = 0;
+
+	Nz::Time start = Nz::GetElapsedNanoseconds();
+	Nz::Time nextSend = start;
+	for (;;)
+	{
+		Nz::Time now = Nz::GetElapsedNanoseconds();
+		if (now - start > testDuration)
+			break;
+
+		if (now >= nextSend)
+		{
+			for (Nz::ENetPeer* peer : peers)
+			{
+				peer->Send(0, Nz::ENetPacketFlag::Reliable, Nz::ByteArray(packetSize, Nz::UInt8(sentPackets)));
+				sentPackets++;
+			}
+
+			nextSend += sendInterval;
+		}
+
+		ServiceAll(server, client, &stats);
+	}
+
+	for (Nz::ENetPeer* peer : peers)
+		peer->DisconnectNow(0);
+
+	double averageServiceTime = stats.serviceDuration.AsSeconds<double>() * 1'000'000.0 / stats.serviceCalls;
+	std::cout << peerSlotCount << " peer slots: " << stats.serviceCalls << " server services, " << averageServiceTime << "us per service, " << stats.receivedPackets << "/" << sentPackets << " packets received" << std::endl;
+
+	return true;
+}
+
+int main()
+{
+	Nz::Modules<Nz::Network> nazara;
+
+	std::cout << connectedPeerCount << " peers sending a " << packetSize << " bytes reliable packet every " << sendInterval << " over loopback" << std::endl;
+
+	// Service cost should only depend on the connected peers, not on the peer slots count (4095 is the protocol limit)
+	for (std::size_t peerSlotCount : { connectedPeerCount, std::size_t(Nz::ENetProtocol_MaximumPeerId) })
+	{
+		if (!RunBenchmark(peerSlotCount))
+			return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,3 @@
+target("ENetHostServiceBenchmark")
+	add_deps("NazaraNetwork")
+	add_files("main.cpp")
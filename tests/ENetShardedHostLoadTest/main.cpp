@@ -0,0 +1,203 @@
+#include <Nazara/Core/Clock.hpp>
+#include <Nazara/Core/Modules.hpp>
+#include <Nazara/Network/ENetHost.hpp>
+#include <Nazara/Network/ENetPeer.hpp>
+#include <Nazara/Network/ENetShardedHost.hpp>
+#include <Nazara/Network/Network.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+constexpr std::size_t peerCount = 5'000;
+constexpr std::size_t peerCountPerClient = 100; //< each client host has its own socket, which lets the kernel spread them over the shards
+constexpr std::size_t packetSize = 32;
+constexpr Nz::Time connectTimeLimit = Nz::Time::Seconds(10);
+constexpr Nz::Time sendInterval = Nz::Time::Milliseconds(50);
+constexpr Nz::Time testDuration = Nz::Time::Seconds(10);
+
+struct Client
+{
+	Nz::ENetHost host;
+	std::vector<Nz::ENetPeer*> peers;
+	Nz::Time nextSend = Nz::Time::Zero();
+};
+
+struct Stats
+{
+	std::size_t connectedPeers = 0;
+	std::size_t echoedPackets = 0;
+	std::size_t receivedPackets = 0;
+	Nz::Time duration;
+};
+
+void RunClients(std::vector<std::unique_ptr<Client>>& clients, std::size_t firstClient, std::size_t lastClient, const std::atomic_bool& running, const std::atomic_bool& sending, std::atomic_size_t& echoedPackets)
+{
+	Nz::ENetEvent event;
+	while (running.load(std::memory_order_relaxed))
+	{
+		Nz::Time now = Nz::GetElapsedNanoseconds();
+		for (std::size_t i = firstClient; i < lastClient; ++i)
+		{
+			Client& client = *clients[i];
+			if (sending.load(std::memory_order_relaxed) && now >= client.nextSend)
+			{
+				for (Nz::ENetPeer* peer : client.peers)
+				{
+					if (peer->GetState() == Nz::ENetPeerState::Connected)
+						peer->Send(0, Nz::ENetPacketFlag::Reliable, Nz::ByteArray(packetSize, Nz::UInt8(i)));
+				}
+
+				client.nextSend = now + sendInterval;
+			}
+
+			while (client.host.Service(&event, 0) > 0)
+			{
+				if (event.type == Nz::ENetEventType::Receive)
+					echoedPackets.fetch_add(1, std::memory_order_relaxed);
+			}
+		}
+
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+}
+
+Stats RunLoadTest(std::size_t shardCount)
+{
+	Stats stats;
+
+	Nz::ENetShardedHost server;
+	if (!server.Create(Nz::IpAddress::AnyIpV4, shardCount, Nz::ENetProtocol_MaximumPeerId, 1))
+	{
+		std::cerr << "failed to create server host" << std::endl;
+		std::exit(EXIT_FAILURE);
+	}
+
+	if (server.GetShardCount() != shardCount)
+		std::cout << "port sharing is not supported, running with " << server.GetShardCount() << " shard(s)" << std::endl;
+
+	Nz::IpAddress serverAddress = Nz::IpAddress::LoopbackIpV4;
+	serverAddress.SetPort(server.GetBoundAddress().GetPort());
+
+	std::vector<std::unique_ptr<Client>> clients;
+	for (std::size_t i = 0; i < peerCount; i += peerCountPerClient)
+	{
+		std::size_t clientPeerCount = std::min(peerCountPerClient, peerCount - i);
+
+		auto client = std::make_unique<Client>();
+		if (!client->host.Create(Nz::IpAddress::LoopbackIpV4, clientPeerCount, 1))
+		{
+			std::cerr << "failed to create client host" << std::endl;
+			std::exit(EXIT_FAILURE);
+		}
+
+		for (std::size_t j = 0; j < clientPeerCount; ++j)
+		{
+			if (Nz::ENetPeer* peer = client->host.Connect(serverAddress, 1))
+				client->peers.push_back(peer);
+		}
+
+		clients.push_back(std::move(client));
+	}
+
+	std::atomic_bool running = true;
+	std::atomic_bool sending = false;
+	std::atomic_size_t echoedPackets = 0;
+
+	std::size_t clientThreadCount = std::clamp<std::size_t>(std::thread::hardware_concurrency() / 2, 1, clients.size());
+	std::vector<std::thread> clientThreads;
+	for (std::size_t i = 0; i < clientThreadCount; ++i)
+	{
+		std::size_t firstClient = i * clients.size() / clientThreadCount;
+		std::size_t lastClient = (i + 1) * clients.size() / clientThreadCount;
+		clientThreads.emplace_back([&, firstClient, lastClient]
+		{
+			RunClients(clients, firstClient, lastClient, running, sending, echoedPackets);
+		});
+	}
+
+	auto PollServer = [&]
+	{
+		Nz::ENetShardedHost::Event event;
+		while (server.PollEvent(&event))
+		{
+			switch (event.type)
+			{
+				case Nz::ENetEventType::IncomingConnect:
+					stats.connectedPeers++;
+					break;
+
+				case Nz::ENetEventType::Disconnect:
+				case Nz::ENetEventType::DisconnectTimeout:
+					stats.connectedPeers--;
+					break;
+
+				case Nz::ENetEventType::Receive:
+					stats.receivedPackets++;
+					server.Send(event.peerId, event.channelId, Nz::ENetPacketFlag::Reliable, std::move(event.data));
+					break;
+
+				default:
+					break;
+			}
+		}
+	};
+
+	Nz::Time connectStart = Nz::GetElapsedNanoseconds();
+	while (stats.connectedPeers < peerCount && Nz::GetElapsedNanoseconds() - connectStart < connectTimeLimit)
+	{
+		PollServer();
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+
+	sending = true;
+
+	Nz::Time start = Nz::GetElapsedNanoseconds();
+	while (Nz::GetElapsedNanoseconds() - start < testDuration)
+	{
+		PollServer();
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+
+	stats.duration = Nz::GetElapsedNanoseconds() - start;
+	stats.echoedPackets = echoedPackets.load();
+
+	running = false;
+	for (std::thread& thread : clientThreads)
+		thread.join();
+
+	for (auto& client : clients)
+	{
+		for (Nz::ENetPeer* peer : client->peers)
+			peer->DisconnectNow(0);
+	}
+
+	return stats;
+}
+
+int main()
+{
+	Nz::Modules<Nz::Network> nazara;
+
+	std::size_t maxShardCount = std::max<std::size_t>(std::thread::hardware_concurrency(), 2);
+	std::cout << "simulating " << peerCount << " peers sending a " << packetSize << " bytes packet every " << sendInterval << " over loopback" << std::endl;
+
+	for (std::size_t shardCount = 1; shardCount <= maxShardCount; shardCount *= 2)
+	{
+		// Each shard can only handle up to 4095 peers
+		if (shardCount * Nz::ENetProtocol_MaximumPeerId < peerCount)
+			continue;
+
+		Stats stats = RunLoadTest(shardCount);
+
+		double seconds = stats.duration.AsSeconds<double>();
+		std::cout << shardCount << " shard(s): " << stats.connectedPeers << "/" << peerCount << " peers connected, ";
+		std::cout << static_cast<Nz::UInt64>(stats.receivedPackets / seconds) << " packets/s received, ";
+		std::cout << static_cast<Nz::UInt64>(stats.echoedPackets / seconds) << " echoes/s" << std::endl;
+	}
+
+	return EXIT_SUCCESS;
+}
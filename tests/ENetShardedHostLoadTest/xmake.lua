@@ -0,0 +1,3 @@
+target("ENetShardedHostLoadTest")
+	add_deps("NazaraNetwork")
+	add_files("main.cpp")
@@ -0,0 +1,169 @@
+#include <Nazara/Core/Clock.hpp>
+#include <Nazara/Core/Core.hpp>
+#include <Nazara/Core/File.hpp>
+#include <Nazara/Core/Hash/SHA256.hpp>
+#include <Nazara/Core/Image.hpp>
+#include <Nazara/Core/Modules.hpp>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+constexpr std::size_t imageCount = 64;
+constexpr Nz::UInt32 imageSize = 1024;
+constexpr unsigned int iterationCount = 5;
+
+struct Stats
+{
+	Nz::Time duration = Nz::Time::Zero();
+	std::size_t loadedBytes = 0;
+	std::size_t mappedFiles = 0;
+};
+
+std::vector<std::filesystem::path> GenerateAssets(const std::filesystem::path& directory)
+{
+	std::mt19937 rand(42);
+	std::uniform_int_distribution<unsigned int> noise(0, 31);
+
+	std::vector<std::filesystem::path> assets;
+	for (std::size_t i = 0; i < imageCount; ++i)
+	{
+		Nz::Image image(Nz::ImageType::E2D, Nz::PixelFormat::RGBA8, imageSize, imageSize);
+
+		// Gradient with some noise, to keep PNG files reasonably sized while still requiring some decoding work
+		Nz::UInt8* pixels = image.GetPixels();
+		for (Nz::UInt32 y = 0; y < imageSize; ++y)
+		{
+			for (Nz::UInt32 x = 0; x < imageSize; ++x)
+			{
+				*pixels++ = static_cast<Nz::UInt8>(x + noise(rand));
+				*pixels++ = static_cast<Nz::UInt8>(y + noise(rand));
+				*pixels++ = static_cast<Nz::UInt8>(i * 4);
+				*pixels++ = 255;
+			}
+		}
+
+		for (const char* extension : { ".png", ".dds" })
+		{
+			std::filesystem::path assetPath = directory / ("asset_" + std::to_string(i) + extension);
+			if (!image.SaveToFile(assetPath))
+			{
+				std::cerr << "failed to save " << assetPath << std::endl;
+				continue;
+			}
+
+			assets.push_back(std::move(assetPath));
+		}
+	}
+
+	return assets;
+}
+
+Stats LoadAssets(const std::vector<std::filesystem::path>& assets, Nz::OpenModeFlags openMode)
+{
+	Stats stats;
+
+	Nz::Time start = Nz::GetElapsedNanoseconds();
+	for (const std::filesystem::path& assetPath : assets)
+	{
+		Nz::File file(assetPath, openMode);
+		if (!file.IsOpen())
+		{
+			std::cerr << "failed to open " << assetPath << std::endl;
+			continue;
+		}
+
+		if (file.IsMemoryMapped())
+			stats.mappedFiles++;
+
+		std::shared_ptr<Nz::Image> image = Nz::Image::LoadFromStream(file);
+		if (!image)
+		{
+			std::cerr << "failed to load " << assetPath << std::endl;
+			continue;
+		}
+
+		stats.loadedBytes += file.GetSize();
+	}
+	stats.duration = Nz::GetElapsedNanoseconds() - start;
+
+	return stats;
+}
+
+Stats HashAssets(const std::vector<std::filesystem::path>& assets, Nz::OpenModeFlags openMode)
+{
+	Stats stats;
+
+	Nz::Time start = Nz::GetElapsedNanoseconds();
+	for (const std::filesystem::path& assetPath : assets)
+	{
+		Nz::File file(assetPath, openMode);
+		if (!file.IsOpen())
+		{
+			std::cerr << "failed to open " << assetPath << std::endl;
+			continue;
+		}
+
+		if (file.IsMemoryMapped())
+			stats.mappedFiles++;
+
+		Nz::SHA256Hasher hash;
+		hash.Begin();
+		Nz::HashAppend(hash, file);
+		hash.End();
+
+		stats.loadedBytes += file.GetSize();
+	}
+	stats.duration = Nz::GetElapsedNanoseconds() - start;
+
+	return stats;
+}
+
+template<typename F>
+void Measure(const char* name, const std::vector<std::filesystem::path>& assets, Nz::OpenModeFlags openMode, F&& func)
+{
+	// Warm up the page cache so both modes start from the same state
+	func(assets, openMode);
+
+	Stats total;
+	for (unsigned int i = 0; i < iterationCount; ++i)
+	{
+		Stats stats = func(assets, openMode);
+		total.duration += stats.duration;
+		total.loadedBytes += stats.loadedBytes;
+		total.mappedFiles += stats.mappedFiles;
+	}
+
+	double seconds = total.duration.AsSeconds<double>();
+	std::cout << name << ": " << total.duration.AsMilliseconds() / iterationCount << "ms per pass";
+	std::cout << " (" << (total.loadedBytes / (1024.0 * 1024.0)) / seconds << "MiB/s, ";
+	std::cout << total.mappedFiles / iterationCount << "/" << assets.size() << " files mapped)" << std::endl;
+}
+
+int main()
+{
+	Nz::Modules<Nz::Core> core;
+
+	std::filesystem::path assetDirectory = std::filesystem::temp_directory_path() / "NazaraFileMappingBenchmark";
+	std::filesystem::create_directories(assetDirectory);
+
+	std::cout << "Generating " << imageCount * 2 << " assets in " << assetDirectory << "..." << std::endl;
+	std::vector<std::filesystem::path> assets = GenerateAssets(assetDirectory);
+
+	std::uintmax_t totalSize = 0;
+	for (const std::filesystem::path& assetPath : assets)
+		totalSize += std::filesystem::file_size(assetPath);
+
+	std::cout << "Asset set: " << assets.size() << " files, " << totalSize / (1024 * 1024) << "MiB" << std::endl;
+
+	Measure("Image loading (buffered)", assets, Nz::OpenMode::Read, LoadAssets);
+	Measure("Image loading (memory-mapped)", assets, Nz::OpenMode::Read | Nz::OpenMode::MemoryMapped, LoadAssets);
+	Measure("Hashing (buffered)", assets, Nz::OpenMode::Read, HashAssets);
+	Measure("Hashing (memory-mapped)", assets, Nz::OpenMode::Read | Nz::OpenMode::MemoryMapped, HashAssets);
+
+	std::filesystem::remove_all(assetDirectory);
+
+	return EXIT_SUCCESS;
+}
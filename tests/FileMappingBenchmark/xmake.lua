@@ -0,0 +1,3 @@
+target("FileMappingBenchmark")
+	add_deps("NazaraCore")
+	add_files("main.cpp")
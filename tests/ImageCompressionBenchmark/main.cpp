@@ -0,0 +1,106 @@
+#include <Nazara/Core/Clock.hpp>
+#include <Nazara/Core/Core.hpp>
+#include <Nazara/Core/Image.hpp>
+#include <Nazara/Core/ImageCompressor.hpp>
+#include <Nazara/Core/Modules.hpp>
+#include <Nazara/Core/PixelFormat.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <utility>
+
+constexpr Nz::UInt32 imageSize = 1024;
+
+using CompressFunc = Nz::Image(*)(const Nz::Image& sourceImage, const Nz::ImageCompressor::Settings& settings);
+
+template<typename F>
+void Measure(const char* name, std::size_t byteCount, F&& func)
+{
+	constexpr unsigned int iterationCount = 5;
+
+	// warm up
+	func();
+
+	Nz::Time start = Nz::GetElapsedNanoseconds();
+	for (unsigned int i = 0; i < iterationCount; ++i)
+		func();
+
+	Nz::Time elapsed = Nz::GetElapsedNanoseconds() - start;
+
+	std::cout << name << ": " << Nz::Time::Nanoseconds(elapsed.AsNanoseconds() / iterationCount) << " per image (" << (byteCount * iterationCount / (1024.0 * 1024.0)) / elapsed.AsSeconds<double>() << "MiB/s)" << std::endl;
+}
+
+// Smooth gradients with some noise, closer to real textures than pure noise
+Nz::Image GenerateImage(Nz::PixelFormat format)
+{
+	std::minstd_rand randEngine(42);
+	std::uniform_int_distribution<int> noiseDis(-8, 8);
+
+	Nz::Image image(Nz::ImageType::E2D, format, imageSize, imageSize);
+	std::size_t bpp = Nz::PixelFormatInfo::GetBytesPerPixel(format);
+
+	Nz::UInt8* pixels = image.GetPixels();
+	for (Nz::UInt32 y = 0; y < imageSize; ++y)
+	{
+		for (Nz::UInt32 x = 0; x < imageSize; ++x)
+		{
+			for (std::size_t c = 0; c < bpp; ++c)
+			{
+				float value = 127.5f + 127.5f * std::sin(x * 0.013f * (c + 1) + y * 0.021f * (bpp - c));
+				*pixels++ = static_cast<Nz::UInt8>(std::clamp(static_cast<int>(value) + noiseDis(randEngine), 0, 255));
+			}
+		}
+	}
+
+	return image;
+}
+
+void MeasureCompression(Nz::TaskScheduler& taskScheduler, const char* name, const Nz::Image& image, CompressFunc compressFunc)
+{
+	std::size_t byteCount = Nz::PixelFormatInfo::ComputeSize(image.GetFormat(), imageSize, imageSize, 1);
+
+	std::cout << "--- " << name << " (" << imageSize << "x" << imageSize << ")" << std::endl;
+
+	constexpr std::pair<Nz::ImageCompressionQuality, const char*> qualities[] = {
+		{ Nz::ImageCompressionQuality::Fast, "fast" },
+		{ Nz::ImageCompressionQuality::Normal, "normal" },
+		{ Nz::ImageCompressionQuality::High, "high" }
+	};
+
+	for (auto&& [quality, qualityName] : qualities)
+	{
+		Nz::ImageCompressor::Settings settings;
+		settings.quality = quality;
+
+		Measure(qualityName, byteCount, [&] { compressFunc(image, settings); });
+
+		settings.taskScheduler = &taskScheduler;
+
+		std::string parallelName = std::string(qualityName) + " (task scheduler)";
+		Measure(parallelName.c_str(), byteCount, [&] { compressFunc(image, settings); });
+	}
+}
+
+int main()
+{
+	Nz::Modules<Nz::Core> core;
+
+	Nz::TaskScheduler taskScheduler;
+	std::cout << "Task scheduler has " << taskScheduler.GetWorkerCount() << " workers" << std::endl;
+
+	Nz::Image r8 = GenerateImage(Nz::PixelFormat::R8);
+	Nz::Image rg8 = GenerateImage(Nz::PixelFormat::RG8);
+	Nz::Image rgba8 = GenerateImage(Nz::PixelFormat::RGBA8);
+
+	MeasureCompression(taskScheduler, "RGBA8 => BC1", rgba8, &Nz::ImageCompressor::RGBA8ToBC1);
+	MeasureCompression(taskScheduler, "RGBA8 => BC3", rgba8, &Nz::ImageCompressor::RGBA8ToBC3);
+	MeasureCompression(taskScheduler, "R8 => BC4", r8, &Nz::ImageCompressor::R8ToBC4);
+	MeasureCompression(taskScheduler, "RG8 => BC5", rg8, &Nz::ImageCompressor::RG8ToBC5);
+	MeasureCompression(taskScheduler, "RGBA8 => BC7", rgba8, &Nz::ImageCompressor::RGBA8ToBC7);
+
+	return EXIT_SUCCESS;
+}
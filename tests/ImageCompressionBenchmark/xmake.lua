@@ -0,0 +1,3 @@
+target("ImageCompressionBenchmark")
+	add_deps("NazaraCore")
+	add_files("main.cpp")
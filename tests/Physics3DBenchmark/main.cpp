@@ -0,0 +1,122 @@
+#include <Nazara/Core/Clock.hpp>
+#include <Nazara/Core/Modules.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <Nazara/Physics3D/Collider3D.hpp>
+#include <Nazara/Physics3D/Physics3D.hpp>
+#include <Nazara/Physics3D/PhysWorld3D.hpp>
+#include <Nazara/Physics3D/RigidBody3D.hpp>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+constexpr std::size_t stepCount = 600;
+
+// Bodies moving in every direction without gravity, colliding with each other (like PhysicsDemo spaceships)
+void FloatingScene(Nz::PhysWorld3D& physWorld, std::vector<Nz::RigidBody3D>& bodies)
+{
+	std::minstd_rand randEngine(42); //< same scene for every backend
+	std::uniform_real_distribution<float> velocityDis(-5.f, 5.f);
+
+	physWorld.SetGravity(Nz::Vector3f::Zero());
+
+	auto collider = std::make_shared<Nz::BoxCollider3D>(Nz::Vector3f(1.f, 0.5f, 2.f));
+
+	constexpr std::size_t gridSize = 16;
+	for (std::size_t x = 0; x < gridSize; ++x)
+	{
+		for (std::size_t y = 0; y < gridSize; ++y)
+		{
+			for (std::size_t z = 0; z < gridSize; ++z)
+			{
+				Nz::RigidBody3D::DynamicSettings settings(collider, 10.f);
+				settings.allowSleeping = false;
+				settings.position = Nz::Vector3f(float(x), float(y), float(z)) * 3.f;
+				settings.linearVelocity = Nz::Vector3f(velocityDis(randEngine), velocityDis(randEngine), velocityDis(randEngine));
+
+				bodies.emplace_back(physWorld, settings);
+			}
+		}
+	}
+}
+
+// Boxes and spheres falling on the ground, piling up
+void PileScene(Nz::PhysWorld3D& physWorld, std::vector<Nz::RigidBody3D>& bodies)
+{
+	physWorld.SetGravity(Nz::Vector3f::Down() * 9.81f);
+
+	Nz::RigidBody3D::StaticSettings groundSettings(std::make_shared<Nz::BoxCollider3D>(Nz::Vector3f(200.f, 1.f, 200.f)));
+	groundSettings.position = Nz::Vector3f::Down() * 0.5f;
+
+	bodies.emplace_back(physWorld, groundSettings);
+
+	auto boxCollider = std::make_shared<Nz::BoxCollider3D>(Nz::Vector3f(1.f));
+	auto sphereCollider = std::make_shared<Nz::SphereCollider3D>(0.5f);
+
+	constexpr std::size_t gridSize = 20;
+	constexpr std::size_t layerCount = 10;
+	for (std::size_t y = 0; y < layerCount; ++y)
+	{
+		for (std::size_t x = 0; x < gridSize; ++x)
+		{
+			for (std::size_t z = 0; z < gridSize; ++z)
+			{
+				Nz::RigidBody3D::DynamicSettings settings(((x + y + z) % 2 == 0) ? std::shared_ptr<Nz::Collider3D>(boxCollider) : std::shared_ptr<Nz::Collider3D>(sphereCollider), 1.f);
+				settings.position = Nz::Vector3f(float(x) * 1.2f - gridSize * 0.6f, 2.f + float(y) * 1.5f, float(z) * 1.2f - gridSize * 0.6f);
+
+				bodies.emplace_back(physWorld, settings);
+			}
+		}
+	}
+}
+
+template<typename F>
+void Measure(const char* backendName, const char* sceneName, F&& buildScene)
+{
+	Nz::PhysWorld3D physWorld;
+	physWorld.SetMaxStepCount(1);
+
+	std::vector<Nz::RigidBody3D> bodies;
+	bodies.reserve(5000);
+	buildScene(physWorld, bodies);
+
+	Nz::Time stepSize = physWorld.GetStepSize();
+
+	Nz::Time start = Nz::GetElapsedNanoseconds();
+	for (std::size_t i = 0; i < stepCount; ++i)
+		physWorld.Step(stepSize);
+
+	Nz::Time elapsed = Nz::GetElapsedNanoseconds() - start;
+
+	std::cout << sceneName << " (" << bodies.size() << " bodies, " << backendName << "): " << Nz::Time::Nanoseconds(elapsed.AsNanoseconds() / stepCount) << " per step" << std::endl;
+}
+
+void RunScenes(const char* backendName)
+{
+	Measure(backendName, "floating", FloatingScene);
+	Measure(backendName, "pile", PileScene);
+}
+
+int main()
+{
+	std::cout << "Simulating " << stepCount << " steps per scene" << std::endl;
+
+	{
+		Nz::Modules<Nz::Physics3D> nazara;
+		RunScenes("Jolt thread pool");
+	}
+
+	{
+		// Shared scheduler, as an application would use for its own tasks
+		Nz::TaskScheduler taskScheduler;
+
+		Nz::Physics3D::Config physicsConfig;
+		physicsConfig.taskScheduler = &taskScheduler;
+
+		Nz::Modules<Nz::Physics3D> nazara(physicsConfig);
+		RunScenes("task scheduler");
+	}
+
+	return EXIT_SUCCESS;
+}
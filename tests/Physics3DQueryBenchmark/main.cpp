@@ -0,0 +1,117 @@
+#include <Nazara/Core/Clock.hpp>
+#include <Nazara/Core/Modules.hpp>
+#include <Nazara/Physics3D/Collider3D.hpp>
+#include <Nazara/Physics3D/Physics3D.hpp>
+#include <Nazara/Physics3D/PhysWorld3D.hpp>
+#include <Nazara/Physics3D/RigidBody3D.hpp>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+constexpr std::size_t queryCount = 10'000;
+constexpr std::size_t runCount = 20;
+
+// Static boxes scattered in a 200m wide area, like obstacles of a level
+void BuildScene(Nz::PhysWorld3D& physWorld, std::vector<Nz::RigidBody3D>& bodies)
+{
+	std::minstd_rand randEngine(42);
+	std::uniform_real_distribution<float> positionDis(-100.f, 100.f);
+	std::uniform_real_distribution<float> sizeDis(0.5f, 4.f);
+
+	constexpr std::size_t bodyCount = 5000;
+	bodies.reserve(bodyCount);
+
+	for (std::size_t i = 0; i < bodyCount; ++i)
+	{
+		Nz::RigidBody3D::StaticSettings settings(std::make_shared<Nz::BoxCollider3D>(Nz::Vector3f(sizeDis(randEngine), sizeDis(randEngine), sizeDis(randEngine))));
+		settings.position = Nz::Vector3f(positionDis(randEngine), positionDis(randEngine) * 0.1f, positionDis(randEngine));
+
+		bodies.emplace_back(physWorld, settings);
+	}
+
+	physWorld.RefreshBodies();
+}
+
+template<typename F>
+Nz::Time Measure(F&& func)
+{
+	Nz::Time start = Nz::GetElapsedNanoseconds();
+	for (std::size_t i = 0; i < runCount; ++i)
+		func();
+
+	return Nz::Time::Nanoseconds((Nz::GetElapsedNanoseconds() - start).AsNanoseconds() / runCount);
+}
+
+int main()
+{
+	Nz::Modules<Nz::Physics3D> nazara;
+
+	Nz::PhysWorld3D physWorld;
+
+	std::vector<Nz::RigidBody3D> bodies;
+	BuildScene(physWorld, bodies);
+
+	// Line-of-sight rays between random points, as AI code would issue
+	std::minstd_rand randEngine(1337);
+	std::uniform_real_distribution<float> positionDis(-100.f, 100.f);
+
+	std::vector<Nz::PhysWorld3D::Raycast> raycasts(queryCount);
+	for (auto& raycast : raycasts)
+	{
+		raycast.from = Nz::Vector3f(positionDis(randEngine), 1.f, positionDis(randEngine));
+		raycast.to = Nz::Vector3f(positionDis(randEngine), 1.f, positionDis(randEngine));
+	}
+
+	std::vector<Nz::PhysWorld3D::Shapecast> shapecasts(queryCount);
+	for (std::size_t i = 0; i < queryCount; ++i)
+	{
+		shapecasts[i].colliderTransform = Nz::Matrix4f::Translate(raycasts[i].from);
+		shapecasts[i].displacement = raycasts[i].to - raycasts[i].from;
+	}
+
+	std::cout << queryCount << " queries against " << bodies.size() << " bodies" << std::endl;
+
+	std::size_t loopHitCount = 0;
+	Nz::Time loopTime = Measure([&]
+	{
+		loopHitCount = 0;
+		for (const auto& raycast : raycasts)
+		{
+			if (physWorld.RaycastQueryFirst(raycast.from, raycast.to, [](const Nz::PhysWorld3D::RaycastHit&) {}))
+				loopHitCount++;
+		}
+	});
+
+	std::cout << "raycasts (per-call loop): " << loopTime << " (" << loopHitCount << " hits)" << std::endl;
+
+	std::vector<Nz::PhysWorld3D::RaycastHit> raycastHits(queryCount);
+
+	std::size_t batchHitCount = 0;
+	Nz::Time batchTime = Measure([&]
+	{
+		batchHitCount = physWorld.RaycastQueryFirstBatch(raycasts, raycastHits);
+	});
+
+	std::cout << "raycasts (batch): " << batchTime << " (" << batchHitCount << " hits)" << std::endl;
+
+	auto sphereCollider = std::make_shared<Nz::SphereCollider3D>(0.5f);
+	std::vector<Nz::PhysWorld3D::ShapecastHit> shapecastHits(queryCount);
+
+	std::size_t shapecastHitCount = 0;
+	Nz::Time shapecastTime = Measure([&]
+	{
+		shapecastHitCount = physWorld.ShapecastQueryFirstBatch(*sphereCollider, shapecasts, shapecastHits);
+	});
+
+	std::cout << "sphere casts (batch): " << shapecastTime << " (" << shapecastHitCount << " hits)" << std::endl;
+
+	if (loopHitCount != batchHitCount)
+	{
+		std::cerr << "hit count mismatch between per-call and batched raycasts" << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}
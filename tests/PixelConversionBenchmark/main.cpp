@@ -0,0 +1,143 @@
+#include <Nazara/Core/Clock.hpp>
+#include <Nazara/Core/Core.hpp>
+#include <Nazara/Core/Image.hpp>
+#include <Nazara/Core/Modules.hpp>
+#include <Nazara/Core/PixelFormat.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <vector>
+
+constexpr Nz::UInt32 imageSize = 2048;
+constexpr std::size_t pixelCount = std::size_t(imageSize) * imageSize;
+
+// Previous implementation, kept as a baseline (one pixel at a time)
+void ConvertRGB8ToRGBA8Reference(const Nz::UInt8* start, const Nz::UInt8* end, Nz::UInt8* dst)
+{
+	while (start < end)
+	{
+		*dst++ = start[0];
+		*dst++ = start[1];
+		*dst++ = start[2];
+		*dst++ = 0xFF;
+
+		start += 3;
+	}
+}
+
+void ConvertRGBA8ToBGRA8Reference(const Nz::UInt8* start, const Nz::UInt8* end, Nz::UInt8* dst)
+{
+	while (start < end)
+	{
+		*dst++ = start[2];
+		*dst++ = start[1];
+		*dst++ = start[0];
+		*dst++ = start[3];
+
+		start += 4;
+	}
+}
+
+void ConvertRGBA8ToRGBA32FReference(const Nz::UInt8* start, const Nz::UInt8* end, Nz::UInt8* dst)
+{
+	float* ptr = reinterpret_cast<float*>(dst);
+	while (start < end)
+		*ptr++ = *start++ / 255.f;
+}
+
+void ConvertRGBA32FToRGBA8Reference(const Nz::UInt8* start, const Nz::UInt8* end, Nz::UInt8* dst)
+{
+	const float* ptr = reinterpret_cast<const float*>(start);
+	const float* endPtr = reinterpret_cast<const float*>(end);
+	while (ptr < endPtr)
+		*dst++ = static_cast<Nz::UInt8>(*ptr++ * 255.f);
+}
+
+template<typename F>
+void Measure(const char* name, std::size_t byteCount, F&& func)
+{
+	constexpr unsigned int iterationCount = 20;
+
+	// warm up
+	func();
+
+	Nz::Time start = Nz::GetElapsedNanoseconds();
+	for (unsigned int i = 0; i < iterationCount; ++i)
+		func();
+
+	Nz::Time elapsed = Nz::GetElapsedNanoseconds() - start;
+
+	std::cout << name << ": " << Nz::Time::Nanoseconds(elapsed.AsNanoseconds() / iterationCount) << " per conversion (" << (byteCount * iterationCount / (1024.0 * 1024.0)) / elapsed.AsSeconds<double>() << "MiB/s)" << std::endl;
+}
+
+void MeasureConversion(Nz::TaskScheduler& taskScheduler, Nz::PixelFormat srcFormat, Nz::PixelFormat dstFormat, const std::vector<Nz::UInt8>& src, void(*referenceFunc)(const Nz::UInt8*, const Nz::UInt8*, Nz::UInt8*))
+{
+	std::vector<Nz::UInt8> dst(pixelCount * Nz::PixelFormatInfo::GetBytesPerPixel(dstFormat));
+
+	const Nz::UInt8* start = src.data();
+	const Nz::UInt8* end = src.data() + pixelCount * Nz::PixelFormatInfo::GetBytesPerPixel(srcFormat);
+
+	std::cout << "--- " << Nz::PixelFormatInfo::GetName(srcFormat) << " => " << Nz::PixelFormatInfo::GetName(dstFormat) << " (" << imageSize << "x" << imageSize << ")" << std::endl;
+
+	if (referenceFunc)
+		Measure("reference", src.size(), [&] { referenceFunc(start, end, dst.data()); });
+
+	Measure("Convert", src.size(), [&] { Nz::PixelFormatInfo::Convert(srcFormat, dstFormat, start, end, dst.data()); });
+	Measure("Convert (task scheduler)", src.size(), [&] { Nz::PixelFormatInfo::Convert(taskScheduler, srcFormat, dstFormat, start, end, dst.data()); });
+}
+
+int main()
+{
+	Nz::Modules<Nz::Core> core;
+
+	Nz::TaskScheduler taskScheduler;
+	std::cout << "Task scheduler has " << taskScheduler.GetWorkerCount() << " workers" << std::endl;
+
+	std::minstd_rand randEngine(42);
+	std::uniform_int_distribution<unsigned int> byteDis(0, 255);
+	std::uniform_real_distribution<float> floatDis(0.f, 1.f);
+
+	std::vector<Nz::UInt8> rgb8(pixelCount * 3);
+	for (Nz::UInt8& value : rgb8)
+		value = static_cast<Nz::UInt8>(byteDis(randEngine));
+
+	std::vector<Nz::UInt8> rgba8(pixelCount * 4);
+	for (Nz::UInt8& value : rgba8)
+		value = static_cast<Nz::UInt8>(byteDis(randEngine));
+
+	std::vector<Nz::UInt8> rgba32f(pixelCount * 4 * sizeof(float));
+	{
+		float* ptr = reinterpret_cast<float*>(rgba32f.data());
+		for (std::size_t i = 0; i < pixelCount * 4; ++i)
+			ptr[i] = floatDis(randEngine);
+	}
+
+	MeasureConversion(taskScheduler, Nz::PixelFormat::RGB8, Nz::PixelFormat::RGBA8, rgb8, &ConvertRGB8ToRGBA8Reference);
+	MeasureConversion(taskScheduler, Nz::PixelFormat::RGBA8, Nz::PixelFormat::RGB8, rgba8, nullptr);
+	MeasureConversion(taskScheduler, Nz::PixelFormat::RGBA8, Nz::PixelFormat::BGRA8, rgba8, &ConvertRGBA8ToBGRA8Reference);
+	MeasureConversion(taskScheduler, Nz::PixelFormat::BGRA8, Nz::PixelFormat::RGBA8, rgba8, &ConvertRGBA8ToBGRA8Reference);
+	MeasureConversion(taskScheduler, Nz::PixelFormat::RGBA8, Nz::PixelFormat::RGBA32F, rgba8, &ConvertRGBA8ToRGBA32FReference);
+	MeasureConversion(taskScheduler, Nz::PixelFormat::RGBA32F, Nz::PixelFormat::RGBA8, rgba32f, &ConvertRGBA32FToRGBA8Reference);
+	MeasureConversion(taskScheduler, Nz::PixelFormat::RGBA8_SRGB, Nz::PixelFormat::RGBA32F, rgba8, nullptr);
+	MeasureConversion(taskScheduler, Nz::PixelFormat::RGBA32F, Nz::PixelFormat::RGBA8_SRGB, rgba32f, nullptr);
+
+	std::cout << "--- Image::ConvertTo RGB8 => RGBA8" << std::endl;
+	Nz::Image image(Nz::ImageType::E2D, Nz::PixelFormat::RGB8, imageSize, imageSize);
+	std::memcpy(image.GetPixels(), rgb8.data(), rgb8.size());
+
+	Measure("ConvertTo", rgb8.size(), [&]
+	{
+		Nz::Image copy(image);
+		copy.ConvertTo(Nz::PixelFormat::RGBA8);
+	});
+
+	Measure("ConvertTo (task scheduler)", rgb8.size(), [&]
+	{
+		Nz::Image copy(image);
+		copy.ConvertTo(taskScheduler, Nz::PixelFormat::RGBA8);
+	});
+
+	return EXIT_SUCCESS;
+}
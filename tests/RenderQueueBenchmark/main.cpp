@@ -0,0 +1,138 @@
+#include <Nazara/Core/Clock.hpp>
+#include <Nazara/Graphics/RenderElement.hpp>
+#include <Nazara/Graphics/RenderQueue.hpp>
+#include <Nazara/Math/Vector3.hpp>
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+// Render element with an arbitrary sort key, only used to feed the sort functions
+class BenchmarkRenderElement : public Nz::RenderElement
+{
+	public:
+		BenchmarkRenderElement(Nz::UInt32 instanceIndex, Nz::UInt64 sortKey) :
+		RenderElement(Nz::BasicRenderElement::Submesh, instanceIndex, 0, 0xFFFFFFFF),
+		m_sortKey(sortKey)
+		{
+		}
+
+		void Register(Nz::RenderQueueRegistry& /*registry*/) const override
+		{
+		}
+
+	protected:
+		Nz::UInt64 ComputeSortKey(const Nz::RenderQueueRegistry& /*registry*/) const override
+		{
+			return m_sortKey;
+		}
+
+	private:
+		Nz::UInt64 m_sortKey;
+};
+
+template<typename F>
+void Measure(const char* name, std::size_t elementCount, F&& func)
+{
+	constexpr unsigned int iterationCount = 100;
+
+	// warm up
+	func();
+
+	Nz::Time start = Nz::GetElapsedNanoseconds();
+	for (unsigned int i = 0; i < iterationCount; ++i)
+		func();
+
+	Nz::Time elapsed = Nz::GetElapsedNanoseconds() - start;
+
+	std::cout << name << ": " << Nz::Time::Nanoseconds(elapsed.AsNanoseconds() / iterationCount) << " per iteration (" << static_cast<Nz::UInt64>(elementCount * iterationCount / elapsed.AsSeconds<double>()) << " elements/s)" << std::endl;
+}
+
+int main()
+{
+	constexpr std::size_t elementCount = 100'000;
+
+	std::minstd_rand randEngine(std::random_device{}());
+	std::uniform_real_distribution<float> posDis(-500.f, 500.f);
+	std::uniform_int_distribution<Nz::UInt64> stateDis(0, 255);
+
+	std::cout << "Initializing..." << std::endl;
+
+	// Instance positions, as they would be read from the instance buffer world matrices
+	std::vector<Nz::Vector3f> positions(elementCount);
+	std::vector<std::unique_ptr<BenchmarkRenderElement>> renderElements(elementCount);
+	std::vector<const Nz::RenderElement*> unsortedElements(elementCount);
+
+	Nz::RenderQueueRegistry registry;
+	for (std::size_t i = 0; i < elementCount; ++i)
+	{
+		positions[i] = Nz::Vector3f(posDis(randEngine), posDis(randEngine), posDis(randEngine));
+
+		// Same layout as RenderSubmesh sort keys, with a limited number of pipelines/materials/vertex buffers
+		Nz::UInt64 sortKey = (stateDis(randEngine) & 0x1F) << 35 | stateDis(randEngine) << 19 | stateDis(randEngine) << 11;
+
+		renderElements[i] = std::make_unique<BenchmarkRenderElement>(Nz::SafeCast<Nz::UInt32>(i), sortKey);
+		renderElements[i]->UpdateSortKey(registry);
+
+		unsortedElements[i] = renderElements[i].get();
+	}
+
+	Nz::Vector3f eyePosition = Nz::Vector3f::Zero();
+
+	std::vector<const Nz::RenderElement*> elements;
+	std::vector<Nz::RenderQueue::SortEntry> sortEntries;
+	std::vector<Nz::RenderQueue::SortEntry> sortBuffer;
+
+	std::cout << "Sorting " << elementCount << " render elements" << std::endl;
+
+	Measure("back to front, std::sort computing distances in comparator (previous implementation)", elementCount, [&]
+	{
+		elements = unsortedElements;
+		std::sort(elements.begin(), elements.end(), [&](const Nz::RenderElement* lhs, const Nz::RenderElement* rhs)
+		{
+			return eyePosition.SquaredDistance(positions[lhs->GetInstanceIndex()]) > eyePosition.SquaredDistance(positions[rhs->GetInstanceIndex()]);
+		});
+	});
+
+	Measure("back to front, precomputed keys and radix sort", elementCount, [&]
+	{
+		sortEntries.clear();
+		for (const Nz::RenderElement* element : unsortedElements)
+			sortEntries.push_back({ Nz::RenderQueue::ComputeBackToFrontSortKey(*element, eyePosition.SquaredDistance(positions[element->GetInstanceIndex()])), element });
+
+		Nz::RenderQueue::SortEntries(sortEntries, sortBuffer);
+	});
+
+	Measure("front to back, precomputed keys and radix sort", elementCount, [&]
+	{
+		sortEntries.clear();
+		for (const Nz::RenderElement* element : unsortedElements)
+			sortEntries.push_back({ Nz::RenderQueue::ComputeFrontToBackSortKey(*element, eyePosition.SquaredDistance(positions[element->GetInstanceIndex()])), element });
+
+		Nz::RenderQueue::SortEntries(sortEntries, sortBuffer);
+	});
+
+	Measure("render states, std::sort on element sort keys (previous implementation)", elementCount, [&]
+	{
+		elements = unsortedElements;
+		std::sort(elements.begin(), elements.end(), [&](const Nz::RenderElement* lhs, const Nz::RenderElement* rhs)
+		{
+			bool orderedBefore = lhs->GetRenderLayer() < rhs->GetRenderLayer();
+			orderedBefore |= lhs->GetRenderLayer() == rhs->GetRenderLayer() && lhs->GetSortKey() < rhs->GetSortKey();
+			return orderedBefore;
+		});
+	});
+
+	Measure("render states, radix sort on element sort keys", elementCount, [&]
+	{
+		sortEntries.clear();
+		for (const Nz::RenderElement* element : unsortedElements)
+			sortEntries.push_back({ element->GetSortKey(), element });
+
+		Nz::RenderQueue::SortEntries(sortEntries, sortBuffer);
+	});
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,3 @@
+target("RenderQueueBenchmark")
+	add_deps("NazaraGraphics")
+	add_files("main.cpp")
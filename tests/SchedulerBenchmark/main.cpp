@@ -3,9 +3,179 @@
 #include <Nazara/Core/TaskScheduler.hpp>
 #include <Nazara/Core/Image.hpp>
 #include "task.hpp"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
 #include <iostream>
 #include <mutex>
+#include <new>
 #include <random>
+#include <thread>
+
+static std::atomic_size_t s_allocationCount = 0;
+
+void* operator new(std::size_t size)
+{
+	s_allocationCount++;
+	if (void* ptr = std::malloc(size))
+		return ptr;
+
+	throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+	std::free(ptr);
+}
+
+void MeasureFrameWorkload(Nz::TaskScheduler& taskScheduler, const char* name, Nz::TaskScheduler::WaitMode waitMode)
+{
+	constexpr unsigned int frameCount = 200;
+	constexpr unsigned int taskCount = 1000;
+
+	auto busyTask = []
+	{
+		Nz::Time start = Nz::GetElapsedNanoseconds();
+		while (Nz::GetElapsedNanoseconds() - start < Nz::Time::Microseconds(5));
+	};
+
+	Nz::Time totalTime = Nz::Time::Zero();
+	for (unsigned int i = 0; i < frameCount; ++i)
+	{
+		Nz::Time start = Nz::GetElapsedNanoseconds();
+		for (unsigned int j = 0; j < taskCount; ++j)
+			taskScheduler.AddTask(busyTask);
+
+		taskScheduler.WaitForTasks(waitMode);
+		totalTime += Nz::GetElapsedNanoseconds() - start;
+
+		// Leave workers idle for a bit, like the rest of a frame would
+		std::this_thread::sleep_for(std::chrono::microseconds(500));
+	}
+
+	std::cout << name << ": " << Nz::Time::Nanoseconds(totalTime.AsNanoseconds() / frameCount) << " per " << taskCount << " tasks of 5us" << std::endl;
+}
+
+template<typename F>
+void MeasureTinyTasks(Nz::TaskScheduler& taskScheduler, const char* name, F&& taskFactory)
+{
+	constexpr unsigned int taskCount = 1'000'000;
+
+	std::atomic_uint counter = 0;
+
+	// warm up (let the task queues allocate their blocks)
+	for (unsigned int i = 0; i < taskCount; ++i)
+		taskScheduler.AddTask(taskFactory(counter));
+
+	taskScheduler.WaitForTasks();
+
+	std::size_t allocationCount = s_allocationCount.load();
+	Nz::Time t1 = Nz::GetElapsedNanoseconds();
+	for (unsigned int i = 0; i < taskCount; ++i)
+		taskScheduler.AddTask(taskFactory(counter));
+
+	taskScheduler.WaitForTasks();
+	Nz::Time t2 = Nz::GetElapsedNanoseconds();
+	allocationCount = s_allocationCount.load() - allocationCount;
+
+	std::cout << name << ": " << static_cast<double>(allocationCount) / taskCount << " allocations per task, " << static_cast<Nz::UInt64>(taskCount / (t2 - t1).AsSeconds<double>()) << " tasks/s" << std::endl;
+}
+
+void MeasureForkJoin(Nz::TaskScheduler& taskScheduler)
+{
+	constexpr unsigned int iterationCount = 1000;
+	const unsigned int forkCount = taskScheduler.GetWorkerCount() * 4;
+
+	std::cout << "Measuring fork/join latency (" << forkCount << " tasks, " << iterationCount << " iterations)..." << std::endl;
+
+	std::atomic_uint counter = 0;
+	auto tinyTask = [&] { counter++; };
+
+	Nz::Time t1 = Nz::GetElapsedNanoseconds();
+	for (unsigned int i = 0; i < iterationCount; ++i)
+	{
+		for (unsigned int j = 0; j < forkCount; ++j)
+			taskScheduler.AddTask(tinyTask);
+
+		taskScheduler.WaitForTasks();
+	}
+	Nz::Time t2 = Nz::GetElapsedNanoseconds();
+
+	std::cout << "global counter fork/join: " << Nz::Time::Nanoseconds((t2 - t1).AsNanoseconds() / iterationCount) << " per iteration" << std::endl;
+
+	Nz::Time t3 = Nz::GetElapsedNanoseconds();
+	for (unsigned int i = 0; i < iterationCount; ++i)
+	{
+		Nz::TaskScheduler::TaskGroup group;
+		for (unsigned int j = 0; j < forkCount; ++j)
+			taskScheduler.AddTask(group, tinyTask);
+
+		group.Wait();
+	}
+	Nz::Time t4 = Nz::GetElapsedNanoseconds();
+
+	std::cout << "task group fork/join: " << Nz::Time::Nanoseconds((t4 - t3).AsNanoseconds() / iterationCount) << " per iteration" << std::endl;
+
+	Nz::Time t5 = Nz::GetElapsedNanoseconds();
+	for (unsigned int i = 0; i < iterationCount; ++i)
+	{
+		Nz::TaskScheduler::TaskHandle root = taskScheduler.AddTask(tinyTask, {});
+
+		std::vector<Nz::TaskScheduler::TaskHandle> children;
+		children.reserve(forkCount);
+		for (unsigned int j = 0; j < forkCount; ++j)
+			children.push_back(taskScheduler.AddContinuation(root, tinyTask));
+
+		taskScheduler.AddTask(tinyTask, children).Wait();
+	}
+	Nz::Time t6 = Nz::GetElapsedNanoseconds();
+
+	std::cout << "dependency graph fork/join: " << Nz::Time::Nanoseconds((t6 - t5).AsNanoseconds() / iterationCount) << " per iteration" << std::endl;
+
+	// Fork/join while another subsystem keeps long tasks in flight, global wait has to wait for them too
+	constexpr unsigned int backgroundIterationCount = 20;
+	auto backgroundTask = []
+	{
+		Nz::Time start = Nz::GetElapsedNanoseconds();
+		while (Nz::GetElapsedNanoseconds() - start < Nz::Time::Milliseconds(5));
+	};
+
+	Nz::Time globalTime = Nz::Time::Zero();
+	Nz::Time groupTime = Nz::Time::Zero();
+	for (unsigned int i = 0; i < backgroundIterationCount; ++i)
+	{
+		taskScheduler.AddTask(backgroundTask);
+
+		Nz::Time start = Nz::GetElapsedNanoseconds();
+		for (unsigned int j = 0; j < forkCount; ++j)
+			taskScheduler.AddTask(tinyTask);
+
+		taskScheduler.WaitForTasks();
+		globalTime += Nz::GetElapsedNanoseconds() - start;
+
+		Nz::TaskScheduler::TaskGroup backgroundGroup;
+		taskScheduler.AddTask(backgroundGroup, backgroundTask);
+
+		start = Nz::GetElapsedNanoseconds();
+		Nz::TaskScheduler::TaskGroup group;
+		for (unsigned int j = 0; j < forkCount; ++j)
+			taskScheduler.AddTask(group, tinyTask);
+
+		group.Wait();
+		groupTime += Nz::GetElapsedNanoseconds() - start;
+
+		backgroundGroup.Wait();
+	}
+
+	std::cout << "global counter fork/join with background work: " << Nz::Time::Nanoseconds(globalTime.AsNanoseconds() / backgroundIterationCount) << " per iteration" << std::endl;
+	std::cout << "task group fork/join with background work: " << Nz::Time::Nanoseconds(groupTime.AsNanoseconds() / backgroundIterationCount) << " per iteration" << std::endl;
+}
 
 int main()
 {
@@ -109,4 +279,38 @@ int main()
 	Nz::Image image(Nz::ImageType::E2D, Nz::PixelFormat::RGB8, imageDimensions, imageDimensions);
 	image.Update(sceneData.pixels.get());
 	image.SaveToFile(Nz::Utf8Path("raycast_test.png"));
+
+	MeasureForkJoin(taskScheduler);
+
+	std::cout << "Measuring frame-sized workloads..." << std::endl;
+	MeasureFrameWorkload(taskScheduler, "blocking wait, no backoff", Nz::TaskScheduler::WaitMode::Block);
+	MeasureFrameWorkload(taskScheduler, "participating wait, no backoff", Nz::TaskScheduler::WaitMode::Participate);
+
+	Nz::TaskScheduler::WorkerBackoff workerBackoff;
+	workerBackoff.spinCount = 256;
+	workerBackoff.yieldCount = 16;
+	taskScheduler.SetWorkerBackoff(workerBackoff);
+
+	MeasureFrameWorkload(taskScheduler, "blocking wait, spin/yield backoff", Nz::TaskScheduler::WaitMode::Block);
+	MeasureFrameWorkload(taskScheduler, "participating wait, spin/yield backoff", Nz::TaskScheduler::WaitMode::Participate);
+
+	taskScheduler.SetWorkerBackoff({});
+
+	std::cout << "Measuring tiny tasks..." << std::endl;
+	MeasureTinyTasks(taskScheduler, "inline capture", [](std::atomic_uint& counter)
+	{
+		return [&counter] { counter++; };
+	});
+
+	MeasureTinyTasks(taskScheduler, "max inline capture", [](std::atomic_uint& counter)
+	{
+		std::array<Nz::UInt8, Nz::TaskScheduler::Task::InlineStorageSize - sizeof(void*)> padding{};
+		return [&counter, padding] { counter += padding[0] + 1; };
+	});
+
+	MeasureTinyTasks(taskScheduler, "oversized capture (heap fallback)", [](std::atomic_uint& counter)
+	{
+		std::array<Nz::UInt8, Nz::TaskScheduler::Task::InlineStorageSize * 2> padding{};
+		return [&counter, padding] { counter += padding[0] + 1; };
+	});
 }
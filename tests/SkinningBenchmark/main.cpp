@@ -0,0 +1,140 @@
+#include <Nazara/Core/Algorithm.hpp>
+#include <Nazara/Core/Clock.hpp>
+#include <Nazara/Core/Core.hpp>
+#include <Nazara/Core/Joint.hpp>
+#include <Nazara/Core/Skeleton.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <Nazara/Math/EulerAngles.hpp>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+// Previous implementation, kept as a baseline (one skinning matrix fetch and scale per joint influence)
+void SkinLinearBlendReference(const Nz::SkinningData& skinningInfos, Nz::UInt32 startVertex, Nz::UInt32 vertexCount)
+{
+	Nz::UInt32 endVertex = startVertex + vertexCount;
+	for (Nz::UInt32 i = startVertex; i < endVertex; ++i)
+	{
+		Nz::Vector3f finalPosition = Nz::Vector3f::Zero();
+		Nz::Vector3f finalNormal = Nz::Vector3f::Zero();
+		Nz::Vector3f finalTangent = Nz::Vector3f::Zero();
+
+		for (Nz::Int32 j = 0; j < 4; ++j)
+		{
+			Nz::Int32 jointIndex = skinningInfos.inputJointIndices[i][j];
+
+			Nz::Matrix4f mat = skinningInfos.joints[jointIndex].GetSkinningMatrix();
+			mat *= skinningInfos.inputJointWeights[i][j];
+
+			finalPosition += mat.Transform(skinningInfos.inputPositions[i]);
+			finalNormal += mat.Transform(skinningInfos.inputNormals[i], 0.f);
+			finalTangent += mat.Transform(skinningInfos.inputTangents[i], 0.f);
+		}
+
+		skinningInfos.outputPositions[i] = finalPosition;
+		skinningInfos.outputNormals[i] = finalNormal.GetNormal();
+		skinningInfos.outputTangents[i] = finalTangent.GetNormal();
+	}
+}
+
+template<typename F>
+void Measure(const char* name, Nz::UInt32 vertexCount, F&& func)
+{
+	constexpr unsigned int iterationCount = 100;
+
+	// warm up
+	func();
+
+	Nz::Time start = Nz::GetElapsedNanoseconds();
+	for (unsigned int i = 0; i < iterationCount; ++i)
+		func();
+
+	Nz::Time elapsed = Nz::GetElapsedNanoseconds() - start;
+
+	std::cout << name << ": " << Nz::Time::Nanoseconds(elapsed.AsNanoseconds() / iterationCount) << " per iteration (" << static_cast<Nz::UInt64>(vertexCount * iterationCount / elapsed.AsSeconds<double>()) << " vertices/s)" << std::endl;
+}
+
+int main()
+{
+	Nz::Modules<Nz::Core> core;
+
+	constexpr std::size_t jointCount = 64;
+	constexpr Nz::UInt32 vertexCount = 200'000;
+
+	std::minstd_rand randEngine(std::random_device{}());
+	std::uniform_real_distribution<float> posDis(-5.f, 5.f);
+	std::uniform_real_distribution<float> angleDis(-180.f, 180.f);
+	std::uniform_int_distribution<Nz::Int32> jointDis(0, jointCount - 1);
+
+	std::cout << "Initializing..." << std::endl;
+
+	Nz::Skeleton skeleton;
+	skeleton.Create(jointCount);
+
+	for (std::size_t i = 0; i < jointCount; ++i)
+	{
+		Nz::Joint* joint = skeleton.GetJoint(i);
+		joint->SetPosition(Nz::Vector3f(posDis(randEngine), posDis(randEngine), posDis(randEngine)));
+		joint->SetRotation(Nz::EulerAnglesf(Nz::DegreeAnglef(angleDis(randEngine)), Nz::DegreeAnglef(angleDis(randEngine)), Nz::DegreeAnglef(angleDis(randEngine))).ToQuaternion());
+	}
+
+	std::vector<Nz::Vector3f> positions(vertexCount);
+	std::vector<Nz::Vector3f> normals(vertexCount);
+	std::vector<Nz::Vector3f> tangents(vertexCount);
+	std::vector<Nz::Vector4i32> jointIndices(vertexCount);
+	std::vector<Nz::Vector4f> jointWeights(vertexCount);
+	for (Nz::UInt32 i = 0; i < vertexCount; ++i)
+	{
+		positions[i] = Nz::Vector3f(posDis(randEngine), posDis(randEngine), posDis(randEngine));
+		normals[i] = Nz::Vector3f::UnitY();
+		tangents[i] = Nz::Vector3f::UnitX();
+		jointIndices[i] = Nz::Vector4i32(jointDis(randEngine), jointDis(randEngine), jointDis(randEngine), jointDis(randEngine));
+		jointWeights[i] = Nz::Vector4f(0.4f, 0.3f, 0.2f, 0.1f);
+	}
+
+	std::vector<Nz::Vector3f> outputPositions(vertexCount);
+	std::vector<Nz::Vector3f> outputNormals(vertexCount);
+	std::vector<Nz::Vector3f> outputTangents(vertexCount);
+
+	Nz::SkinningData skinningData;
+	skinningData.joints = skeleton.GetJoints();
+	skinningData.inputPositions = positions.data();
+	skinningData.inputNormals = normals.data();
+	skinningData.inputTangents = tangents.data();
+	skinningData.inputJointIndices = jointIndices.data();
+	skinningData.inputJointWeights = jointWeights.data();
+	skinningData.outputPositions = outputPositions.data();
+	skinningData.outputNormals = outputNormals.data();
+	skinningData.outputTangents = outputTangents.data();
+
+	std::cout << "Skinning " << vertexCount << " vertices (positions, normals and tangents) with " << jointCount << " joints" << std::endl;
+
+	Measure("reference", vertexCount, [&]
+	{
+		SkinLinearBlendReference(skinningData, 0, vertexCount);
+	});
+
+	Measure("SkinLinearBlend (mono-threaded)", vertexCount, [&]
+	{
+		Nz::SkinLinearBlend(skinningData, 0, vertexCount);
+	});
+
+	Measure("SkinDualQuaternion (mono-threaded)", vertexCount, [&]
+	{
+		Nz::SkinDualQuaternion(skinningData, 0, vertexCount);
+	});
+
+	Nz::TaskScheduler taskScheduler;
+	Measure("SkinLinearBlend (task scheduler)", vertexCount, [&]
+	{
+		Nz::SkinLinearBlend(taskScheduler, skinningData, 0, vertexCount);
+	});
+
+	Measure("SkinDualQuaternion (task scheduler)", vertexCount, [&]
+	{
+		Nz::SkinDualQuaternion(taskScheduler, skinningData, 0, vertexCount);
+	});
+
+	return EXIT_SUCCESS;
+}
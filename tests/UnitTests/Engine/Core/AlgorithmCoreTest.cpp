@@ -1,11 +1,15 @@
 #include <Nazara/Core/Algorithm.hpp>
 #include <Nazara/Core/File.hpp>
+#include <Nazara/Core/Joint.hpp>
+#include <Nazara/Core/Skeleton.hpp>
 #include <Nazara/Core/StringExt.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
 #include <Nazara/Math/Vector2.hpp>
 #include <catch2/catch_approx.hpp>
 #include <catch2/catch_test_macros.hpp>
 #include <array>
 #include <filesystem>
+#include <random>
 #include <variant>
 
 std::filesystem::path GetAssetDir();
@@ -91,3 +95,301 @@ TEST_CASE("ComputeHash", "[CORE][ALGORITHM]")
 		}
 	}
 }
+
+namespace
+{
+	struct SkinningFixture
+	{
+		SkinningFixture(std::size_t jointCount, std::size_t vertexCount, unsigned int seed) :
+		positions(vertexCount),
+		normals(vertexCount),
+		outputNormals(vertexCount),
+		outputPositions(vertexCount),
+		jointIndices(vertexCount),
+		jointWeights(vertexCount)
+		{
+			skeleton.Create(jointCount);
+
+			std::minstd_rand randEngine(seed);
+			std::uniform_real_distribution<float> posDis(-5.f, 5.f);
+			std::uniform_real_distribution<float> angleDis(-180.f, 180.f);
+			std::uniform_int_distribution<Nz::Int32> jointDis(0, jointCount - 1);
+
+			// Rigid joint transformations only, so dual quaternions can represent them
+			for (std::size_t i = 0; i < jointCount; ++i)
+			{
+				Nz::Joint* joint = skeleton.GetJoint(i);
+				joint->SetPosition(Nz::Vector3f(posDis(randEngine), posDis(randEngine), posDis(randEngine)));
+				joint->SetRotation(Nz::EulerAnglesf(Nz::DegreeAnglef(angleDis(randEngine)), Nz::DegreeAnglef(angleDis(randEngine)), Nz::DegreeAnglef(angleDis(randEngine))).ToQuaternion());
+				joint->SetInverseBindMatrix(Nz::Matrix4f::Translate(Nz::Vector3f(posDis(randEngine), posDis(randEngine), posDis(randEngine))));
+			}
+
+			for (std::size_t i = 0; i < vertexCount; ++i)
+			{
+				positions[i] = Nz::Vector3f(posDis(randEngine), posDis(randEngine), posDis(randEngine));
+				normals[i] = Nz::Vector3f::Normalize(Nz::Vector3f(posDis(randEngine), posDis(randEngine), posDis(randEngine)) + Nz::Vector3f(0.01f));
+				jointIndices[i] = Nz::Vector4i32(jointDis(randEngine), jointDis(randEngine), jointDis(randEngine), jointDis(randEngine));
+
+				Nz::Vector4f weights(std::abs(posDis(randEngine)), std::abs(posDis(randEngine)), std::abs(posDis(randEngine)), std::abs(posDis(randEngine)));
+				jointWeights[i] = weights / (weights.x + weights.y + weights.z + weights.w);
+			}
+
+			skinningData.joints = skeleton.GetJoints();
+			skinningData.inputPositions = positions.data();
+			skinningData.inputNormals = normals.data();
+			skinningData.inputJointIndices = jointIndices.data();
+			skinningData.inputJointWeights = jointWeights.data();
+			skinningData.outputPositions = outputPositions.data();
+			skinningData.outputNormals = outputNormals.data();
+		}
+
+		SkinningFixture(const SkinningFixture&) = delete;
+		SkinningFixture(SkinningFixture&&) = delete;
+
+		// Checks [firstVertex, lastVertex) outputs against expected values
+		void CheckOutput(std::size_t firstVertex, std::size_t lastVertex, const std::vector<Nz::Vector3f>& expectedPositions, const std::vector<Nz::Vector3f>& expectedNormals) const
+		{
+			for (std::size_t i = firstVertex; i < lastVertex; ++i)
+			{
+				INFO("vertex #" << i);
+				CHECK(outputPositions[i].ApproxEqual(expectedPositions[i], 0.001f));
+				CHECK(outputNormals[i].ApproxEqual(expectedNormals[i], 0.001f));
+			}
+		}
+
+		Nz::Skeleton skeleton;
+		Nz::SkinningData skinningData;
+		std::vector<Nz::Vector3f> positions;
+		std::vector<Nz::Vector3f> normals;
+		std::vector<Nz::Vector3f> outputNormals;
+		std::vector<Nz::Vector3f> outputPositions;
+		std::vector<Nz::Vector4i32> jointIndices;
+		std::vector<Nz::Vector4f> jointWeights;
+	};
+}
+
+TEST_CASE("SkinLinearBlend", "[CORE][ALGORITHM]")
+{
+	constexpr std::size_t jointCount = 8;
+	constexpr std::size_t vertexCount = 5000;
+
+	SkinningFixture fixture(jointCount, vertexCount, 42);
+
+	// Reference implementation
+	std::vector<Nz::Vector3f> expectedPositions(vertexCount);
+	std::vector<Nz::Vector3f> expectedNormals(vertexCount);
+	for (std::size_t i = 0; i < vertexCount; ++i)
+	{
+		Nz::Vector3f position = Nz::Vector3f::Zero();
+		Nz::Vector3f normal = Nz::Vector3f::Zero();
+		for (std::size_t j = 0; j < 4; ++j)
+		{
+			Nz::Matrix4f mat = fixture.skeleton.GetJoint(fixture.jointIndices[i][j])->GetSkinningMatrix();
+			mat *= fixture.jointWeights[i][j];
+
+			position += mat.Transform(fixture.positions[i]);
+			normal += mat.Transform(fixture.normals[i], 0.f);
+		}
+
+		expectedPositions[i] = position;
+		expectedNormals[i] = normal.GetNormal();
+	}
+
+	SECTION("Single-threaded")
+	{
+		Nz::SkinLinearBlend(fixture.skinningData, 0, vertexCount);
+		fixture.CheckOutput(0, vertexCount, expectedPositions, expectedNormals);
+	}
+
+	SECTION("Single-threaded on a subrange")
+	{
+		Nz::SkinLinearBlend(fixture.skinningData, 100, 200);
+		fixture.CheckOutput(100, 300, expectedPositions, expectedNormals);
+		CHECK(fixture.outputPositions[99] == Nz::Vector3f::Zero());
+		CHECK(fixture.outputPositions[300] == Nz::Vector3f::Zero());
+	}
+
+	SECTION("Using precomputed skinning matrices")
+	{
+		std::vector<Nz::Matrix4f> skinningMatrices(jointCount);
+		Nz::ComputeSkinningMatrices(fixture.skeleton.GetJoints(), jointCount, skinningMatrices.data());
+
+		fixture.skinningData.skinningMatrices = skinningMatrices.data();
+		Nz::SkinLinearBlend(fixture.skinningData, 0, vertexCount);
+		fixture.CheckOutput(0, vertexCount, expectedPositions, expectedNormals);
+	}
+
+	SECTION("Multi-threaded")
+	{
+		Nz::TaskScheduler taskScheduler(4);
+		Nz::SkinLinearBlend(taskScheduler, fixture.skinningData, 0, vertexCount);
+		fixture.CheckOutput(0, vertexCount, expectedPositions, expectedNormals);
+	}
+}
+
+TEST_CASE("SkinDualQuaternion", "[CORE][ALGORITHM]")
+{
+	constexpr std::size_t jointCount = 8;
+	constexpr std::size_t vertexCount = 5003;
+
+	SkinningFixture fixture(jointCount, vertexCount, 1337);
+
+	WHEN("Each vertex is influenced by a single joint")
+	{
+		// Matches linear blend skinning
+		for (std::size_t i = 0; i < vertexCount; ++i)
+			fixture.jointWeights[i] = Nz::Vector4f(1.f, 0.f, 0.f, 0.f);
+
+		std::vector<Nz::Vector3f> expectedPositions(vertexCount);
+		std::vector<Nz::Vector3f> expectedNormals(vertexCount);
+
+		Nz::SkinningData linearBlendData = fixture.skinningData;
+		linearBlendData.outputPositions = expectedPositions.data();
+		linearBlendData.outputNormals = expectedNormals.data();
+		Nz::SkinLinearBlend(linearBlendData, 0, vertexCount);
+
+		SECTION("Single-threaded")
+		{
+			Nz::SkinDualQuaternion(fixture.skinningData, 0, vertexCount);
+			fixture.CheckOutput(0, vertexCount, expectedPositions, expectedNormals);
+		}
+
+		SECTION("Single-threaded on a subrange")
+		{
+			Nz::SkinDualQuaternion(fixture.skinningData, 1, 1002);
+			fixture.CheckOutput(1, 1003, expectedPositions, expectedNormals);
+			CHECK(fixture.outputPositions[0] == Nz::Vector3f::Zero());
+			CHECK(fixture.outputPositions[1003] == Nz::Vector3f::Zero());
+		}
+
+		SECTION("Using precomputed dual quaternions")
+		{
+			std::vector<Nz::SkinningDualQuaternion> dualQuaternions(jointCount);
+			Nz::ComputeSkinningDualQuaternions(fixture.skeleton.GetJoints(), jointCount, dualQuaternions.data());
+
+			fixture.skinningData.skinningDualQuaternions = dualQuaternions.data();
+			Nz::SkinDualQuaternion(fixture.skinningData, 0, vertexCount);
+			fixture.CheckOutput(0, vertexCount, expectedPositions, expectedNormals);
+		}
+
+		SECTION("Multi-threaded")
+		{
+			Nz::TaskScheduler taskScheduler(4);
+			Nz::Skin(taskScheduler, Nz::SkinningMode::DualQuaternion, fixture.skinningData, 0, vertexCount);
+			fixture.CheckOutput(0, vertexCount, expectedPositions, expectedNormals);
+		}
+	}
+
+	WHEN("Vertices are influenced by multiple joints")
+	{
+		Nz::Skin(Nz::SkinningMode::DualQuaternion, fixture.skinningData, 0, vertexCount);
+
+		THEN("Blended transformations stay rigid")
+		{
+			for (std::size_t i = 0; i < vertexCount; ++i)
+			{
+				INFO("vertex #" << i);
+				CHECK(fixture.outputNormals[i].GetLength() == Catch::Approx(1.f).margin(0.001f));
+			}
+		}
+
+		AND_THEN("Multi-threaded skinning produces the same result")
+		{
+			std::vector<Nz::Vector3f> singleThreadedPositions = fixture.outputPositions;
+
+			Nz::TaskScheduler taskScheduler(4);
+			Nz::SkinDualQuaternion(taskScheduler, fixture.skinningData, 0, vertexCount);
+
+			for (std::size_t i = 0; i < vertexCount; ++i)
+			{
+				INFO("vertex #" << i);
+				CHECK(fixture.outputPositions[i].ApproxEqual(singleThreadedPositions[i], 0.0001f));
+			}
+		}
+	}
+}
+
+TEST_CASE("SkinningMode", "[CORE][ALGORITHM]")
+{
+	// Two joints sharing the X axis, the second one twisted by 120 degrees around it
+	Nz::Skeleton skeleton;
+	skeleton.Create(2);
+	for (std::size_t i = 0; i < 2; ++i)
+	{
+		Nz::Joint* joint = skeleton.GetJoint(i);
+		joint->SetPosition(Nz::Vector3f::Zero());
+		joint->SetInverseBindMatrix(Nz::Matrix4f::Identity());
+	}
+	skeleton.GetJoint(0)->SetRotation(Nz::Quaternionf::Identity());
+	skeleton.GetJoint(1)->SetRotation(Nz::EulerAnglesf(Nz::DegreeAnglef(120.f), Nz::DegreeAnglef(0.f), Nz::DegreeAnglef(0.f)).ToQuaternion());
+
+	// Vertices around the twist axis, evenly weighted between both joints
+	constexpr std::size_t vertexCount = 4;
+
+	std::array<Nz::Vector3f, vertexCount> positions = {
+		Nz::Vector3f(0.f, 1.f, 0.f),
+		Nz::Vector3f(0.f, 0.f, 1.f),
+		Nz::Vector3f(1.f, -2.f, 0.f),
+		Nz::Vector3f(-1.f, 0.f, -2.f)
+	};
+	std::array<Nz::Vector3f, vertexCount> normals;
+	std::array<Nz::Vector4i32, vertexCount> jointIndices;
+	std::array<Nz::Vector4f, vertexCount> jointWeights;
+	for (std::size_t i = 0; i < vertexCount; ++i)
+	{
+		normals[i] = Nz::Vector3f(0.f, positions[i].y, positions[i].z).GetNormal();
+		jointIndices[i] = Nz::Vector4i32(0, 1, 0, 0);
+		jointWeights[i] = Nz::Vector4f(0.5f, 0.5f, 0.f, 0.f);
+	}
+
+	std::array<Nz::Vector3f, vertexCount> outputPositions;
+	std::array<Nz::Vector3f, vertexCount> outputNormals;
+
+	Nz::SkinningData skinningData;
+	skinningData.joints = skeleton.GetJoints();
+	skinningData.inputPositions = positions.data();
+	skinningData.inputNormals = normals.data();
+	skinningData.inputJointIndices = jointIndices.data();
+	skinningData.inputJointWeights = jointWeights.data();
+	skinningData.outputPositions = outputPositions.data();
+	skinningData.outputNormals = outputNormals.data();
+
+	auto DistanceToAxis = [](const Nz::Vector3f& position)
+	{
+		return Nz::Vector2f(position.y, position.z).GetLength();
+	};
+
+	WHEN("Using linear blending")
+	{
+		Nz::Skin(Nz::SkinningMode::LinearBlend, skinningData, 0, vertexCount);
+
+		THEN("The twist collapses vertices toward the axis")
+		{
+			// Averaging two rotations 120 degrees apart scales distances by cos(60)
+			for (std::size_t i = 0; i < vertexCount; ++i)
+			{
+				INFO("vertex #" << i);
+				CHECK(outputPositions[i].x == Catch::Approx(positions[i].x).margin(0.001f));
+				CHECK(DistanceToAxis(outputPositions[i]) == Catch::Approx(DistanceToAxis(positions[i]) * 0.5f).margin(0.001f));
+			}
+		}
+	}
+
+	WHEN("Using dual quaternion blending")
+	{
+		Nz::Skin(Nz::SkinningMode::DualQuaternion, skinningData, 0, vertexCount);
+
+		THEN("The twist preserves volume")
+		{
+			// Vertices are rotated halfway (60 degrees) around the axis instead
+			Nz::Quaternionf halfTwist = Nz::EulerAnglesf(Nz::DegreeAnglef(60.f), Nz::DegreeAnglef(0.f), Nz::DegreeAnglef(0.f)).ToQuaternion();
+			for (std::size_t i = 0; i < vertexCount; ++i)
+			{
+				INFO("vertex #" << i);
+				CHECK(DistanceToAxis(outputPositions[i]) == Catch::Approx(DistanceToAxis(positions[i])).margin(0.001f));
+				CHECK(outputPositions[i].ApproxEqual(halfTwist * positions[i], 0.001f));
+				CHECK(outputNormals[i].ApproxEqual(halfTwist * normals[i], 0.001f));
+			}
+		}
+	}
+}
@@ -0,0 +1,156 @@
+#include <Nazara/Core/AssetPack.hpp>
+#include <Nazara/Core/AssetPackBuilder.hpp>
+#include <Nazara/Core/VirtualDirectory.hpp>
+#include <Nazara/Core/VirtualDirectoryAssetPackResolver.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstring>
+#include <filesystem>
+#include <random>
+#include <set>
+
+TEST_CASE("AssetPack", "[Core][AssetPack]")
+{
+	std::mt19937 randomGenerator(42);
+
+	Nz::ByteArray randomData(4096);
+	for (std::size_t i = 0; i < randomData.GetSize(); ++i)
+		randomData[i] = static_cast<Nz::UInt8>(randomGenerator());
+
+	// Highly compressible data
+	Nz::ByteArray repeatedData(64 * 1024);
+	for (std::size_t i = 0; i < repeatedData.GetSize(); ++i)
+		repeatedData[i] = static_cast<Nz::UInt8>(i % 7);
+
+	const char* text = "Hello from an asset pack";
+	Nz::ByteArray textData(reinterpret_cast<const Nz::UInt8*>(text), std::strlen(text));
+
+	auto CheckContent = [](Nz::Stream& stream, const Nz::ByteArray& expectedData)
+	{
+		REQUIRE(stream.GetSize() == expectedData.GetSize());
+
+		Nz::ByteArray content(expectedData.GetSize());
+		CHECK(stream.Read(content.GetBuffer(), content.GetSize()) == content.GetSize());
+		CHECK(content == expectedData);
+	};
+
+	for (Nz::AssetPackCompression compression : { Nz::AssetPackCompression::None, Nz::AssetPackCompression::LZ4, Nz::AssetPackCompression::Zstd })
+	{
+		GIVEN("A pack built with compression " << Nz::UnderlyingCast(compression))
+		{
+			std::filesystem::path packPath = "AssetPackTest.nzpk";
+
+			Nz::AssetPackBuilder builder;
+			builder.AddEntry("Textures/noise.bin", randomData, compression);
+			builder.AddEntry("Textures/Pattern/repeated.bin", repeatedData, compression);
+			builder.AddEntry("\\readme.txt", textData, compression);
+			builder.AddEntry("Texts/empty.txt", Nz::ByteArray{}, compression);
+			REQUIRE(builder.GetEntryCount() == 4);
+			REQUIRE(builder.Build(packPath));
+
+			std::shared_ptr<Nz::AssetPack> pack = Nz::AssetPack::OpenFromFile(packPath);
+			REQUIRE(pack);
+			CHECK(pack->GetEntryCount() == 4);
+
+			WHEN("Looking up entries")
+			{
+				CHECK(pack->FindEntry("readme.txt"));
+				CHECK(pack->FindEntry("Textures/Pattern/repeated.bin"));
+				CHECK_FALSE(pack->FindEntry("Textures"));
+				CHECK_FALSE(pack->FindEntry("Textures/Pattern"));
+				CHECK_FALSE(pack->FindEntry("missing.bin"));
+			}
+
+			WHEN("Reading entries")
+			{
+				std::optional<std::size_t> noiseIndex = pack->FindEntry("Textures/noise.bin");
+				REQUIRE(noiseIndex);
+
+				// random data doesn't compress so it should always be stored as-is
+				const Nz::AssetPack::Entry& noiseEntry = pack->GetEntry(*noiseIndex);
+				CHECK(noiseEntry.compression == Nz::AssetPackCompression::None);
+				CHECK(reinterpret_cast<std::uintptr_t>(noiseEntry.data) % Nz::AssetPack::DataAlignment == 0);
+
+				std::shared_ptr<Nz::Stream> noiseStream = pack->OpenEntry(*noiseIndex);
+				REQUIRE(noiseStream);
+				CHECK(noiseStream->IsMemoryMapped());
+				CHECK(noiseStream->GetMappedPointer() == noiseEntry.data);
+				CheckContent(*noiseStream, randomData);
+
+				std::optional<std::size_t> repeatedIndex = pack->FindEntry("Textures/Pattern/repeated.bin");
+				REQUIRE(repeatedIndex);
+
+				const Nz::AssetPack::Entry& repeatedEntry = pack->GetEntry(*repeatedIndex);
+				CHECK(repeatedEntry.compression == compression);
+				CHECK(repeatedEntry.size == repeatedData.GetSize());
+				if (compression != Nz::AssetPackCompression::None)
+					CHECK(repeatedEntry.storedSize < repeatedEntry.size);
+
+				std::shared_ptr<Nz::Stream> repeatedStream = pack->OpenEntry(*repeatedIndex);
+				REQUIRE(repeatedStream);
+				CHECK(repeatedStream->IsMemoryMapped() == (compression == Nz::AssetPackCompression::None));
+				CheckContent(*repeatedStream, repeatedData);
+
+				std::optional<std::size_t> emptyIndex = pack->FindEntry("Texts/empty.txt");
+				REQUIRE(emptyIndex);
+				CHECK(pack->OpenEntry(*emptyIndex)->GetSize() == 0);
+			}
+
+			WHEN("Streams outlive the pack")
+			{
+				std::shared_ptr<Nz::Stream> textStream = pack->OpenEntry(*pack->FindEntry("readme.txt"));
+				pack.reset();
+
+				CheckContent(*textStream, textData);
+			}
+
+			WHEN("Using it through a virtual directory")
+			{
+				std::shared_ptr<Nz::VirtualDirectory> virtualDir = std::make_shared<Nz::VirtualDirectory>(std::make_shared<Nz::VirtualDirectoryAssetPackResolver>(pack));
+
+				CHECK(virtualDir->GetFileContent("readme.txt", [&](const void* data, std::size_t size)
+				{
+					return size == textData.GetSize() && std::memcmp(data, textData.GetConstBuffer(), size) == 0;
+				}));
+
+				CHECK(virtualDir->GetFileContent("Textures/Pattern/repeated.bin", [&](const void* data, std::size_t size)
+				{
+					return size == repeatedData.GetSize() && std::memcmp(data, repeatedData.GetConstBuffer(), size) == 0;
+				}));
+
+				CHECK_FALSE(virtualDir->GetEntry("Textures/missing.bin", [](const Nz::VirtualDirectory::Entry& /*entry*/) { return true; }));
+				CHECK_FALSE(virtualDir->GetEntry("Text", [](const Nz::VirtualDirectory::Entry& /*entry*/) { return true; }));
+
+				std::set<std::string> rootEntries;
+				virtualDir->ForEach([&](std::string_view name, const Nz::VirtualDirectory::Entry& entry)
+				{
+					if (name == "readme.txt")
+						CHECK(std::holds_alternative<Nz::VirtualDirectory::FileEntry>(entry));
+					else
+						CHECK(std::holds_alternative<Nz::VirtualDirectory::DirectoryEntry>(entry));
+
+					CHECK(rootEntries.emplace(name).second);
+				});
+				CHECK(rootEntries == std::set<std::string>{ "Texts", "Textures", "readme.txt" });
+
+				CHECK(virtualDir->GetDirectoryEntry("Textures", [&](const Nz::VirtualDirectory::DirectoryEntry& directoryEntry)
+				{
+					std::set<std::string> entries;
+					directoryEntry.directory->ForEach([&](std::string_view name, const Nz::VirtualDirectory::Entry& /*entry*/)
+					{
+						entries.emplace(name);
+					});
+
+					CHECK(entries == std::set<std::string>{ "Pattern", "noise.bin" });
+
+					return directoryEntry.directory->GetFileContent("Pattern/repeated.bin", [&](const void* /*data*/, std::size_t size)
+					{
+						return size == repeatedData.GetSize();
+					});
+				}));
+			}
+
+			pack.reset();
+			std::filesystem::remove(packPath);
+		}
+	}
+}
@@ -0,0 +1,146 @@
+#include <Nazara/Core/EnttSystemGraph.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <entt/entt.hpp>
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+namespace
+{
+	struct PositionComponent {};
+	struct VelocityComponent {};
+	struct HealthComponent {};
+
+	struct UpdateLog
+	{
+		std::mutex mutex;
+		std::vector<int> updates;
+
+		void Push(int systemId)
+		{
+			std::lock_guard lock(mutex);
+			updates.push_back(systemId);
+		}
+
+		std::size_t IndexOf(int systemId)
+		{
+			return std::find(updates.begin(), updates.end(), systemId) - updates.begin();
+		}
+	};
+
+	template<int Id, typename Read, typename Write, bool Concurrent = true>
+	struct TestSystem
+	{
+		static constexpr bool AllowConcurrent = Concurrent;
+		using ReadComponents = Read;
+		using WriteComponents = Write;
+
+		TestSystem(entt::registry& /*registry*/, UpdateLog& updateLog) :
+		log(updateLog)
+		{
+		}
+
+		void Update(Nz::Time /*elapsedTime*/)
+		{
+			log.Push(Id);
+		}
+
+		UpdateLog& log;
+	};
+
+	struct LateSystem
+	{
+		static constexpr Nz::Int64 ExecutionOrder = 10;
+		using Components = Nz::TypeList<PositionComponent>;
+
+		LateSystem(entt::registry& /*registry*/, UpdateLog& updateLog) :
+		log(updateLog)
+		{
+		}
+
+		void Update(Nz::Time /*elapsedTime*/)
+		{
+			log.Push(100);
+		}
+
+		UpdateLog& log;
+	};
+}
+
+SCENARIO("EnttSystemGraph", "[CORE][EnttSystemGraph]")
+{
+	using MovementSystem = TestSystem<1, Nz::TypeList<VelocityComponent>, Nz::TypeList<PositionComponent>>;
+	using HealthSystem = TestSystem<2, Nz::TypeList<>, Nz::TypeList<HealthComponent>>;
+	using PositionReaderSystem = TestSystem<3, Nz::TypeList<PositionComponent>, Nz::TypeList<>>;
+	using SequentialSystem = TestSystem<4, Nz::TypeList<>, Nz::TypeList<HealthComponent>, false>;
+
+	for (unsigned int workerCount : { 0, 1, 4 })
+	{
+		GIVEN("A system graph using a task scheduler with " << workerCount << " workers")
+		{
+			entt::registry registry;
+			Nz::TaskScheduler scheduler(workerCount);
+
+			UpdateLog log;
+
+			Nz::EnttSystemGraph systemGraph(registry);
+			systemGraph.SetTaskScheduler(&scheduler);
+			systemGraph.AddSystem<LateSystem>(log);
+			systemGraph.AddSystem<MovementSystem>(log);
+			systemGraph.AddSystem<HealthSystem>(log);
+			systemGraph.AddSystem<PositionReaderSystem>(log);
+			systemGraph.AddSystem<SequentialSystem>(log);
+
+			WHEN("We update it multiple times")
+			{
+				for (std::size_t i = 0; i < 20; ++i)
+				{
+					log.updates.clear();
+					systemGraph.Update(Nz::Time::Milliseconds(16));
+
+					REQUIRE(log.updates.size() == 5);
+
+					// every system should be updated once
+					for (int systemId : { 1, 2, 3, 4, 100 })
+						CHECK(std::count(log.updates.begin(), log.updates.end(), systemId) == 1);
+
+					// conflicting systems must be run in insertion order
+					CHECK(log.IndexOf(1) < log.IndexOf(3));
+
+					// non-concurrent systems split groups
+					CHECK(log.IndexOf(1) < log.IndexOf(4));
+					CHECK(log.IndexOf(2) < log.IndexOf(4));
+					CHECK(log.IndexOf(3) < log.IndexOf(4));
+
+					// execution order is respected
+					CHECK(log.updates.back() == 100);
+				}
+			}
+		}
+	}
+
+	GIVEN("A system graph without task scheduler")
+	{
+		entt::registry registry;
+		UpdateLog log;
+
+		Nz::EnttSystemGraph systemGraph(registry);
+		systemGraph.AddSystem<LateSystem>(log);
+		systemGraph.AddSystem<MovementSystem>(log);
+		systemGraph.AddSystem<HealthSystem>(log);
+		systemGraph.AddSystem<PositionReaderSystem>(log);
+		systemGraph.AddSystem<SequentialSystem>(log);
+
+		WHEN("We update it")
+		{
+			systemGraph.Update(Nz::Time::Milliseconds(16));
+
+			THEN("Systems are updated sequentially in execution then insertion order")
+			{
+				CHECK(log.updates == std::vector<int>{ 1, 2, 3, 4, 100 });
+			}
+		}
+	}
+}
@@ -1,6 +1,8 @@
 #include <Nazara/Core/File.hpp>
 #include <catch2/catch_approx.hpp>
 #include <catch2/catch_test_macros.hpp>
+#include <cstring>
+#include <string_view>
 
 std::filesystem::path GetAssetDir();
 
@@ -64,6 +66,56 @@ SCENARIO("File", "[CORE][FILE]")
 		}
 	}
 
+	GIVEN("A memory-mapped file")
+	{
+		const char content[] = "Memory-mapped content";
+		REQUIRE(Nz::File::WriteWhole("Mapped File.bin", content, sizeof(content) - 1));
+
+		Nz::File file("Mapped File.bin", Nz::OpenMode::Read | Nz::OpenMode::MemoryMapped);
+		REQUIRE(file.IsOpen());
+		CHECK(file.IsMemoryMapped());
+
+		WHEN("We access the mapping")
+		{
+			THEN("It holds the file content")
+			{
+				REQUIRE(file.GetSize() == sizeof(content) - 1);
+				CHECK(std::memcmp(file.GetMappedPointer(), content, sizeof(content) - 1) == 0);
+			}
+		}
+
+		WHEN("We read from it")
+		{
+			char buffer[6];
+			REQUIRE(file.Read(buffer, 6) == 6);
+			CHECK(std::string_view(buffer, 6) == "Memory");
+			CHECK(file.GetCursorPos() == 6);
+
+			file.SetCursorPos(file.GetSize() - 7);
+			REQUIRE(file.Read(buffer, 6) == 6);
+			CHECK(std::string_view(buffer, 6) == "conten");
+
+			THEN("Reading past the end is truncated")
+			{
+				CHECK(file.Read(buffer, 6) == 1);
+				CHECK(file.EndOfStream());
+			}
+		}
+
+		WHEN("We try to open it for writing")
+		{
+			Nz::File writeFile;
+			CHECK_FALSE(writeFile.Open("Mapped File.bin", Nz::OpenMode::Write | Nz::OpenMode::MemoryMapped));
+		}
+
+		WHEN("We close it")
+		{
+			file.Close();
+			CHECK(!file.IsMemoryMapped());
+			std::filesystem::remove("Mapped File.bin");
+		}
+	}
+
 	GIVEN("The test file")
 	{
 		REQUIRE(std::filesystem::exists(GetAssetDir() / "Core/FileTest.txt"));
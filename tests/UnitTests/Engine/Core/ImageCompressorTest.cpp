@@ -0,0 +1,272 @@
+#include <Nazara/Core/Image.hpp>
+#include <Nazara/Core/ImageCompressor.hpp>
+#include <Nazara/Core/PixelFormat.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <random>
+
+namespace
+{
+	void DecodeBC1Block(const Nz::UInt8* block, Nz::UInt8* pixels)
+	{
+		auto DecodeColor = [](Nz::UInt16 color, int* output)
+		{
+			int r = (color >> 11) & 0x1F;
+			int g = (color >> 5) & 0x3F;
+			int b = color & 0x1F;
+			output[0] = (r << 3) | (r >> 2);
+			output[1] = (g << 2) | (g >> 4);
+			output[2] = (b << 3) | (b >> 2);
+		};
+
+		Nz::UInt16 color0 = Nz::UInt16(block[0] | (block[1] << 8));
+		Nz::UInt16 color1 = Nz::UInt16(block[2] | (block[3] << 8));
+
+		int palette[4][3];
+		DecodeColor(color0, palette[0]);
+		DecodeColor(color1, palette[1]);
+		for (std::size_t c = 0; c < 3; ++c)
+		{
+			if (color0 > color1)
+			{
+				palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+				palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+			}
+			else
+			{
+				palette[2][c] = (palette[0][c] + palette[1][c]) / 2;
+				palette[3][c] = 0;
+			}
+		}
+
+		Nz::UInt32 indices = block[4] | (block[5] << 8) | (block[6] << 16) | (Nz::UInt32(block[7]) << 24);
+		for (std::size_t i = 0; i < 16; ++i)
+		{
+			for (std::size_t c = 0; c < 3; ++c)
+				pixels[i * 4 + c] = Nz::UInt8(palette[(indices >> (i * 2)) & 3][c]);
+		}
+	}
+
+	// Only decodes mode 6, the one used by the compressor
+	bool DecodeBC7Block(const Nz::UInt8* block, Nz::UInt8* pixels)
+	{
+		std::size_t bitOffset = 0;
+		auto ReadBits = [&](std::size_t bitCount)
+		{
+			unsigned int value = 0;
+			for (std::size_t i = 0; i < bitCount; ++i, ++bitOffset)
+				value |= ((block[bitOffset / 8] >> (bitOffset % 8)) & 1) << i;
+
+			return value;
+		};
+
+		if (ReadBits(7) != 0x40)
+			return false;
+
+		unsigned int endpoints[2][4];
+		for (std::size_t c = 0; c < 4; ++c)
+		{
+			endpoints[0][c] = ReadBits(7);
+			endpoints[1][c] = ReadBits(7);
+		}
+
+		unsigned int pBit0 = ReadBits(1);
+		unsigned int pBit1 = ReadBits(1);
+		for (std::size_t c = 0; c < 4; ++c)
+		{
+			endpoints[0][c] = (endpoints[0][c] << 1) | pBit0;
+			endpoints[1][c] = (endpoints[1][c] << 1) | pBit1;
+		}
+
+		constexpr std::array<unsigned int, 16> weights = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+		for (std::size_t i = 0; i < 16; ++i)
+		{
+			unsigned int index = ReadBits((i == 0) ? 3 : 4);
+			for (std::size_t c = 0; c < 4; ++c)
+				pixels[i * 4 + c] = Nz::UInt8(((64 - weights[index]) * endpoints[0][c] + weights[index] * endpoints[1][c] + 32) >> 6);
+		}
+
+		return true;
+	}
+
+	// Root mean square error over the first componentCount components of RGBA pixels
+	double ComputeRMSE(const Nz::UInt8* reference, const Nz::UInt8* decoded, std::size_t pixelCount, std::size_t componentCount)
+	{
+		double error = 0.0;
+		for (std::size_t i = 0; i < pixelCount; ++i)
+		{
+			for (std::size_t c = 0; c < componentCount; ++c)
+			{
+				double delta = double(reference[i * 4 + c]) - double(decoded[i * 4 + c]);
+				error += delta * delta;
+			}
+		}
+
+		return std::sqrt(error / (pixelCount * componentCount));
+	}
+}
+
+SCENARIO("ImageCompressor", "[CORE][ImageCompressor]")
+{
+	std::mt19937 randomGenerator(42);
+	std::uniform_int_distribution<int> noiseDis(-4, 4);
+
+	// Each block holds a noisy gradient, with red and blue going in opposite directions
+	auto GenerateBlock = [&]
+	{
+		std::array<Nz::UInt8, 16 * 4> block;
+		for (std::size_t i = 0; i < 16; ++i)
+		{
+			int t = int(i) * 4;
+			block[i * 4 + 0] = Nz::UInt8(std::clamp(40 + t + noiseDis(randomGenerator), 0, 255));
+			block[i * 4 + 1] = Nz::UInt8(std::clamp(100 + t / 2 + noiseDis(randomGenerator), 0, 255));
+			block[i * 4 + 2] = Nz::UInt8(std::clamp(220 - t + noiseDis(randomGenerator), 0, 255));
+			block[i * 4 + 3] = Nz::UInt8(std::clamp(255 - t / 3 + noiseDis(randomGenerator), 0, 255));
+		}
+
+		return block;
+	};
+
+	for (Nz::ImageCompressionQuality quality : { Nz::ImageCompressionQuality::Fast, Nz::ImageCompressionQuality::Normal, Nz::ImageCompressionQuality::High })
+	{
+		GIVEN("Compression quality " << int(quality))
+		{
+			std::array<Nz::UInt8, 16 * 4> block = GenerateBlock();
+			std::array<Nz::UInt8, 16 * 4> decoded = {};
+
+			WHEN("Compressing a block to BC1")
+			{
+				std::array<Nz::UInt8, 8> compressed;
+				Nz::ImageCompressor::RGBA8BlockToBC1(block, compressed, quality);
+				DecodeBC1Block(compressed.data(), decoded.data());
+
+				CHECK(ComputeRMSE(block.data(), decoded.data(), 16, 3) < 10.0);
+			}
+
+			WHEN("Compressing a block to BC7")
+			{
+				std::array<Nz::UInt8, 16> compressed;
+				Nz::ImageCompressor::RGBA8BlockToBC7(block, compressed, quality);
+				REQUIRE(DecodeBC7Block(compressed.data(), decoded.data()));
+
+				CHECK(ComputeRMSE(block.data(), decoded.data(), 16, 4) < ((quality == Nz::ImageCompressionQuality::Fast) ? 5.0 : 4.0));
+			}
+
+			WHEN("Compressing a uniform block to BC7, it stays uniform")
+			{
+				std::array<Nz::UInt8, 16 * 4> uniformBlock;
+				for (std::size_t i = 0; i < 16; ++i)
+				{
+					uniformBlock[i * 4 + 0] = 12;
+					uniformBlock[i * 4 + 1] = 97;
+					uniformBlock[i * 4 + 2] = 180;
+					uniformBlock[i * 4 + 3] = 255;
+				}
+
+				std::array<Nz::UInt8, 16> compressed;
+				Nz::ImageCompressor::RGBA8BlockToBC7(uniformBlock, compressed, quality);
+				REQUIRE(DecodeBC7Block(compressed.data(), decoded.data()));
+
+				// Both endpoints share their low bit between components, which can cost one unit of precision
+				for (std::size_t i = 0; i < 16 * 4; ++i)
+				{
+					CHECK(decoded[i] == decoded[i % 4]);
+					CHECK(std::abs(int(decoded[i]) - int(uniformBlock[i])) <= 1);
+				}
+			}
+		}
+	}
+
+	GIVEN("An image whose size is not a multiple of the block size")
+	{
+		constexpr Nz::UInt32 width = 13;
+		constexpr Nz::UInt32 height = 7;
+
+		Nz::Image image(Nz::ImageType::E2D, Nz::PixelFormat::RGBA8, width, height);
+		Nz::UInt8* pixels = image.GetPixels();
+		for (Nz::UInt32 y = 0; y < height; ++y)
+		{
+			for (Nz::UInt32 x = 0; x < width; ++x)
+			{
+				Nz::UInt8* pixel = &pixels[(y * width + x) * 4];
+				pixel[0] = Nz::UInt8(x * 5);
+				pixel[1] = Nz::UInt8(y * 9);
+				pixel[2] = 64;
+				pixel[3] = 255;
+			}
+		}
+
+		WHEN("Compressing it to BC7, edge blocks are compressed as well")
+		{
+			Nz::Image compressed = Nz::ImageCompressor::RGBA8ToBC7(image);
+			CHECK(compressed.GetFormat() == Nz::PixelFormat::BC7_Unorm);
+			CHECK(compressed.GetWidth() == 16);
+			CHECK(compressed.GetHeight() == 8);
+
+			const Nz::UInt8* blocks = compressed.GetConstPixels();
+			for (Nz::UInt32 blockY = 0; blockY < 2; ++blockY)
+			{
+				for (Nz::UInt32 blockX = 0; blockX < 4; ++blockX)
+				{
+					std::array<Nz::UInt8, 16 * 4> decoded;
+					REQUIRE(DecodeBC7Block(&blocks[(blockY * 4 + blockX) * 16], decoded.data()));
+
+					// Compare with the source pixels, clamped to the image edges
+					for (Nz::UInt32 y = 0; y < 4; ++y)
+					{
+						for (Nz::UInt32 x = 0; x < 4; ++x)
+						{
+							Nz::UInt32 sourceX = std::min(blockX * 4 + x, width - 1);
+							Nz::UInt32 sourceY = std::min(blockY * 4 + y, height - 1);
+							const Nz::UInt8* sourcePixel = &pixels[(sourceY * width + sourceX) * 4];
+							const Nz::UInt8* decodedPixel = &decoded[(y * 4 + x) * 4];
+							for (std::size_t c = 0; c < 4; ++c)
+								CHECK(std::abs(int(sourcePixel[c]) - int(decodedPixel[c])) <= 16);
+						}
+					}
+				}
+			}
+		}
+	}
+
+	for (unsigned int workerCount : { 1, 4 })
+	{
+		GIVEN("A task scheduler with " << workerCount << " workers")
+		{
+			Nz::TaskScheduler taskScheduler(workerCount);
+
+			Nz::Image image(Nz::ImageType::E2D_Array, Nz::PixelFormat::RGBA8, 70, 38, 3);
+			{
+				std::uniform_int_distribution<unsigned int> byteDis(0, 255);
+
+				Nz::UInt8* pixels = image.GetPixels();
+				std::size_t size = Nz::PixelFormatInfo::ComputeSize(Nz::PixelFormat::RGBA8, 70, 38, 3);
+				for (std::size_t i = 0; i < size; ++i)
+					pixels[i] = Nz::UInt8(byteDis(randomGenerator));
+			}
+
+			for (Nz::ImageCompressionQuality quality : { Nz::ImageCompressionQuality::Fast, Nz::ImageCompressionQuality::High })
+			{
+				WHEN("Compressing an image using the task scheduler with quality " << int(quality) << ", it gives the same result")
+				{
+					Nz::ImageCompressor::Settings settings;
+					settings.quality = quality;
+
+					Nz::Image serialBC3 = Nz::ImageCompressor::RGBA8ToBC3(image, settings);
+					Nz::Image serialBC7 = Nz::ImageCompressor::RGBA8ToBC7(image, settings);
+
+					settings.taskScheduler = &taskScheduler;
+					Nz::Image parallelBC3 = Nz::ImageCompressor::RGBA8ToBC3(image, settings);
+					Nz::Image parallelBC7 = Nz::ImageCompressor::RGBA8ToBC7(image, settings);
+
+					CHECK(std::memcmp(parallelBC3.GetConstPixels(), serialBC3.GetConstPixels(), Nz::PixelFormatInfo::ComputeSize(Nz::PixelFormat::BC3_Unorm, 72, 40, 3)) == 0);
+					CHECK(std::memcmp(parallelBC7.GetConstPixels(), serialBC7.GetConstPixels(), Nz::PixelFormatInfo::ComputeSize(Nz::PixelFormat::BC7_Unorm, 72, 40, 3)) == 0);
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,73 @@
+#include <Nazara/Core/ParallelAlgorithm.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+#include <vector>
+
+SCENARIO("ParallelAlgorithm", "[CORE][ParallelAlgorithm]")
+{
+	for (unsigned int workerCount : { 1, 2, 4, 8 })
+	{
+		GIVEN("A task scheduler with " << workerCount << " workers")
+		{
+			Nz::TaskScheduler scheduler(workerCount);
+
+			WHEN("We use ParallelFor over a range")
+			{
+				for (std::size_t elementCount : { 0, 1, 63, 64, 1000, 100'000 })
+				{
+					std::vector<unsigned int> values(elementCount, 0);
+					std::atomic_size_t processedCount = 0;
+
+					Nz::ParallelFor(scheduler, 0, elementCount, 64, [&](std::size_t chunkBegin, std::size_t chunkEnd)
+					{
+						CHECK(chunkBegin < chunkEnd);
+						for (std::size_t i = chunkBegin; i < chunkEnd; ++i)
+							values[i]++;
+
+						processedCount += chunkEnd - chunkBegin;
+					});
+
+					CHECK(processedCount == elementCount);
+					CHECK(std::all_of(values.begin(), values.end(), [](unsigned int value) { return value == 1; }));
+				}
+			}
+
+			WHEN("We use ParallelReduce to sum a range")
+			{
+				std::vector<Nz::UInt64> values(123'457);
+				std::iota(values.begin(), values.end(), Nz::UInt64(1));
+
+				Nz::UInt64 sum = Nz::ParallelReduce(scheduler, 0, values.size(), 128, Nz::UInt64(0), [&](std::size_t chunkBegin, std::size_t chunkEnd)
+				{
+					return std::accumulate(values.begin() + chunkBegin, values.begin() + chunkEnd, Nz::UInt64(0));
+				},
+				[](Nz::UInt64 lhs, Nz::UInt64 rhs)
+				{
+					return lhs + rhs;
+				});
+
+				CHECK(sum == Nz::UInt64(values.size()) * (values.size() + 1) / 2);
+			}
+
+			WHEN("We nest ParallelFor calls")
+			{
+				std::atomic_uint counter = 0;
+				Nz::ParallelFor(scheduler, 0, 16, 1, [&](std::size_t chunkBegin, std::size_t chunkEnd)
+				{
+					for (std::size_t i = chunkBegin; i < chunkEnd; ++i)
+					{
+						Nz::ParallelFor(scheduler, 0, 1024, 16, [&](std::size_t innerBegin, std::size_t innerEnd)
+						{
+							counter += static_cast<unsigned int>(innerEnd - innerBegin);
+						});
+					}
+				});
+
+				CHECK(counter == 16 * 1024);
+			}
+		}
+	}
+}
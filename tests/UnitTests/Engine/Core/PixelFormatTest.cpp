@@ -0,0 +1,168 @@
+#include <Nazara/Core/Color.hpp>
+#include <Nazara/Core/Image.hpp>
+#include <Nazara/Core/PixelFormat.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+SCENARIO("PixelFormat", "[CORE][PixelFormat]")
+{
+	std::mt19937 randomGenerator(42);
+	std::uniform_int_distribution<unsigned int> byteDis(0, 255);
+
+	auto GenerateBytes = [&](std::size_t size)
+	{
+		std::vector<Nz::UInt8> bytes(size);
+		for (Nz::UInt8& value : bytes)
+			value = static_cast<Nz::UInt8>(byteDis(randomGenerator));
+
+		return bytes;
+	};
+
+	auto Convert = [](Nz::PixelFormat srcFormat, Nz::PixelFormat dstFormat, const std::vector<Nz::UInt8>& src)
+	{
+		std::size_t pixelCount = src.size() / Nz::PixelFormatInfo::GetBytesPerPixel(srcFormat);
+
+		std::vector<Nz::UInt8> dst(pixelCount * Nz::PixelFormatInfo::GetBytesPerPixel(dstFormat));
+		REQUIRE(Nz::PixelFormatInfo::Convert(srcFormat, dstFormat, src.data(), src.data() + src.size(), dst.data()));
+
+		return dst;
+	};
+
+	// Odd pixel counts make sure the remaining pixels of vectorized conversions are handled
+	for (std::size_t pixelCount : { 1, 3, 7, 16, 33, 1000 })
+	{
+		GIVEN(pixelCount << " pixels")
+		{
+			WHEN("Converting between RGB8 and RGBA8")
+			{
+				std::vector<Nz::UInt8> rgb = GenerateBytes(pixelCount * 3);
+				std::vector<Nz::UInt8> rgba = Convert(Nz::PixelFormat::RGB8, Nz::PixelFormat::RGBA8, rgb);
+
+				for (std::size_t i = 0; i < pixelCount; ++i)
+				{
+					CHECK(rgba[i * 4 + 0] == rgb[i * 3 + 0]);
+					CHECK(rgba[i * 4 + 1] == rgb[i * 3 + 1]);
+					CHECK(rgba[i * 4 + 2] == rgb[i * 3 + 2]);
+					CHECK(rgba[i * 4 + 3] == 0xFF);
+				}
+
+				CHECK(Convert(Nz::PixelFormat::RGBA8, Nz::PixelFormat::RGB8, rgba) == rgb);
+			}
+
+			WHEN("Converting between RGBA8 and BGRA8")
+			{
+				std::vector<Nz::UInt8> rgba = GenerateBytes(pixelCount * 4);
+				std::vector<Nz::UInt8> bgra = Convert(Nz::PixelFormat::RGBA8, Nz::PixelFormat::BGRA8, rgba);
+
+				for (std::size_t i = 0; i < pixelCount; ++i)
+				{
+					CHECK(bgra[i * 4 + 0] == rgba[i * 4 + 2]);
+					CHECK(bgra[i * 4 + 1] == rgba[i * 4 + 1]);
+					CHECK(bgra[i * 4 + 2] == rgba[i * 4 + 0]);
+					CHECK(bgra[i * 4 + 3] == rgba[i * 4 + 3]);
+				}
+
+				CHECK(Convert(Nz::PixelFormat::BGRA8, Nz::PixelFormat::RGBA8, bgra) == rgba);
+			}
+
+			WHEN("Converting between RGBA8 and RGBA32F")
+			{
+				std::vector<Nz::UInt8> rgba = GenerateBytes(pixelCount * 4);
+				std::vector<Nz::UInt8> rgbaFloat = Convert(Nz::PixelFormat::RGBA8, Nz::PixelFormat::RGBA32F, rgba);
+
+				const float* values = reinterpret_cast<const float*>(rgbaFloat.data());
+				for (std::size_t i = 0; i < pixelCount * 4; ++i)
+					CHECK(values[i] == Catch::Approx(rgba[i] / 255.f));
+
+				CHECK(Convert(Nz::PixelFormat::RGBA32F, Nz::PixelFormat::RGBA8, rgbaFloat) == rgba);
+			}
+
+			WHEN("Converting between RGBA8_SRGB and RGBA32F")
+			{
+				std::vector<Nz::UInt8> rgba = GenerateBytes(pixelCount * 4);
+				std::vector<Nz::UInt8> rgbaFloat = Convert(Nz::PixelFormat::RGBA8_SRGB, Nz::PixelFormat::RGBA32F, rgba);
+
+				const float* values = reinterpret_cast<const float*>(rgbaFloat.data());
+				for (std::size_t i = 0; i < pixelCount * 4; ++i)
+				{
+					if (i % 4 == 3)
+						CHECK(values[i] == Catch::Approx(rgba[i] / 255.f));
+					else
+						CHECK(values[i] == Catch::Approx(Nz::Color::sRGBToLinear(rgba[i] / 255.f)));
+				}
+
+				CHECK(Convert(Nz::PixelFormat::RGBA32F, Nz::PixelFormat::RGBA8_SRGB, rgbaFloat) == rgba);
+			}
+		}
+	}
+
+	GIVEN("Out of range floats")
+	{
+		std::vector<Nz::UInt8> rgbaFloat(32 * 4 * sizeof(float));
+
+		float* values = reinterpret_cast<float*>(rgbaFloat.data());
+		for (std::size_t i = 0; i < 32 * 4; ++i)
+		{
+			switch (i % 4)
+			{
+				case 0: values[i] = -1.f; break;
+				case 1: values[i] = 2.f; break;
+				case 2: values[i] = std::numeric_limits<float>::quiet_NaN(); break;
+				case 3: values[i] = 0.5f; break;
+			}
+		}
+
+		WHEN("Converting them to RGBA8, they are clamped")
+		{
+			std::vector<Nz::UInt8> rgba = Convert(Nz::PixelFormat::RGBA32F, Nz::PixelFormat::RGBA8, rgbaFloat);
+			for (std::size_t i = 0; i < 32; ++i)
+			{
+				CHECK(rgba[i * 4 + 0] == 0);
+				CHECK(rgba[i * 4 + 1] == 255);
+				CHECK(rgba[i * 4 + 2] == 0);
+				CHECK(rgba[i * 4 + 3] == 128);
+			}
+		}
+	}
+
+	for (unsigned int workerCount : { 1, 4 })
+	{
+		GIVEN("A task scheduler with " << workerCount << " workers")
+		{
+			Nz::TaskScheduler taskScheduler(workerCount);
+
+			constexpr Nz::UInt32 width = 317;
+			constexpr Nz::UInt32 height = 211;
+
+			std::vector<Nz::UInt8> rgb = GenerateBytes(width * height * 3);
+
+			WHEN("Converting pixels using the task scheduler, it gives the same result")
+			{
+				std::vector<Nz::UInt8> rgba(width * height * 4);
+				REQUIRE(Nz::PixelFormatInfo::Convert(taskScheduler, Nz::PixelFormat::RGB8, Nz::PixelFormat::RGBA8, rgb.data(), rgb.data() + rgb.size(), rgba.data()));
+
+				CHECK(rgba == Convert(Nz::PixelFormat::RGB8, Nz::PixelFormat::RGBA8, rgb));
+			}
+
+			WHEN("Converting an image using the task scheduler, it gives the same result")
+			{
+				Nz::Image image(Nz::ImageType::E2D_Array, Nz::PixelFormat::RGB8, width, height, 3);
+				for (Nz::UInt32 z = 0; z < 3; ++z)
+					std::memcpy(image.GetPixels(0, 0, z), rgb.data(), rgb.size());
+
+				Nz::Image parallelImage(image);
+				REQUIRE(image.ConvertTo(Nz::PixelFormat::RGBA32F));
+				REQUIRE(parallelImage.ConvertTo(taskScheduler, Nz::PixelFormat::RGBA32F));
+
+				CHECK(parallelImage.GetFormat() == Nz::PixelFormat::RGBA32F);
+				CHECK(std::memcmp(parallelImage.GetConstPixels(), image.GetConstPixels(), Nz::PixelFormatInfo::ComputeSize(Nz::PixelFormat::RGBA32F, width, height, 3)) == 0);
+			}
+		}
+	}
+}
@@ -0,0 +1,231 @@
+#include <Nazara/Core/File.hpp>
+#include <Nazara/Core/Resource.hpp>
+#include <Nazara/Core/ResourceManager.hpp>
+#include <Nazara/Core/ResourceParameters.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	struct TestResource : Nz::Resource
+	{
+		std::string content;
+	};
+
+	struct TestResourceParams : Nz::ResourceParameters
+	{
+		bool IsValid() const
+		{
+			return true;
+		}
+	};
+
+	using TestResourceLoader = Nz::ResourceLoader<TestResource, TestResourceParams>;
+	using TestResourceManager = Nz::ResourceManager<TestResource, TestResourceParams>;
+}
+
+SCENARIO("ResourceManager", "[CORE][ResourceManager]")
+{
+	std::filesystem::path directory = std::filesystem::current_path() / "ResourceManagerTest";
+	std::filesystem::create_directories(directory);
+
+	std::vector<std::filesystem::path> filePaths;
+	for (std::size_t i = 0; i < 8; ++i)
+	{
+		std::filesystem::path filePath = directory / ("resource_" + std::to_string(i) + ".txt");
+		std::string content = "resource #" + std::to_string(i);
+		REQUIRE(Nz::File::WriteWhole(filePath, content.data(), content.size()));
+
+		filePaths.push_back(std::move(filePath));
+	}
+
+	std::atomic_uint loadCount = 0;
+	std::mutex loadOrderMutex;
+	std::vector<std::filesystem::path> loadOrder;
+
+	TestResourceLoader loader;
+
+	TestResourceLoader::Entry loaderEntry;
+	loaderEntry.extensionSupport = [](std::string_view extension) { return extension == ".txt"; };
+	loaderEntry.fileLoader = [&](const std::filesystem::path& filePath, const TestResourceParams& /*parameters*/) -> Nz::Result<std::shared_ptr<TestResource>, Nz::ResourceLoadingError>
+	{
+		loadCount++;
+		{
+			std::lock_guard lock(loadOrderMutex);
+			loadOrder.push_back(filePath);
+		}
+
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+		std::optional<std::vector<Nz::UInt8>> content = Nz::File::ReadWhole(filePath);
+		if (!content)
+			return Nz::Err(Nz::ResourceLoadingError::FailedToOpenFile);
+
+		auto resource = std::make_shared<TestResource>();
+		resource->content.assign(content->begin(), content->end());
+
+		return resource;
+	};
+	loader.RegisterLoader(std::move(loaderEntry));
+
+	GIVEN("A resource manager with a task scheduler")
+	{
+		Nz::TaskScheduler scheduler(4);
+		TestResourceManager manager(loader, &scheduler);
+
+		WHEN("We load resources asynchronously")
+		{
+			std::vector<TestResourceManager::AsyncHandle> handles;
+			for (const std::filesystem::path& filePath : filePaths)
+				handles.push_back(manager.GetAsync(filePath));
+
+			THEN("Every resource gets loaded")
+			{
+				for (std::size_t i = 0; i < handles.size(); ++i)
+				{
+					std::shared_ptr<TestResource> resource = handles[i].Wait();
+					REQUIRE(resource);
+					CHECK(resource->content == "resource #" + std::to_string(i));
+					CHECK(handles[i].IsFinished());
+					CHECK(!handles[i].IsCancelled());
+				}
+
+				CHECK(loadCount == filePaths.size());
+			}
+
+			AND_THEN("Loaded resources are cached")
+			{
+				for (auto& handle : handles)
+					handle.Wait();
+
+				for (std::size_t i = 0; i < handles.size(); ++i)
+					CHECK(manager.Get(filePaths[i]) == handles[i].GetResource());
+
+				TestResourceManager::AsyncHandle handle = manager.GetAsync(filePaths.front());
+				CHECK(handle.IsFinished());
+				CHECK(handle.GetResource() == handles.front().GetResource());
+
+				CHECK(loadCount == filePaths.size());
+			}
+		}
+
+		WHEN("We request the same resource multiple times concurrently")
+		{
+			std::vector<TestResourceManager::AsyncHandle> handles;
+			for (int i = 0; i < 16; ++i)
+				handles.push_back(manager.GetAsync(filePaths.front(), i));
+
+			THEN("It's only loaded once")
+			{
+				std::shared_ptr<TestResource> resource = handles.front().Wait();
+				REQUIRE(resource);
+
+				for (auto& handle : handles)
+					CHECK(handle.Wait() == resource);
+
+				CHECK(loadCount == 1);
+			}
+		}
+	}
+
+	GIVEN("A resource manager with a busy task scheduler")
+	{
+		Nz::TaskScheduler scheduler(1);
+		TestResourceManager manager(loader, &scheduler);
+
+		// Keep the only worker busy so loads stay pending
+		std::atomic_bool releaseWorker = false;
+		scheduler.AddTask([&] { releaseWorker.wait(false); });
+
+		WHEN("We cancel a pending load")
+		{
+			TestResourceManager::AsyncHandle handle = manager.GetAsync(filePaths.front());
+			CHECK(handle.Cancel());
+
+			releaseWorker = true;
+			releaseWorker.notify_all();
+
+			THEN("It is never loaded")
+			{
+				CHECK(handle.IsCancelled());
+				CHECK(handle.IsFinished());
+				CHECK(!handle.Wait());
+
+				scheduler.WaitForTasks();
+				CHECK(loadCount == 0);
+			}
+		}
+
+		WHEN("Only one of two requests for the same resource is cancelled")
+		{
+			TestResourceManager::AsyncHandle first = manager.GetAsync(filePaths.front());
+			TestResourceManager::AsyncHandle second = manager.GetAsync(filePaths.front());
+			CHECK(!first.Cancel());
+
+			releaseWorker = true;
+			releaseWorker.notify_all();
+
+			THEN("The resource is still loaded")
+			{
+				CHECK(second.Wait());
+				CHECK(loadCount == 1);
+			}
+		}
+
+		WHEN("We queue loads with different priorities")
+		{
+			std::vector<TestResourceManager::AsyncHandle> handles;
+			for (std::size_t i = 0; i < filePaths.size(); ++i)
+				handles.push_back(manager.GetAsync(filePaths[i], static_cast<int>(i)));
+
+			releaseWorker = true;
+			releaseWorker.notify_all();
+
+			THEN("Higher priority loads are started first")
+			{
+				scheduler.WaitForTasks();
+
+				// Loads are performed by the only worker, from the highest priority (last file) to the lowest
+				REQUIRE(loadOrder.size() == filePaths.size());
+				for (std::size_t i = 0; i < filePaths.size(); ++i)
+					CHECK(loadOrder[i] == std::filesystem::canonical(filePaths[filePaths.size() - i - 1]));
+
+				for (auto& handle : handles)
+					CHECK(handle.IsFinished());
+			}
+		}
+
+		releaseWorker = true;
+		releaseWorker.notify_all();
+		scheduler.WaitForTasks();
+	}
+
+	GIVEN("A resource manager without task scheduler")
+	{
+		TestResourceManager manager(loader);
+
+		WHEN("We load a resource asynchronously")
+		{
+			TestResourceManager::AsyncHandle handle = manager.GetAsync(filePaths.front());
+
+			THEN("It's loaded immediately")
+			{
+				CHECK(handle.IsFinished());
+				REQUIRE(handle.GetResource());
+				CHECK(handle.GetResource()->content == "resource #0");
+				CHECK(manager.Get(filePaths.front()) == handle.GetResource());
+				CHECK(loadCount == 1);
+			}
+		}
+	}
+
+	std::filesystem::remove_all(directory);
+}
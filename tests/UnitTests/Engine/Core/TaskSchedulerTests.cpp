@@ -1,8 +1,10 @@
 #include <Nazara/Core/TaskScheduler.hpp>
 #include <catch2/catch_get_random_seed.hpp>
 #include <catch2/catch_test_macros.hpp>
+#include <array>
 #include <atomic>
 #include <chrono>
+#include <memory>
 #include <random>
 #include <thread>
 
@@ -23,6 +25,28 @@ SCENARIO("TaskScheduler", "[CORE][TaskScheduler]")
 				CHECK(executed);
 			}
 
+			WHEN("We add tasks with move-only or big captures")
+			{
+				auto movedValue = std::make_unique<int>(42);
+				std::array<Nz::UInt64, 32> bigCapture;
+				bigCapture.fill(1);
+
+				static_assert(!Nz::TaskScheduler::Task::FitsInline<decltype(bigCapture)>);
+
+				int movedResult = 0;
+				Nz::UInt64 bigResult = 0;
+				scheduler.AddTask([&movedResult, value = std::move(movedValue)] { movedResult = *value; });
+				scheduler.AddTask([&bigResult, bigCapture]
+				{
+					for (Nz::UInt64 value : bigCapture)
+						bigResult += value;
+				});
+				scheduler.WaitForTasks();
+
+				CHECK(movedResult == 42);
+				CHECK(bigResult == bigCapture.size());
+			}
+
 			WHEN("We add time-consuming tasks, they are split between workers")
 			{
 				std::atomic_uint count = 0;
@@ -66,6 +90,155 @@ SCENARIO("TaskScheduler", "[CORE][TaskScheduler]")
 					CHECK(completionBuffer[i] == 1);
 				}
 			}
+
+			if (scheduler.GetWorkerCount() > 1) //< the slow task would prevent other tasks from running with a single worker
+			{
+				WHEN("We use task groups, each group can be waited independently")
+				{
+					std::atomic_bool releaseSlowTask = false;
+					std::atomic_uint fastCount = 0;
+
+					Nz::TaskScheduler::TaskGroup slowGroup;
+					scheduler.AddTask(slowGroup, [&]
+					{
+						while (!releaseSlowTask)
+							std::this_thread::yield();
+					});
+
+					Nz::TaskScheduler::TaskGroup fastGroup;
+					for (unsigned int i = 0; i < 64; ++i)
+						scheduler.AddTask(fastGroup, [&] { fastCount++; });
+
+					fastGroup.Wait();
+					CHECK(fastGroup.IsFinished());
+					CHECK(fastCount == 64);
+					CHECK_FALSE(slowGroup.IsFinished());
+
+					releaseSlowTask = true;
+					slowGroup.Wait();
+					CHECK(slowGroup.IsFinished());
+					CHECK(slowGroup.GetRemainingTaskCount() == 0);
+				}
+			}
+
+			WHEN("We wait for tasks while participating, the waiting thread runs tasks as well")
+			{
+				std::atomic_bool flag = false;
+				std::atomic_uint count = 0;
+
+				// Occupy every worker until the flag is set
+				for (unsigned int i = 0; i < scheduler.GetWorkerCount(); ++i)
+				{
+					scheduler.AddTask([&]
+					{
+						while (!flag)
+							std::this_thread::yield();
+
+						count++;
+					});
+				}
+
+				Nz::TaskScheduler::TaskGroup group;
+				Nz::TaskScheduler::TaskHandle flagTask = scheduler.AddTask(group, [&] { flag = true; });
+
+				scheduler.WaitForTask(flagTask, Nz::TaskScheduler::WaitMode::Participate);
+				CHECK(flag);
+
+				scheduler.WaitForTasks(group, Nz::TaskScheduler::WaitMode::Participate);
+				scheduler.WaitForTasks(Nz::TaskScheduler::WaitMode::Participate);
+				CHECK(count == scheduler.GetWorkerCount());
+			}
+
+			WHEN("We add tasks with dependencies, they are run after their dependencies")
+			{
+				std::atomic_uint counter = 0;
+				unsigned int firstValue = 0;
+				unsigned int secondValue = 0;
+				unsigned int joinValue = 0;
+
+				Nz::TaskScheduler::TaskHandle first = scheduler.AddTask([&]
+				{
+					std::this_thread::sleep_for(std::chrono::milliseconds(10));
+					firstValue = ++counter;
+				}, {});
+
+				Nz::TaskScheduler::TaskHandle second = scheduler.AddContinuation(first, [&] { secondValue = ++counter; });
+				Nz::TaskScheduler::TaskHandle other = scheduler.AddTask([&] { counter++; }, {});
+
+				std::array dependencies = { second, other };
+				Nz::TaskScheduler::TaskHandle join = scheduler.AddTask([&] { joinValue = ++counter; }, dependencies);
+
+				join.Wait();
+				CHECK(first.IsFinished());
+				CHECK(second.IsFinished());
+				CHECK(other.IsFinished());
+				CHECK(join.IsFinished());
+				CHECK(firstValue < secondValue);
+				CHECK(joinValue == 4);
+
+				THEN("A continuation of an already finished task is run as well")
+				{
+					bool executed = false;
+					scheduler.AddContinuation(join, [&] { executed = true; }).Wait();
+					CHECK(executed);
+				}
+			}
+
+			WHEN("We chain a lot of continuations")
+			{
+				constexpr std::size_t taskCount = 256;
+
+				std::vector<std::size_t> order;
+				Nz::TaskScheduler::TaskGroup group;
+				Nz::TaskScheduler::TaskHandle previous = scheduler.AddTask(group, [&] { order.push_back(0); });
+				for (std::size_t i = 1; i < taskCount; ++i)
+					previous = scheduler.AddContinuation(group, previous, [&, i] { order.push_back(i); });
+
+				group.Wait();
+				REQUIRE(order.size() == taskCount);
+				for (std::size_t i = 0; i < taskCount; ++i)
+					CHECK(order[i] == i);
+
+				scheduler.WaitForTasks();
+			}
+		}
+	}
+
+	GIVEN("A task scheduler with a spin and yield backoff")
+	{
+		Nz::TaskScheduler::WorkerBackoff workerBackoff;
+		workerBackoff.spinCount = 64;
+		workerBackoff.yieldCount = 8;
+
+		Nz::TaskScheduler scheduler(4, workerBackoff);
+		CHECK(scheduler.GetWorkerBackoff().spinCount == 64);
+		CHECK(scheduler.GetWorkerBackoff().yieldCount == 8);
+
+		WHEN("We add bursts of tasks")
+		{
+			std::atomic_uint count = 0;
+			for (unsigned int burst = 0; burst < 100; ++burst)
+			{
+				for (unsigned int i = 0; i < 16; ++i)
+					scheduler.AddTask([&] { count++; });
+
+				scheduler.WaitForTasks(Nz::TaskScheduler::WaitMode::Participate);
+			}
+
+			CHECK(count == 100 * 16);
+		}
+
+		WHEN("We disable the backoff")
+		{
+			scheduler.SetWorkerBackoff({});
+			CHECK(scheduler.GetWorkerBackoff().spinCount == 0);
+			CHECK(scheduler.GetWorkerBackoff().yieldCount == 0);
+
+			bool executed = false;
+			scheduler.AddTask([&] { executed = true; });
+			scheduler.WaitForTasks();
+
+			CHECK(executed);
 		}
 	}
 }
@@ -0,0 +1,157 @@
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <Nazara/Graphics/LightClusterGrid.hpp>
+#include <Nazara/Math/Angle.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+SCENARIO("LightClusterGrid", "[GRAPHICS][LIGHTCLUSTERGRID]")
+{
+	Nz::Matrix4f projectionMatrix = Nz::Matrix4f::Perspective(Nz::DegreeAnglef(90.f), 1.f, 1.f, 100.f);
+
+	GIVEN("A 4x4x8 cluster grid")
+	{
+		Nz::LightClusterGrid clusterGrid(Nz::Vector3ui(4, 4, 8));
+
+		WHEN("Computing depth slices")
+		{
+			clusterGrid.Build(Nz::Matrix4f::Identity(), projectionMatrix, 1.f, 100.f, {});
+
+			CHECK(clusterGrid.ComputeDepthSlice(0.5f) == 0);
+			CHECK(clusterGrid.ComputeDepthSlice(2.f) == 1);
+			CHECK(clusterGrid.ComputeDepthSlice(10.5f) == 4);
+			CHECK(clusterGrid.ComputeDepthSlice(99.f) == 7);
+			CHECK(clusterGrid.ComputeDepthSlice(1000.f) == 7);
+			CHECK(clusterGrid.GetLightIndices().empty());
+		}
+
+		WHEN("Assigning lights")
+		{
+			std::vector<Nz::LightClusterGrid::LightSphere> lights = {
+				{ Nz::Spheref(Nz::Vector3f(0.f, 0.f, -10.f), 0.5f), 42 }, //< center of the screen
+				{ Nz::Spheref(Nz::Vector3f(0.f, 0.f, 10.f), 1.f), 7 },    //< behind the camera
+				{ Nz::Spheref(Nz::Vector3f(-8.f, -8.f, -10.f), 0.5f), 3 } //< in a screen corner
+			};
+
+			clusterGrid.Build(Nz::Matrix4f::Identity(), projectionMatrix, 1.f, 100.f, lights);
+
+			THEN("Lights are only assigned to the clusters they touch")
+			{
+				// Depth 9.5 to 10.5 spans slices 3 and 4, center light touches the four central tiles
+				for (Nz::UInt32 z = 3; z <= 4; ++z)
+				{
+					for (Nz::UInt32 y = 1; y <= 2; ++y)
+					{
+						for (Nz::UInt32 x = 1; x <= 2; ++x)
+						{
+							std::span<const Nz::UInt32> clusterLights = clusterGrid.GetClusterLights(x, y, z);
+							REQUIRE(clusterLights.size() == 1);
+							CHECK(clusterLights[0] == 42);
+						}
+					}
+				}
+
+				CHECK(clusterGrid.GetClusterLights(0, 0, 0).empty());
+				CHECK(clusterGrid.GetClusterLights(1, 1, 0).empty());
+				CHECK(clusterGrid.GetClusterLights(1, 1, 5).empty());
+
+				std::size_t cornerLightCount = 0;
+				std::size_t centerLightCount = 0;
+				for (Nz::UInt32 lightIndex : clusterGrid.GetLightIndices())
+				{
+					CHECK(lightIndex != 7);
+					if (lightIndex == 3)
+						cornerLightCount++;
+					else if (lightIndex == 42)
+						centerLightCount++;
+				}
+
+				CHECK(centerLightCount == 8);
+				CHECK(cornerLightCount > 0);
+				// Projection flips the Y axis
+				CHECK(clusterGrid.GetClusterLights(0, 3, 3).size() + clusterGrid.GetClusterLights(0, 3, 4).size() > 0);
+			}
+
+			AND_WHEN("Using a task scheduler")
+			{
+				std::vector<Nz::UInt32> expectedIndices(clusterGrid.GetLightIndices().begin(), clusterGrid.GetLightIndices().end());
+				std::vector<Nz::LightClusterGrid::Cluster> expectedClusters(clusterGrid.GetClusters().begin(), clusterGrid.GetClusters().end());
+
+				Nz::TaskScheduler taskScheduler(4);
+				clusterGrid.Build(Nz::Matrix4f::Identity(), projectionMatrix, 1.f, 100.f, lights, &taskScheduler);
+
+				THEN("Output is identical")
+				{
+					REQUIRE(clusterGrid.GetLightIndices().size() == expectedIndices.size());
+					CHECK(std::equal(expectedIndices.begin(), expectedIndices.end(), clusterGrid.GetLightIndices().begin()));
+
+					REQUIRE(clusterGrid.GetClusters().size() == expectedClusters.size());
+					for (std::size_t i = 0; i < expectedClusters.size(); ++i)
+					{
+						CHECK(clusterGrid.GetClusters()[i].firstLightIndex == expectedClusters[i].firstLightIndex);
+						CHECK(clusterGrid.GetClusters()[i].lightCount == expectedClusters[i].lightCount);
+					}
+				}
+			}
+		}
+
+		WHEN("Lights are farther than the max depth")
+		{
+			clusterGrid.UpdateMaxDepth(50.f);
+
+			Nz::Matrix4f infiniteProjectionMatrix = Nz::Matrix4f::Perspective(Nz::DegreeAnglef(90.f), 1.f, 1.f, std::numeric_limits<float>::infinity());
+
+			std::vector<Nz::LightClusterGrid::LightSphere> lights = {
+				{ Nz::Spheref(Nz::Vector3f(0.f, 0.f, -200.f), 1.f), 1 }
+			};
+
+			clusterGrid.Build(Nz::Matrix4f::Identity(), infiniteProjectionMatrix, 1.f, std::numeric_limits<float>::infinity(), lights);
+
+			THEN("They are assigned to the last depth slice")
+			{
+				std::span<const Nz::UInt32> clusterLights = clusterGrid.GetClusterLights(1, 1, 7);
+				REQUIRE(clusterLights.size() == 1);
+				CHECK(clusterLights[0] == 1);
+
+				CHECK(clusterGrid.GetClusterLights(1, 1, 6).empty());
+			}
+		}
+
+		WHEN("Using an orthographic projection with a negative near plane")
+		{
+			Nz::Matrix4f orthoMatrix = Nz::Matrix4f::Ortho(-10.f, 10.f, 10.f, -10.f, -1.f, 1.f);
+
+			std::vector<Nz::LightClusterGrid::LightSphere> lights = {
+				{ Nz::Spheref(Nz::Vector3f(0.f, 0.f, -0.5f), 0.1f), 5 }
+			};
+
+			clusterGrid.Build(Nz::Matrix4f::Identity(), orthoMatrix, -1.f, 1.f, lights);
+
+			THEN("Depth slices are linear")
+			{
+				CHECK(clusterGrid.ComputeDepthSlice(-2.f) == 0);
+				CHECK(clusterGrid.ComputeDepthSlice(-0.9f) == 0);
+				CHECK(clusterGrid.ComputeDepthSlice(0.f) == 4);
+				CHECK(clusterGrid.ComputeDepthSlice(0.5f) == 6);
+				CHECK(clusterGrid.ComputeDepthSlice(2.f) == 7);
+
+				// Depth 0.4 to 0.6 spans slices 5 and 6
+				for (Nz::UInt32 z = 5; z <= 6; ++z)
+				{
+					for (Nz::UInt32 y = 1; y <= 2; ++y)
+					{
+						for (Nz::UInt32 x = 1; x <= 2; ++x)
+						{
+							std::span<const Nz::UInt32> clusterLights = clusterGrid.GetClusterLights(x, y, z);
+							REQUIRE(clusterLights.size() == 1);
+							CHECK(clusterLights[0] == 5);
+						}
+					}
+				}
+
+				CHECK(clusterGrid.GetLightIndices().size() == 8);
+			}
+		}
+	}
+}
@@ -0,0 +1,152 @@
+#include <Nazara/Graphics/RenderElement.hpp>
+#include <Nazara/Graphics/RenderQueue.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace
+{
+	class TestRenderElement : public Nz::RenderElement
+	{
+		public:
+			TestRenderElement(Nz::UInt32 instanceIndex, Nz::Int32 renderLayer, Nz::UInt64 sortKey) :
+			RenderElement(Nz::BasicRenderElement::Submesh, instanceIndex, renderLayer, 0xFFFFFFFF),
+			m_sortKey(sortKey)
+			{
+			}
+
+			void Register(Nz::RenderQueueRegistry& /*registry*/) const override
+			{
+			}
+
+		protected:
+			Nz::UInt64 ComputeSortKey(const Nz::RenderQueueRegistry& /*registry*/) const override
+			{
+				return m_sortKey;
+			}
+
+		private:
+			Nz::UInt64 m_sortKey;
+	};
+}
+
+SCENARIO("RenderQueue sorting", "[GRAPHICS][RENDERQUEUE]")
+{
+	std::minstd_rand randEngine(42);
+	std::uniform_int_distribution<Nz::Int32> layerDis(-2, 2);
+	std::uniform_int_distribution<Nz::UInt64> keyDis(0, 0xFFFF);
+
+	Nz::RenderQueueRegistry registry;
+
+	constexpr std::size_t elementCount = 1000;
+
+	std::vector<std::unique_ptr<TestRenderElement>> renderElements;
+	for (std::size_t i = 0; i < elementCount; ++i)
+	{
+		// Spread key bits over the whole 64bits range, with duplicates to check stability
+		Nz::UInt64 sortKey = keyDis(randEngine) << 48 | (keyDis(randEngine) & 0xF) << 20 | (i % 3);
+
+		renderElements.push_back(std::make_unique<TestRenderElement>(Nz::SafeCast<Nz::UInt32>(i), layerDis(randEngine), sortKey));
+		renderElements.back()->UpdateSortKey(registry);
+	}
+
+	std::vector<Nz::RenderQueue::SortEntry> entries;
+	std::vector<Nz::RenderQueue::SortEntry> buffer;
+
+	WHEN("Radix sorting keys")
+	{
+		for (const auto& element : renderElements)
+			entries.push_back({ element->GetSortKey(), element.get() });
+
+		std::vector<Nz::RenderQueue::SortEntry> expected = entries;
+		std::stable_sort(expected.begin(), expected.end(), [](const auto& lhs, const auto& rhs) { return lhs.key < rhs.key; });
+
+		Nz::RenderQueue::RadixSort(entries, buffer);
+
+		REQUIRE(entries.size() == expected.size());
+		for (std::size_t i = 0; i < entries.size(); ++i)
+		{
+			CHECK(entries[i].key == expected[i].key);
+			CHECK(entries[i].element == expected[i].element);
+		}
+	}
+
+	WHEN("Sorting entries by render layer and keys")
+	{
+		for (const auto& element : renderElements)
+			entries.push_back({ element->GetSortKey(), element.get() });
+
+		std::vector<Nz::RenderQueue::SortEntry> expected = entries;
+		std::stable_sort(expected.begin(), expected.end(), [](const auto& lhs, const auto& rhs)
+		{
+			if (lhs.element->GetRenderLayer() != rhs.element->GetRenderLayer())
+				return lhs.element->GetRenderLayer() < rhs.element->GetRenderLayer();
+
+			return lhs.key < rhs.key;
+		});
+
+		Nz::RenderQueue::SortEntries(entries, buffer);
+
+		REQUIRE(entries.size() == expected.size());
+		for (std::size_t i = 0; i < entries.size(); ++i)
+			CHECK(entries[i].element == expected[i].element);
+	}
+
+	WHEN("Computing distance sort keys")
+	{
+		const Nz::RenderElement& element = *renderElements.front();
+
+		CHECK(Nz::RenderQueue::ComputeBackToFrontSortKey(element, 10.f) < Nz::RenderQueue::ComputeBackToFrontSortKey(element, 1.f));
+		CHECK(Nz::RenderQueue::ComputeBackToFrontSortKey(element, 1.f) < Nz::RenderQueue::ComputeBackToFrontSortKey(element, 0.f));
+		CHECK(Nz::RenderQueue::ComputeFrontToBackSortKey(element, 0.f) < Nz::RenderQueue::ComputeFrontToBackSortKey(element, 1.f));
+		CHECK(Nz::RenderQueue::ComputeFrontToBackSortKey(element, 1.f) < Nz::RenderQueue::ComputeFrontToBackSortKey(element, 10.f));
+	}
+	WHEN("Reordering the elements of a render queue")
+	{
+		auto FillRenderQueue = [&](Nz::RenderQueue& renderQueue, std::size_t count)
+		{
+			renderQueue.BeginRegisterRenderable();
+			renderQueue.RegisterRenderable([&](std::vector<Nz::RenderElementOwner>& elements)
+			{
+				for (std::size_t i = 0; i < count; ++i)
+					elements.emplace_back(nullptr, 0, renderElements[i].get()); //< non-owning
+			});
+			renderQueue.FinalizeRegisterRenderable(0);
+			renderQueue.UpdateRenderQueue();
+		};
+
+		auto Reverse = [](std::vector<const Nz::RenderElement*>& elements)
+		{
+			std::reverse(elements.begin(), elements.end());
+		};
+
+		THEN("Front to back queues only hash their elements, not their order")
+		{
+			Nz::RenderQueue renderQueue(0, Nz::RenderQueueFlag::SortFrontToBack);
+			FillRenderQueue(renderQueue, 10);
+
+			renderQueue.SortRenderQueue([](std::vector<const Nz::RenderElement*>&) {});
+			std::size_t contentHash = renderQueue.GetContentHash();
+
+			renderQueue.SortRenderQueue(Reverse);
+			CHECK(renderQueue.GetContentHash() == contentHash);
+
+			renderQueue.SortRenderQueue([](std::vector<const Nz::RenderElement*>& elements) { elements.pop_back(); });
+			CHECK(renderQueue.GetContentHash() != contentHash);
+		}
+
+		THEN("Back to front queues hash their order")
+		{
+			Nz::RenderQueue renderQueue(0, Nz::RenderQueueFlag::SortByDistance);
+			FillRenderQueue(renderQueue, 10);
+
+			renderQueue.SortRenderQueue([](std::vector<const Nz::RenderElement*>&) {});
+			std::size_t contentHash = renderQueue.GetContentHash();
+
+			renderQueue.SortRenderQueue(Reverse);
+			CHECK(renderQueue.GetContentHash() != contentHash);
+		}
+	}
+}
@@ -0,0 +1,100 @@
+#include <Nazara/Network/ENetLz4Compressor.hpp>
+#include <Nazara/Network/ENetProtocol.hpp>
+#include <Nazara/Network/ENetZstdCompressor.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <array>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace
+{
+	// Mimics a game state update: a few entities sharing the same layout, with mostly small values
+	Nz::ByteArray BuildPacket(std::mt19937& randomGenerator, Nz::UInt32 sequence)
+	{
+		std::uniform_int_distribution<unsigned int> byteDistribution(0, 15);
+
+		Nz::ByteArray packet;
+		packet.Append(&sequence, sizeof(sequence));
+		for (Nz::UInt32 entityId = 0; entityId < 8; ++entityId)
+		{
+			std::array<Nz::UInt8, 24> entityData = {};
+			std::memcpy(&entityData[0], &entityId, sizeof(entityId));
+			for (std::size_t i = 4; i < 10; ++i)
+				entityData[i] = Nz::UInt8(byteDistribution(randomGenerator));
+
+			packet.Append(entityData.data(), entityData.size());
+		}
+
+		return packet;
+	}
+
+	void CheckRoundTrip(Nz::ENetCompressor& sender, Nz::ENetCompressor& receiver, const std::vector<Nz::ByteArray>& packets)
+	{
+		std::array<Nz::UInt8, Nz::ENetProtocol_MaximumMTU> compressed;
+		std::array<Nz::UInt8, Nz::ENetProtocol_MaximumMTU> decompressed;
+
+		for (const Nz::ByteArray& packet : packets)
+		{
+			// ENetHost passes commands and their payload as separate buffers
+			std::array<Nz::NetBuffer, 2> buffers;
+			buffers[0].data = const_cast<Nz::UInt8*>(packet.GetConstBuffer());
+			buffers[0].dataLength = packet.GetSize() / 3;
+			buffers[1].data = const_cast<Nz::UInt8*>(packet.GetConstBuffer()) + buffers[0].dataLength;
+			buffers[1].dataLength = packet.GetSize() - buffers[0].dataLength;
+
+			std::size_t compressedSize = sender.Compress(nullptr, buffers.data(), buffers.size(), packet.GetSize(), compressed.data(), compressed.size());
+			REQUIRE(compressedSize > 0);
+			CHECK(compressedSize < packet.GetSize());
+
+			std::size_t decompressedSize = receiver.Decompress(nullptr, compressed.data(), compressedSize, decompressed.data(), decompressed.size());
+			REQUIRE(decompressedSize == packet.GetSize());
+			CHECK(std::memcmp(decompressed.data(), packet.GetConstBuffer(), packet.GetSize()) == 0);
+		}
+	}
+}
+
+SCENARIO("ENetCompressor", "[NETWORK][ENETCOMPRESSOR]")
+{
+	std::mt19937 randomGenerator(42);
+
+	std::vector<Nz::ByteArray> samples;
+	for (Nz::UInt32 i = 0; i < 4000; ++i)
+		samples.push_back(BuildPacket(randomGenerator, i));
+
+	std::vector<Nz::ByteArray> packets;
+	for (Nz::UInt32 i = 0; i < 100; ++i)
+		packets.push_back(BuildPacket(randomGenerator, 10'000 + i));
+
+	WHEN("Compressing packets with LZ4")
+	{
+		Nz::ENetLz4Compressor sender;
+		Nz::ENetLz4Compressor receiver;
+		CheckRoundTrip(sender, receiver, packets);
+	}
+
+	WHEN("Compressing packets with Zstd")
+	{
+		Nz::ENetZstdCompressor sender;
+		Nz::ENetZstdCompressor receiver;
+		CheckRoundTrip(sender, receiver, packets);
+	}
+
+	WHEN("Training a dictionary from captured packets")
+	{
+		Nz::ByteArray dictionary = Nz::ENetCompressor::TrainDictionary(samples, 4 * 1024);
+		REQUIRE(!dictionary.IsEmpty());
+		CHECK(dictionary.GetSize() <= 4 * 1024);
+
+		THEN("Both compressors can use it")
+		{
+			Nz::ENetLz4Compressor lz4Sender(dictionary);
+			Nz::ENetLz4Compressor lz4Receiver(dictionary);
+			CheckRoundTrip(lz4Sender, lz4Receiver, packets);
+
+			Nz::ENetZstdCompressor zstdSender(dictionary);
+			Nz::ENetZstdCompressor zstdReceiver(dictionary);
+			CheckRoundTrip(zstdSender, zstdReceiver, packets);
+		}
+	}
+}
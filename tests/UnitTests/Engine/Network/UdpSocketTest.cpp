@@ -1,9 +1,11 @@
 #include <Nazara/Core/ByteArray.hpp>
 #include <Nazara/Core/ByteStream.hpp>
 #include <Nazara/Math/Vector3.hpp>
+#include <Nazara/Network/NetDatagram.hpp>
 #include <Nazara/Network/UdpSocket.hpp>
 #include <catch2/catch_approx.hpp>
 #include <catch2/catch_test_macros.hpp>
+#include <array>
 
 SCENARIO("UdpSocket", "[NETWORK][UDPSOCKET]")
 {
@@ -41,5 +43,63 @@ SCENARIO("UdpSocket", "[NETWORK][UDPSOCKET]")
 				REQUIRE(result == vector123);
 			}
 		}
+
+		WHEN("We send a batch of datagrams from client")
+		{
+			constexpr std::size_t datagramCount = 3;
+
+			std::array<Nz::UInt32, datagramCount> values = { 42, 1337, 0xDEADBEEF };
+			std::array<Nz::NetBuffer, datagramCount> buffers;
+			std::array<Nz::NetDatagram, datagramCount> datagrams;
+			for (std::size_t i = 0; i < datagramCount; ++i)
+			{
+				buffers[i].data = &values[i];
+				buffers[i].dataLength = sizeof(Nz::UInt32);
+
+				datagrams[i].address = serverIP;
+				datagrams[i].buffers = &buffers[i];
+				datagrams[i].bufferCount = 1;
+			}
+
+			std::size_t sentCount;
+			REQUIRE(client.SendBatch(datagrams.data(), datagrams.size(), &sentCount));
+			CHECK(sentCount == datagramCount);
+			for (const Nz::NetDatagram& datagram : datagrams)
+				CHECK(datagram.size == sizeof(Nz::UInt32));
+
+			THEN("We should get all of them on the server, in order")
+			{
+				std::array<Nz::UInt32, datagramCount> results = {};
+				std::array<Nz::NetBuffer, datagramCount> resultBuffers;
+				std::array<Nz::NetDatagram, datagramCount> resultDatagrams;
+
+				// A blocking socket only waits for the first datagram, receive until we got everything
+				std::size_t receivedCount = 0;
+				while (receivedCount < datagramCount)
+				{
+					for (std::size_t i = receivedCount; i < datagramCount; ++i)
+					{
+						resultBuffers[i].data = &results[i];
+						resultBuffers[i].dataLength = sizeof(Nz::UInt32);
+
+						resultDatagrams[i].buffers = &resultBuffers[i];
+						resultDatagrams[i].bufferCount = 1;
+					}
+
+					std::size_t received;
+					REQUIRE(server.ReceiveBatch(&resultDatagrams[receivedCount], datagramCount - receivedCount, &received));
+					REQUIRE(received > 0);
+
+					receivedCount += received;
+				}
+
+				CHECK(results == values);
+				for (const Nz::NetDatagram& datagram : resultDatagrams)
+				{
+					CHECK(datagram.size == sizeof(Nz::UInt32));
+					CHECK(datagram.address.GetPort() != 0);
+				}
+			}
+		}
 	}
 }
@@ -1,3 +1,4 @@
+#include <Nazara/Core/TaskScheduler.hpp>
 #include <Nazara/Physics2D/PhysWorld2D.hpp>
 #include <catch2/catch_approx.hpp>
 #include <catch2/catch_test_macros.hpp>
@@ -99,6 +100,91 @@ SCENARIO("PhysWorld2D", "[PHYSICS2D][PHYSWORLD2D]")
 				CHECK(results[0] == &bodies[0]);
 			}
 		}
+
+		WHEN("We run batched queries")
+		{
+			// One query per column, plus one missing everything, repeated so batches are larger than the query grain size (64) and get split across threads
+			constexpr std::size_t queriesPerRepeat = numberOfBodiesPerLign + 1;
+			constexpr std::size_t repeatCount = 50;
+
+			std::vector<Nz::PhysWorld2D::Raycast> raycasts;
+			std::vector<Nz::Vector2f> positions;
+			std::vector<Nz::Rectf> regions;
+			for (std::size_t r = 0; r < repeatCount; ++r)
+			{
+				for (int i = 0; i != numberOfBodiesPerLign; ++i)
+				{
+					raycasts.push_back({ Nz::Vector2f(10.f * i, -2.f), Nz::Vector2f(10.f * i, 40.f), 1.f });
+					positions.push_back(Nz::Vector2f(10.f * i, -1.f));
+					regions.push_back(Nz::Rectf(10.f * i - 5.f, -5.f, 10.f, 30.f));
+				}
+
+				raycasts.push_back({ Nz::Vector2f(-20.f, -2.f), Nz::Vector2f(-20.f, 40.f), 1.f });
+				positions.push_back(Nz::Vector2f(-20.f, -1.f));
+				regions.push_back(Nz::Rectf(-25.f, -5.f, 10.f, 30.f));
+			}
+
+			auto CheckBatches = [&]
+			{
+				std::vector<Nz::PhysWorld2D::RaycastHit> hits(raycasts.size());
+				CHECK(world.RaycastQueryFirstBatch(raycasts, collisionGroup, categoryMask, collisionMask, hits) == numberOfBodiesPerLign * repeatCount);
+
+				std::vector<Nz::PhysWorld2D::NearestQueryResult> nearestResults(positions.size());
+				CHECK(world.NearestBodyQueryBatch(positions, 2.f, collisionGroup, categoryMask, collisionMask, nearestResults) == numberOfBodiesPerLign * repeatCount);
+
+				constexpr std::size_t maxBodiesPerQuery = 2;
+				std::vector<Nz::RigidBody2D*> regionBodies(regions.size() * maxBodiesPerQuery);
+				std::vector<std::size_t> regionBodyCounts(regions.size());
+				CHECK(world.RegionQueryBatch(regions, collisionGroup, categoryMask, collisionMask, regionBodies, maxBodiesPerQuery, regionBodyCounts) == numberOfBodiesPerLign * maxBodiesPerQuery * repeatCount);
+
+				for (std::size_t queryIndex = 0; queryIndex < raycasts.size(); ++queryIndex)
+				{
+					INFO("query #" << queryIndex);
+
+					std::size_t column = queryIndex % queriesPerRepeat;
+					if (column == numberOfBodiesPerLign)
+					{
+						CHECK(hits[queryIndex].nearestBody == nullptr);
+						CHECK(nearestResults[queryIndex].nearestBody == nullptr);
+						CHECK(regionBodyCounts[queryIndex] == 0);
+						continue;
+					}
+
+					Nz::PhysWorld2D::RaycastHit expectedHit;
+					REQUIRE(world.RaycastQueryFirst(raycasts[queryIndex].from, raycasts[queryIndex].to, raycasts[queryIndex].radius, collisionGroup, categoryMask, collisionMask, &expectedHit));
+
+					CHECK(hits[queryIndex].nearestBody == &bodies[column * numberOfBodiesPerLign]);
+					CHECK(hits[queryIndex].fraction == Catch::Approx(expectedHit.fraction));
+					CHECK(hits[queryIndex].hitPos == expectedHit.hitPos);
+					CHECK(hits[queryIndex].hitNormal == expectedHit.hitNormal);
+
+					CHECK(nearestResults[queryIndex].nearestBody == &bodies[column * numberOfBodiesPerLign]);
+					CHECK(nearestResults[queryIndex].distance == Catch::Approx(1.f));
+
+					// Region covers the whole column but results are capped
+					CHECK(regionBodyCounts[queryIndex] == maxBodiesPerQuery);
+				}
+
+				// Counting nothing with an empty body array is valid
+				CHECK(world.RegionQueryBatch(regions, collisionGroup, categoryMask, collisionMask, {}, 0, regionBodyCounts) == 0);
+				CHECK(regionBodyCounts.front() == 0);
+			};
+
+			THEN("Results should match single queries")
+			{
+				CheckBatches();
+			}
+
+			THEN("Results should be the same when queries are run on a task scheduler")
+			{
+				Nz::TaskScheduler taskScheduler(4);
+				world.SetTaskScheduler(&taskScheduler);
+
+				CheckBatches();
+
+				world.SetTaskScheduler(nullptr);
+			}
+		}
 	}
 
 	GIVEN("Three entities, a character, a wall and a trigger zone")
@@ -0,0 +1,100 @@
+#include <Nazara/Core/Components/NodeComponent.hpp>
+#include <Nazara/Physics2D/Systems/Physics2DSystem.hpp>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <entt/entt.hpp>
+
+SCENARIO("Physics2DSystem", "[PHYSICS2D][PHYSICS2DSYSTEM]")
+{
+	GIVEN("A physics system and a moving body")
+	{
+		entt::registry registry;
+		Nz::Physics2DSystem physicsSystem(registry);
+
+		Nz::PhysWorld2D& world = physicsSystem.GetPhysWorld();
+		world.SetGravity(Nz::Vector2f::Zero());
+		world.SetStepSize(Nz::Time::Milliseconds(10));
+
+		entt::entity entity = registry.create();
+		auto& node = registry.emplace<Nz::NodeComponent>(entity);
+
+		std::shared_ptr<Nz::Collider2D> box = std::make_shared<Nz::BoxCollider2D>(Nz::Rectf(-0.5f, -0.5f, 1.f, 1.f));
+		auto& rigidBody = registry.emplace<Nz::RigidBody2DComponent>(entity, Nz::RigidBody2D::DynamicSettings(box, 1.f));
+		rigidBody.SetVelocity(Nz::Vector2f(10.f, -5.f));
+
+		// Record the body pose before each step, on our side
+		Nz::Vector2f previousPosition = rigidBody.GetPosition();
+		world.OnPhysWorld2DPreStep.Connect([&](const Nz::PhysWorld2D* /*physWorld*/, float /*invStepCount*/)
+		{
+			previousPosition = rigidBody.GetPosition();
+		});
+
+		WHEN("Transform interpolation is enabled and time is left in the accumulator")
+		{
+			physicsSystem.EnableTransformInterpolation();
+			CHECK(physicsSystem.IsTransformInterpolationEnabled());
+
+			// Two and a half steps
+			physicsSystem.Update(Nz::Time::Milliseconds(25));
+
+			Nz::Time accumulator = world.GetTimestepAccumulator();
+			REQUIRE(accumulator > Nz::Time::Zero());
+			REQUIRE(accumulator < world.GetStepSize());
+
+			THEN("The node is placed between the two last body positions")
+			{
+				float interpolation = accumulator.AsSeconds<float>() / world.GetStepSize().AsSeconds<float>();
+				CHECK(interpolation == Catch::Approx(0.5f).margin(0.01f));
+
+				Nz::Vector2f currentPosition = rigidBody.GetPosition();
+				Nz::Vector2f expectedPosition = Nz::Vector2f::Lerp(previousPosition, currentPosition, interpolation);
+
+				Nz::Vector3f nodePosition = node.GetPosition();
+				CHECK(nodePosition.x == Catch::Approx(expectedPosition.x).margin(0.0001f));
+				CHECK(nodePosition.y == Catch::Approx(expectedPosition.y).margin(0.0001f));
+
+				// The node lags behind the body
+				CHECK(nodePosition.x < currentPosition.x);
+				CHECK(nodePosition.y > currentPosition.y);
+			}
+
+			AND_WHEN("More time passes without completing a step")
+			{
+				Nz::Vector2f currentPosition = rigidBody.GetPosition();
+				Nz::Vector2f stepStartPosition = previousPosition;
+
+				physicsSystem.Update(Nz::Time::Milliseconds(3));
+
+				THEN("The node moves further along the same step")
+				{
+					float interpolation = world.GetTimestepAccumulator().AsSeconds<float>() / world.GetStepSize().AsSeconds<float>();
+					CHECK(interpolation == Catch::Approx(0.8f).margin(0.01f));
+
+					CHECK(rigidBody.GetPosition() == currentPosition);
+
+					Nz::Vector2f expectedPosition = Nz::Vector2f::Lerp(stepStartPosition, currentPosition, interpolation);
+
+					Nz::Vector3f nodePosition = node.GetPosition();
+					CHECK(nodePosition.x == Catch::Approx(expectedPosition.x).margin(0.0001f));
+					CHECK(nodePosition.y == Catch::Approx(expectedPosition.y).margin(0.0001f));
+				}
+			}
+		}
+
+		WHEN("Transform interpolation is disabled")
+		{
+			CHECK_FALSE(physicsSystem.IsTransformInterpolationEnabled());
+
+			physicsSystem.Update(Nz::Time::Milliseconds(25));
+
+			THEN("The node follows the body")
+			{
+				Nz::Vector2f currentPosition = rigidBody.GetPosition();
+
+				Nz::Vector3f nodePosition = node.GetPosition();
+				CHECK(nodePosition.x == Catch::Approx(currentPosition.x).margin(0.0001f));
+				CHECK(nodePosition.y == Catch::Approx(currentPosition.y).margin(0.0001f));
+			}
+		}
+	}
+}
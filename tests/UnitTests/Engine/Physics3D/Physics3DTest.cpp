@@ -0,0 +1,64 @@
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <Nazara/Physics3D/Collider3D.hpp>
+#include <Nazara/Physics3D/Physics3D.hpp>
+#include <Nazara/Physics3D/PhysWorld3D.hpp>
+#include <Nazara/Physics3D/RigidBody3D.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <memory>
+#include <vector>
+
+SCENARIO("Physics3D", "[PHYSICS3D]")
+{
+	GIVEN("A task scheduler running physics jobs")
+	{
+		Nz::TaskScheduler taskScheduler(4);
+
+		Nz::Physics3D::Config physicsConfig;
+		physicsConfig.taskScheduler = &taskScheduler;
+
+		WHEN("The module is destroyed right after a step")
+		{
+			// Jobs run inline by a barrier leave their queued task pending, repeat to give them a chance to outlive the step
+			for (std::size_t i = 0; i < 20; ++i)
+			{
+				Nz::Physics3D physics3D(physicsConfig);
+
+				Nz::PhysWorld3D physWorld;
+				physWorld.SetGravity(Nz::Vector3f::Down() * 9.81f);
+
+				Nz::RigidBody3D::StaticSettings groundSettings(std::make_shared<Nz::BoxCollider3D>(Nz::Vector3f(50.f, 1.f, 50.f)));
+				groundSettings.position = Nz::Vector3f::Down() * 0.5f;
+
+				std::vector<Nz::RigidBody3D> bodies;
+				bodies.reserve(201);
+				bodies.emplace_back(physWorld, groundSettings);
+
+				auto boxCollider = std::make_shared<Nz::BoxCollider3D>(Nz::Vector3f(1.f));
+				for (std::size_t y = 0; y < 8; ++y)
+				{
+					for (std::size_t x = 0; x < 5; ++x)
+					{
+						for (std::size_t z = 0; z < 5; ++z)
+						{
+							Nz::RigidBody3D::DynamicSettings settings(boxCollider, 1.f);
+							settings.position = Nz::Vector3f(float(x) * 1.2f, 1.f + float(y) * 1.1f, float(z) * 1.2f);
+
+							bodies.emplace_back(physWorld, settings);
+						}
+					}
+				}
+
+				Nz::Vector3f startPosition = bodies.back().GetPosition();
+				for (std::size_t step = 0; step < 5; ++step)
+					physWorld.Step(physWorld.GetStepSize());
+
+				CHECK(bodies.back().GetPosition().y < startPosition.y);
+
+				// Bodies, world and module (owning the job system) are destroyed here, without waiting on the task scheduler
+			}
+
+			// A task referencing a destroyed job system would crash while being run here (or earlier, by a worker)
+			taskScheduler.WaitForTasks();
+		}
+	}
+}
@@ -0,0 +1,11 @@
+option("assetpacker", { description = "Build AssetPacker tool", default = false })
+
+if has_config("assetpacker") then
+	target("NazaraAssetPacker", function ()
+		set_group("Tools")
+		set_kind("binary")
+
+		add_deps("NazaraCore")
+		add_files("../src/AssetPacker/main.cpp")
+	end)
+end
@@ -106,7 +106,7 @@ local modules = {
 				remove_files("src/Nazara/Core/Posix/TimeImpl.cpp")
 			end
 		end,
-		Packages = { "concurrentqueue", "entt", "frozen", "ordered_map", "stb", "utfcpp" },
+		Packages = { "concurrentqueue", "entt", "frozen", "lz4", "ordered_map", "stb", "utfcpp", "zstd" },
 		PublicPackages = { "nazarautils" }
 	},
 	Graphics = {
@@ -127,6 +127,7 @@ local modules = {
 	Network = {
 		Option = "network",
 		Deps = {"NazaraCore"},
+		Packages = { "concurrentqueue", "lz4", "zstd" },
 		Custom = function ()
 			if not is_plat("wasm") then
 				if has_config("link_curl") then
@@ -286,10 +287,12 @@ add_requires(
 	"entt",
 	"fmt",
 	"frozen",
+	"lz4",
 	"ordered_map",
 	"nazarautils",
 	"stb",
-	"utfcpp"
+	"utfcpp",
+	"zstd"
 )
 
 -- Don't link with system-installed libs on CI